@@ -0,0 +1,260 @@
+"""
+UnrealGPT Python Execution Context
+
+Runs python_execute snippets inside one persistent namespace, so imports and variables survive between
+tool calls. The editor calls run_b64() through the Python plugin's statement evaluation and reads the
+returned JSON directly; nothing is written to disk.
+
+Each snippet sees a fresh `result` dict ({"status", "message", "details"}) that it may update or replace.
+
+Every run is accounted: snippets that re-enumerate the level or the asset registry inside loops are
+flagged. With count_calls=True a sys.setprofile hook also counts unreal.* API calls; it costs a Python
+callback per C call, so it is opt-in. With profile=True the snippet runs under cProfile instead, which
+reports the same counts and the hottest functions.
+"""
+
+# Copyright (c) 2025 TREE Industries.
+
+import ast
+import base64
+import collections
+import contextlib
+import cProfile
+import io
+import json
+import os
+import pstats
+import sys
+import time
+import traceback
+
+import unreal
+
+MAX_CAPTURED_CHARS = 8000
+MAX_TOP_UNREAL_CALLS = 10
+MAX_PROFILE_ENTRIES = 50
+
+# Calls that walk the whole level or asset registry; one per loop iteration is the classic slow snippet.
+ENUMERATION_CALLS = frozenset((
+    "get_all_level_actors",
+    "get_all_level_actors_components",
+    "get_all_actors_of_class",
+    "get_all_actors_with_tag",
+    "get_selected_level_actors",
+    "list_assets",
+    "get_assets_by_path",
+    "get_assets_by_class",
+    "get_assets",
+))
+REPEATED_ENUMERATION_THRESHOLD = 3
+
+_namespace = {}
+
+
+class _JsonResult(str):
+    """A str whose repr() is itself, so the plugin's evaluation result is the raw JSON text."""
+
+    def __repr__(self):
+        return str.__str__(self)
+
+
+def reset():
+    """Drop every name defined by earlier snippets and restore the preloaded modules."""
+    _namespace.clear()
+    _namespace.update({
+        "__name__": "__unrealgpt__",
+        "__builtins__": __builtins__,
+        "json": json,
+        "os": os,
+        "traceback": traceback,
+        "unreal": unreal,
+    })
+
+
+def _clip(text):
+    if len(text) <= MAX_CAPTURED_CHARS:
+        return text
+    return text[:MAX_CAPTURED_CHARS] + "\n... [truncated %d chars]" % (len(text) - MAX_CAPTURED_CHARS)
+
+
+def _unreal_call_name(func):
+    """'Class.method' or 'function' when func is a builtin exposed by the unreal module, else None."""
+    owner = getattr(func, "__self__", None)
+    if owner is unreal:
+        return func.__name__
+    owner_type = owner if isinstance(owner, type) else type(owner)
+    if owner is None or owner_type.__module__ != "unreal":
+        return None
+    return owner_type.__name__ + "." + func.__name__
+
+
+class _CallCounter(object):
+    """sys.setprofile hook counting calls into the unreal module; only C calls are inspected."""
+
+    def __init__(self):
+        self.counts = collections.Counter()
+
+    def __call__(self, frame, event, arg):
+        if event == "c_call":
+            name = _unreal_call_name(arg)
+            if name:
+                self.counts[name] += 1
+
+
+def _unreal_name_from_profile(func_name):
+    """Map a cProfile builtin label to an unreal call name."""
+    if func_name.startswith("<built-in method unreal."):
+        return func_name[len("<built-in method unreal."):-1]
+    if func_name.startswith("<method '") and func_name.endswith("' objects>"):
+        method, _, owner = func_name[len("<method '"):-len("' objects>")].partition("' of '")
+        if isinstance(getattr(unreal, owner, None), type):
+            return owner + "." + method
+    return None
+
+
+def _profile_report(profiler, top):
+    """Hot functions by self time, and the unreal call counts recorded by the profiler."""
+    stats = pstats.Stats(profiler)
+    entries = []
+    counts = collections.Counter()
+    for (filename, lineno, func_name), (_, num_calls, self_time, cumulative_time, _) in stats.stats.items():
+        if "_lsprof" in func_name:
+            continue
+        entries.append((self_time, cumulative_time, num_calls, filename, lineno, func_name))
+        unreal_name = _unreal_name_from_profile(func_name)
+        if unreal_name:
+            counts[unreal_name] += num_calls
+
+    entries.sort(reverse=True)
+    hot = []
+    for self_time, cumulative_time, num_calls, filename, lineno, func_name in entries[:top]:
+        location = func_name if filename == "~" else "%s:%d(%s)" % (os.path.basename(filename), lineno, func_name)
+        hot.append({
+            "function": location,
+            "calls": num_calls,
+            "self_ms": round(self_time * 1000.0, 3),
+            "cumulative_ms": round(cumulative_time * 1000.0, 3),
+        })
+    return hot, counts
+
+
+class _LoopEnumerationFinder(ast.NodeVisitor):
+    """Finds ENUMERATION_CALLS made inside loop bodies or comprehensions."""
+
+    def __init__(self):
+        self.loop_depth = 0
+        self.findings = []
+
+    def _visit_loop(self, node):
+        self.loop_depth += 1
+        self.generic_visit(node)
+        self.loop_depth -= 1
+
+    visit_For = visit_While = visit_ListComp = visit_SetComp = visit_DictComp = visit_GeneratorExp = _visit_loop
+
+    def visit_Call(self, node):
+        name = getattr(node.func, "attr", None) or getattr(node.func, "id", None)
+        if self.loop_depth and name in ENUMERATION_CALLS:
+            self.findings.append((node.lineno, name))
+        self.generic_visit(node)
+
+
+def _find_pathologies(code, counts):
+    warnings = []
+    flagged = set()
+    try:
+        finder = _LoopEnumerationFinder()
+        finder.visit(ast.parse(code))
+        for lineno, name in finder.findings:
+            flagged.add(name)
+            warnings.append(
+                "line %d: %s() inside a loop enumerates the level or asset registry on every iteration; "
+                "call it once before the loop and reuse the result" % (lineno, name))
+    except SyntaxError:
+        pass
+
+    for qualified, count in counts.items():
+        name = qualified.rpartition(".")[2]
+        if name in ENUMERATION_CALLS and name not in flagged and count >= REPEATED_ENUMERATION_THRESHOLD:
+            warnings.append("%s() was called %d times in one snippet; cache its result" % (qualified, count))
+
+    if "EditorLevelLibrary" in code:
+        warnings.append("unreal.EditorLevelLibrary is deprecated; use unreal.get_editor_subsystem(unreal.EditorActorSubsystem)")
+    return warnings
+
+
+def run(code, profile=False, top=15, count_calls=False):
+    """Execute code in the persistent namespace and return the result envelope as JSON."""
+    if not _namespace:
+        reset()
+
+    _namespace["result"] = {
+        "status": "ok",
+        "message": "Python code executed. No custom result message was set.",
+        "details": {},
+    }
+
+    stdout = io.StringIO()
+    stderr = io.StringIO()
+    profiler = cProfile.Profile() if profile else None
+    counter = _CallCounter() if count_calls and not profile else None
+    start = time.perf_counter()
+    try:
+        with contextlib.redirect_stdout(stdout), contextlib.redirect_stderr(stderr):
+            compiled = compile(code, "<python_execute>", "exec")
+            if profiler:
+                profiler.enable()
+            elif counter:
+                sys.setprofile(counter)
+            try:
+                exec(compiled, _namespace)
+            finally:
+                if profiler:
+                    profiler.disable()
+                elif counter:
+                    sys.setprofile(None)
+    except Exception as e:
+        result = _namespace.get("result")
+        if not isinstance(result, dict):
+            result = {}
+            _namespace["result"] = result
+        result["status"] = "error"
+        result["message"] = str(e)
+        details = result.setdefault("details", {})
+        if isinstance(details, dict):
+            details["traceback"] = traceback.format_exc()
+    elapsed_ms = (time.perf_counter() - start) * 1000.0
+
+    result = _namespace.get("result")
+    if not isinstance(result, dict):
+        result = {"status": "ok", "message": str(result), "details": {}}
+
+    if profiler:
+        hot, counts = _profile_report(profiler, max(1, min(int(top), MAX_PROFILE_ENTRIES)))
+    else:
+        hot, counts = None, counter.counts if counter else None
+
+    accounting = {}
+    if counts is not None:
+        accounting["unreal_api_calls"] = sum(counts.values())
+        accounting["top_unreal_calls"] = [{"name": name, "count": count} for name, count in counts.most_common(MAX_TOP_UNREAL_CALLS)]
+    warnings = _find_pathologies(code, counts or collections.Counter())
+    if warnings:
+        accounting["warnings"] = warnings
+
+    envelope = dict(result)
+    envelope["elapsed_ms"] = round(elapsed_ms, 2)
+    envelope["accounting"] = accounting
+    if hot is not None:
+        envelope["profile"] = {"sort": "self_ms", "hot_functions": hot}
+    if stdout.getvalue():
+        envelope["stdout"] = _clip(stdout.getvalue())
+    if stderr.getvalue():
+        envelope["stderr"] = _clip(stderr.getvalue())
+
+    return _JsonResult(json.dumps(envelope, default=str))
+
+
+def run_b64(encoded, profile=False, top=15, count_calls=False):
+    """run() for UTF-8 source passed as base64, which needs no escaping inside the evaluated statement."""
+    return run(base64.b64decode(encoded).decode("utf-8"), profile, top, count_calls)
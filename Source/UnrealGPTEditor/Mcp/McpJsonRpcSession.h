@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "IMcpTransport.h"
 #include "Dom/JsonObject.h"
+#include <atomic>
 
 /**
  * MCP JSON-RPC 2.0 session over any IMcpTransport.
@@ -17,6 +18,7 @@ public:
 
 	bool ConnectAndInitialize(float TimeoutSeconds, FString& OutError);
 	void Disconnect();
+	/** Safe to poll from any thread while a request holds the session. */
 	bool IsInitialized() const { return bInitialized; }
 
 	bool SendRequest(
@@ -38,7 +40,7 @@ private:
 	void DrainNotifications(float TimeoutSeconds);
 
 	TUniquePtr<IMcpTransport> Transport;
-	bool bInitialized = false;
+	std::atomic<bool> bInitialized = false;
 	int32 NextRequestId = 1;
 	FCriticalSection SessionLock;
 };
@@ -2,29 +2,153 @@
 
 #include "McpResultNormalizer.h"
 
-#include "Http.h"
-#include "HAL/PlatformProcess.h"
-#include "Misc/Base64.h"
-#include "Misc/FileHelper.h"
+#include "UnrealGPTDownloadManager.h"
+#include "HAL/FileManager.h"
 #include "Misc/Paths.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 
 namespace
 {
-	FString ExtensionFromMime(const FString& Mime)
+	/** Base64 characters per decode chunk; each chunk decodes into a fixed 48 KB buffer. */
+	constexpr int32 Base64ChunkChars = 64 * 1024;
+
+	constexpr int8 Base64Invalid = -1;
+	constexpr int8 Base64Skip = -2;
+	constexpr int8 Base64Pad = -3;
+
+	/** Sextet value for each ASCII character; accepts both the standard and the URL-safe alphabet. */
+	struct FBase64DecodeTable
 	{
-		if (Mime.Contains(TEXT("png"))) return TEXT("png");
-		if (Mime.Contains(TEXT("jpeg"))) return TEXT("jpg");
-		if (Mime.Contains(TEXT("webp"))) return TEXT("webp");
-		if (Mime.Contains(TEXT("wav"))) return TEXT("wav");
-		if (Mime.Contains(TEXT("mpeg"))) return TEXT("mp3");
-		if (Mime.Contains(TEXT("mp4"))) return TEXT("mp4");
-		if (Mime.Contains(TEXT("fbx"))) return TEXT("fbx");
-		if (Mime.Contains(TEXT("gltf"))) return TEXT("gltf");
-		if (Mime.Contains(TEXT("glb"))) return TEXT("glb");
-		if (Mime.Contains(TEXT("obj"))) return TEXT("obj");
-		return TEXT("bin");
+		int8 Values[256];
+
+		FBase64DecodeTable()
+		{
+			FMemory::Memset(Values, Base64Invalid, sizeof(Values));
+			const char* Alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+			for (int8 Index = 0; Index < 64; ++Index)
+			{
+				Values[static_cast<uint8>(Alphabet[Index])] = Index;
+			}
+			Values['-'] = 62;
+			Values['_'] = 63;
+			Values['='] = Base64Pad;
+			Values[' '] = Values['\t'] = Values['\r'] = Values['\n'] = Base64Skip;
+		}
+
+		FORCEINLINE int8 Lookup(TCHAR Char) const
+		{
+			return static_cast<uint32>(Char) < 256 ? Values[static_cast<uint32>(Char)] : Base64Invalid;
+		}
+	};
+
+	/**
+	 * Decode Num base64 characters straight from the caller's buffer into Writer, one chunk at a time, so
+	 * memory stays at one chunk however large the payload is. Whitespace is skipped and trailing padding is
+	 * optional.
+	 */
+	bool DecodeBase64ToArchive(const TCHAR* Chars, int32 Num, FArchive& Writer, int64& OutNumBytes)
+	{
+		static const FBase64DecodeTable Table;
+
+		TArray<uint8> Storage;
+		Storage.SetNumUninitialized(Base64ChunkChars / 4 * 3);
+		uint8* Buffer = Storage.GetData();
+		int32 BufferUsed = 0;
+		uint32 Quad = 0;
+		int32 QuadChars = 0;
+		int32 Index = 0;
+		OutNumBytes = 0;
+
+		const auto Flush = [&Writer, Buffer, &BufferUsed, &OutNumBytes]()
+		{
+			Writer.Serialize(Buffer, BufferUsed);
+			OutNumBytes += BufferUsed;
+			BufferUsed = 0;
+		};
+
+		while (Index < Num)
+		{
+			const int32 ChunkEnd = FMath::Min(Num, Index + Base64ChunkChars);
+			while (Index < ChunkEnd)
+			{
+				// Fast path: four alphabet characters in a row, the common case for unwrapped payloads
+				if (QuadChars == 0 && Index + 4 <= ChunkEnd)
+				{
+					const int8 A = Table.Lookup(Chars[Index]);
+					const int8 B = Table.Lookup(Chars[Index + 1]);
+					const int8 C = Table.Lookup(Chars[Index + 2]);
+					const int8 D = Table.Lookup(Chars[Index + 3]);
+					if ((A | B | C | D) >= 0)
+					{
+						const uint32 Bits = (static_cast<uint32>(A) << 18) | (static_cast<uint32>(B) << 12) | (static_cast<uint32>(C) << 6) | static_cast<uint32>(D);
+						Buffer[BufferUsed++] = static_cast<uint8>(Bits >> 16);
+						Buffer[BufferUsed++] = static_cast<uint8>(Bits >> 8);
+						Buffer[BufferUsed++] = static_cast<uint8>(Bits);
+						Index += 4;
+						continue;
+					}
+				}
+
+				const int8 Value = Table.Lookup(Chars[Index]);
+				if (Value == Base64Skip)
+				{
+					++Index;
+					continue;
+				}
+				if (Value == Base64Pad)
+				{
+					break;
+				}
+				if (Value == Base64Invalid)
+				{
+					return false;
+				}
+
+				Quad = (Quad << 6) | static_cast<uint32>(Value);
+				++Index;
+				if (++QuadChars == 4)
+				{
+					Buffer[BufferUsed++] = static_cast<uint8>(Quad >> 16);
+					Buffer[BufferUsed++] = static_cast<uint8>(Quad >> 8);
+					Buffer[BufferUsed++] = static_cast<uint8>(Quad);
+					Quad = 0;
+					QuadChars = 0;
+				}
+			}
+
+			if (Index < ChunkEnd)
+			{
+				// Stopped at padding: only more padding and whitespace may follow
+				for (; Index < Num; ++Index)
+				{
+					const int8 Value = Table.Lookup(Chars[Index]);
+					if (Value != Base64Pad && Value != Base64Skip)
+					{
+						return false;
+					}
+				}
+			}
+			Flush();
+		}
+
+		// A final group of two or three characters carries one or two bytes
+		if (QuadChars == 1)
+		{
+			return false;
+		}
+		if (QuadChars == 2)
+		{
+			Buffer[BufferUsed++] = static_cast<uint8>(Quad >> 4);
+		}
+		else if (QuadChars == 3)
+		{
+			Buffer[BufferUsed++] = static_cast<uint8>(Quad >> 10);
+			Buffer[BufferUsed++] = static_cast<uint8>(Quad >> 2);
+		}
+		Flush();
+
+		return !Writer.IsError();
 	}
 
 	void CollectContentBlocks(
@@ -113,6 +237,22 @@ FString FMcpResultNormalizer::NormalizeMimeType(const FString& MimeOrExtension)
 	return Lower;
 }
 
+FString FMcpResultNormalizer::ExtensionFromMime(const FString& Mime)
+{
+	if (Mime.Contains(TEXT("png"))) return TEXT("png");
+	if (Mime.Contains(TEXT("jpeg"))) return TEXT("jpg");
+	if (Mime.Contains(TEXT("webp"))) return TEXT("webp");
+	if (Mime.Contains(TEXT("wav"))) return TEXT("wav");
+	if (Mime.Contains(TEXT("mpeg"))) return TEXT("mp3");
+	if (Mime.Contains(TEXT("mp4"))) return TEXT("mp4");
+	if (Mime.Contains(TEXT("fbx"))) return TEXT("fbx");
+	if (Mime.Contains(TEXT("gltf-binary"))) return TEXT("glb");
+	if (Mime.Contains(TEXT("gltf"))) return TEXT("gltf");
+	if (Mime.Contains(TEXT("glb"))) return TEXT("glb");
+	if (Mime.Contains(TEXT("obj"))) return TEXT("obj");
+	return TEXT("bin");
+}
+
 FString FMcpResultNormalizer::InferUsageFromMime(const FString& MimeType, const FString& FilePath)
 {
 	const FString Mime = NormalizeMimeType(MimeType);
@@ -157,33 +297,54 @@ bool FMcpResultNormalizer::SaveBase64ToStaging(
 	FString& OutLocalPath,
 	FString& OutError)
 {
-	FString Payload = Base64Data;
-	int32 CommaIndex = INDEX_NONE;
-	if (Payload.FindChar(TEXT(','), CommaIndex))
-	{
-		Payload = Payload.Mid(CommaIndex + 1);
-	}
-
-	TArray<uint8> Bytes;
-	if (!FBase64::Decode(Payload, Bytes) || Bytes.Num() == 0)
+	// Decode in place, past any data URI prefix ("data:image/png;base64,"); only the head of a
+	// payload that may run to hundreds of MB is searched for its comma.
+	const TCHAR* Chars = *Base64Data;
+	int32 NumChars = Base64Data.Len();
+	if (Base64Data.StartsWith(TEXT("data:"), ESearchCase::IgnoreCase))
 	{
-		OutError = TEXT("Failed to decode base64 MCP content");
-		return false;
+		const int32 MaxPrefixChars = 256;
+		int32 PrefixEnd = INDEX_NONE;
+		if (FStringView(Chars, FMath::Min(NumChars, MaxPrefixChars)).FindChar(TEXT(','), PrefixEnd))
+		{
+			Chars += PrefixEnd + 1;
+			NumChars -= PrefixEnd + 1;
+		}
 	}
 
 	const FString Mime = NormalizeMimeType(MimeType);
 	const FString Ext = ExtensionFromMime(Mime);
 	const FString Folder = GetStagingFolderForKind(KindHint);
 	IFileManager::Get().MakeDirectory(*Folder, true);
-	OutLocalPath = Folder / (FGuid::NewGuid().ToString() + TEXT(".") + Ext);
 
-	if (!FFileHelper::SaveArrayToFile(Bytes, *OutLocalPath))
+	const FString PartialPath = Folder / (TEXT(".inline-") + FGuid::NewGuid().ToString() + TEXT(".part"));
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*PartialPath));
+	if (!Writer)
 	{
-		OutError = FString::Printf(TEXT("Failed to write MCP staged file: %s"), *OutLocalPath);
+		OutError = FString::Printf(TEXT("Failed to write MCP staged file: %s"), *PartialPath);
 		return false;
 	}
 
-	return true;
+	int64 NumBytes = 0;
+	const bool bDecoded = DecodeBase64ToArchive(Chars, NumChars, *Writer, NumBytes);
+	const bool bWritten = Writer->Close();
+	Writer.Reset();
+
+	if (!bDecoded || NumBytes == 0)
+	{
+		IFileManager::Get().Delete(*PartialPath, false, true, true);
+		OutError = TEXT("Failed to decode base64 MCP content");
+		return false;
+	}
+	if (!bWritten)
+	{
+		IFileManager::Get().Delete(*PartialPath, false, true, true);
+		OutError = FString::Printf(TEXT("Failed to write MCP staged file: %s"), *PartialPath);
+		return false;
+	}
+
+	bool bDeduplicated = false;
+	return FUnrealGPTDownloadManager::StageFile(PartialPath, Folder, Ext, OutLocalPath, bDeduplicated, OutError);
 }
 
 bool FMcpResultNormalizer::DownloadUrlToStaging(
@@ -194,58 +355,20 @@ bool FMcpResultNormalizer::DownloadUrlToStaging(
 	FString& OutMimeType,
 	FString& OutError)
 {
-	TArray<uint8> Content;
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetVerb(TEXT("GET"));
-	for (const TPair<FString, FString>& Header : Headers)
-	{
-		Request->SetHeader(Header.Key, Header.Value);
-	}
-
-	bool bDone = false;
-	bool bOk = false;
-	Request->OnProcessRequestComplete().BindLambda(
-		[&](FHttpRequestPtr, FHttpResponsePtr Response, bool bConnected)
-		{
-			if (bConnected && Response.IsValid() && Response->GetResponseCode() >= 200 && Response->GetResponseCode() < 300)
-			{
-				Content = Response->GetContent();
-				OutMimeType = Response->GetContentType();
-				bOk = true;
-			}
-			else if (Response.IsValid())
-			{
-				OutError = FString::Printf(TEXT("Download failed HTTP %d"), Response->GetResponseCode());
-			}
-			else
-			{
-				OutError = TEXT("Download request failed");
-			}
-			bDone = true;
-		});
-	Request->ProcessRequest();
-	while (!bDone)
-	{
-		FPlatformProcess::Sleep(0.01f);
-	}
+	FUnrealGPTDownloadRequest Request;
+	Request.Url = Url;
+	Request.Headers = Headers;
+	Request.StagingFolder = GetStagingFolderForKind(KindHint);
 
-	if (!bOk || Content.Num() == 0)
+	TArray<FUnrealGPTDownloadResult> Results = FUnrealGPTDownloadManager::Get().DownloadAndWait({ MoveTemp(Request) });
+	if (Results.Num() != 1 || !Results[0].bSuccess)
 	{
+		OutError = Results.Num() == 1 ? Results[0].Error : TEXT("Download request failed");
 		return false;
 	}
 
-	const FString Ext = ExtensionFromMime(NormalizeMimeType(OutMimeType));
-	const FString Folder = GetStagingFolderForKind(KindHint);
-	IFileManager::Get().MakeDirectory(*Folder, true);
-	OutLocalPath = Folder / (FGuid::NewGuid().ToString() + TEXT(".") + Ext);
-
-	if (!FFileHelper::SaveArrayToFile(Content, *OutLocalPath))
-	{
-		OutError = TEXT("Failed to save downloaded MCP file");
-		return false;
-	}
-
+	OutLocalPath = Results[0].LocalPath;
+	OutMimeType = Results[0].MimeType;
 	return true;
 }
 
@@ -279,7 +402,11 @@ FString FMcpResultNormalizer::BuildToolCallEnvelope(
 		}
 	}
 
-	TMap<FString, FString> EmptyHeaders;
+	// URL outputs are downloaded together after the scan; Slots keeps every file in block order
+	TArray<TSharedPtr<FJsonObject>> Slots;
+	TArray<int32> DownloadSlots;
+	TArray<FString> DownloadMimeTypes;
+	TArray<FUnrealGPTDownloadRequest> DownloadRequests;
 	for (const TSharedPtr<FJsonObject>& Block : Blocks)
 	{
 		FString Type;
@@ -309,36 +436,62 @@ FString FMcpResultNormalizer::BuildToolCallEnvelope(
 
 			FString LocalPath;
 			FString Error;
+			// TryGetStringField copies the payload once; the decode below reads that copy in place
 			FString Base64Data;
 			if (Block->TryGetStringField(TEXT("data"), Base64Data) && !Base64Data.IsEmpty())
 			{
 				if (SaveBase64ToStaging(Base64Data, MimeType, KindHint, LocalPath, Error))
 				{
+					// The raw result embedded below points at the staged file instead of repeating the payload
+					const int64 NumBytes = IFileManager::Get().FileSize(*LocalPath);
+					Block->SetStringField(TEXT("data"), FString::Printf(TEXT("<%lld bytes staged at %s>"), NumBytes, *LocalPath));
+
 					TSharedPtr<FJsonObject> FileObj = MakeShared<FJsonObject>();
 					const FString NormalizedMime = NormalizeMimeType(MimeType.IsEmpty() ? FPaths::GetExtension(LocalPath) : MimeType);
 					FileObj->SetStringField(TEXT("local_path"), LocalPath);
 					FileObj->SetStringField(TEXT("mime_type"), NormalizedMime);
 					FileObj->SetStringField(TEXT("inferred_usage"), InferUsageFromMime(NormalizedMime, LocalPath));
-					FilesArray.Add(MakeShared<FJsonValueObject>(FileObj));
+					Slots.Add(FileObj);
 				}
 			}
 			else if (!Uri.IsEmpty() && (Uri.StartsWith(TEXT("http://")) || Uri.StartsWith(TEXT("https://"))))
 			{
-				FString DownloadedMime;
-				if (DownloadUrlToStaging(Uri, EmptyHeaders, KindHint, LocalPath, DownloadedMime, Error))
-				{
-					TSharedPtr<FJsonObject> FileObj = MakeShared<FJsonObject>();
-					const FString NormalizedMime = NormalizeMimeType(DownloadedMime.IsEmpty() ? MimeType : DownloadedMime);
-					FileObj->SetStringField(TEXT("local_path"), LocalPath);
-					FileObj->SetStringField(TEXT("mime_type"), NormalizedMime);
-					FileObj->SetStringField(TEXT("inferred_usage"), InferUsageFromMime(NormalizedMime, LocalPath));
-					FileObj->SetStringField(TEXT("source_uri"), Uri);
-					FilesArray.Add(MakeShared<FJsonValueObject>(FileObj));
-				}
+				FUnrealGPTDownloadRequest& Request = DownloadRequests.AddDefaulted_GetRef();
+				Request.Url = Uri;
+				Request.StagingFolder = GetStagingFolderForKind(KindHint);
+				DownloadSlots.Add(Slots.Add(nullptr));
+				DownloadMimeTypes.Add(MimeType);
 			}
 		}
 	}
 
+	const TArray<FUnrealGPTDownloadResult> Downloads = FUnrealGPTDownloadManager::Get().DownloadAndWait(MoveTemp(DownloadRequests));
+	for (int32 Index = 0; Index < Downloads.Num(); ++Index)
+	{
+		const FUnrealGPTDownloadResult& Download = Downloads[Index];
+		if (!Download.bSuccess)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: MCP output download failed for %s: %s"), *Download.Url, *Download.Error);
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> FileObj = MakeShared<FJsonObject>();
+		const FString NormalizedMime = NormalizeMimeType(Download.MimeType.IsEmpty() ? DownloadMimeTypes[Index] : Download.MimeType);
+		FileObj->SetStringField(TEXT("local_path"), Download.LocalPath);
+		FileObj->SetStringField(TEXT("mime_type"), NormalizedMime);
+		FileObj->SetStringField(TEXT("inferred_usage"), InferUsageFromMime(NormalizedMime, Download.LocalPath));
+		FileObj->SetStringField(TEXT("source_uri"), Download.Url);
+		Slots[DownloadSlots[Index]] = FileObj;
+	}
+
+	for (const TSharedPtr<FJsonObject>& FileObj : Slots)
+	{
+		if (FileObj.IsValid())
+		{
+			FilesArray.Add(MakeShared<FJsonValueObject>(FileObj));
+		}
+	}
+
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetStringField(TEXT("status"), TEXT("ok"));
 	ResultObj->SetStringField(
@@ -12,7 +12,12 @@ public:
 	static FString GetStagingFolderForKind(const FString& Kind);
 	static FString InferUsageFromMime(const FString& MimeType, const FString& FilePath);
 	static FString NormalizeMimeType(const FString& MimeOrExtension);
+	static FString ExtensionFromMime(const FString& Mime);
 
+	/**
+	 * Decode base64 (optionally a data URI) into the staging folder in fixed-size chunks, reading straight
+	 * from Base64Data. The file is named by its SHA-1 like downloaded outputs, so repeated content is reused.
+	 */
 	static bool SaveBase64ToStaging(
 		const FString& Base64Data,
 		const FString& MimeType,
@@ -20,6 +25,7 @@ public:
 		FString& OutLocalPath,
 		FString& OutError);
 
+	/** Blocking; large outputs should go through FUnrealGPTDownloadManager in a batch instead. */
 	static bool DownloadUrlToStaging(
 		const FString& Url,
 		const TMap<FString, FString>& Headers,
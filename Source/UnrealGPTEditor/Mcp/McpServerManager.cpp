@@ -21,23 +21,34 @@ FMcpServerConnection::FMcpServerConnection(const FMcpServerConfig& InConfig)
 	Status.ServerName = Config.Name;
 }
 
+FMcpServerConnection::~FMcpServerConnection()
+{
+	Disconnect();
+}
+
 bool FMcpServerConnection::Connect(float TimeoutSeconds, FString& OutError)
 {
+	FScopeLock ConnectScope(&ConnectLock);
 	Disconnect();
 
-	Session = MakeUnique<FMcpJsonRpcSession>(CreateTransport(Config));
-	if (!Session->ConnectAndInitialize(TimeoutSeconds, OutError))
+	// The handshake runs without StateLock so status reads are not held up by a slow server.
+	const TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> NewSession = MakeShared<FMcpJsonRpcSession, ESPMode::ThreadSafe>(CreateTransport(Config));
+	if (!NewSession->ConnectAndInitialize(TimeoutSeconds, OutError))
 	{
+		FScopeLock Lock(&StateLock);
 		Status.bConnected = false;
 		Status.bInitialized = false;
 		Status.LastError = OutError;
-		Session.Reset();
 		return false;
 	}
 
-	Status.bConnected = true;
-	Status.bInitialized = true;
-	Status.LastError.Empty();
+	{
+		FScopeLock Lock(&StateLock);
+		Session = NewSession;
+		Status.bConnected = true;
+		Status.bInitialized = true;
+		Status.LastError.Empty();
+	}
 
 	if (!RefreshCapabilities(TimeoutSeconds, OutError))
 	{
@@ -47,47 +58,75 @@ bool FMcpServerConnection::Connect(float TimeoutSeconds, FString& OutError)
 	return true;
 }
 
+bool FMcpServerConnection::EnsureConnected(float TimeoutSeconds, FString& OutError)
+{
+	FScopeLock ConnectScope(&ConnectLock);
+	return IsConnected() || Connect(TimeoutSeconds, OutError);
+}
+
 void FMcpServerConnection::Disconnect()
 {
-	if (Session.IsValid())
+	TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> OldSession;
+	{
+		FScopeLock Lock(&StateLock);
+		OldSession = MoveTemp(Session);
+		Status.bConnected = false;
+		Status.bInitialized = false;
+	}
+
+	if (OldSession.IsValid())
 	{
-		Session->Disconnect();
-		Session.Reset();
+		OldSession->Disconnect();
 	}
-	Status.bConnected = false;
-	Status.bInitialized = false;
 }
 
 bool FMcpServerConnection::IsConnected() const
 {
-	return Session.IsValid() && Session->IsInitialized();
+	const TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> ActiveSession = GetSession();
+	return ActiveSession.IsValid() && ActiveSession->IsInitialized();
+}
+
+FMcpServerStatus FMcpServerConnection::GetStatus() const
+{
+	FScopeLock Lock(&StateLock);
+	return Status;
+}
+
+TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> FMcpServerConnection::GetSession() const
+{
+	FScopeLock Lock(&StateLock);
+	return Session;
 }
 
 bool FMcpServerConnection::RefreshCapabilities(float TimeoutSeconds, FString& OutError)
 {
-	if (!Session.IsValid())
+	const TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> ActiveSession = GetSession();
+	if (!ActiveSession.IsValid())
 	{
 		OutError = TEXT("MCP session is not active");
 		return false;
 	}
 
 	TSharedPtr<FJsonObject> ToolsResult;
-	if (Session->SendRequest(TEXT("tools/list"), MakeShared<FJsonObject>(), TimeoutSeconds, ToolsResult, OutError))
+	if (ActiveSession->SendRequest(TEXT("tools/list"), MakeShared<FJsonObject>(), TimeoutSeconds, ToolsResult, OutError))
 	{
+		FScopeLock Lock(&StateLock);
 		ParseToolsList(ToolsResult);
 	}
 
 	TSharedPtr<FJsonObject> ResourcesResult;
 	FString ResourceError;
-	if (Session->SendRequest(TEXT("resources/list"), MakeShared<FJsonObject>(), TimeoutSeconds, ResourcesResult, ResourceError))
+	if (ActiveSession->SendRequest(TEXT("resources/list"), MakeShared<FJsonObject>(), TimeoutSeconds, ResourcesResult, ResourceError))
 	{
+		FScopeLock Lock(&StateLock);
 		ParseResourcesList(ResourcesResult);
 	}
 
 	TSharedPtr<FJsonObject> PromptsResult;
 	FString PromptError;
-	if (Session->SendRequest(TEXT("prompts/list"), MakeShared<FJsonObject>(), TimeoutSeconds, PromptsResult, PromptError))
+	if (ActiveSession->SendRequest(TEXT("prompts/list"), MakeShared<FJsonObject>(), TimeoutSeconds, PromptsResult, PromptError))
 	{
+		FScopeLock Lock(&StateLock);
 		ParsePromptsList(PromptsResult);
 	}
 
@@ -101,7 +140,8 @@ bool FMcpServerConnection::CallTool(
 	TSharedPtr<FJsonObject>& OutResult,
 	FString& OutError)
 {
-	if (!Session.IsValid())
+	const TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> ActiveSession = GetSession();
+	if (!ActiveSession.IsValid())
 	{
 		OutError = TEXT("MCP session is not active");
 		return false;
@@ -110,7 +150,7 @@ bool FMcpServerConnection::CallTool(
 	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
 	Params->SetStringField(TEXT("name"), ToolName);
 	Params->SetObjectField(TEXT("arguments"), Arguments.IsValid() ? Arguments : MakeShared<FJsonObject>());
-	return Session->SendRequest(TEXT("tools/call"), Params, TimeoutSeconds, OutResult, OutError);
+	return ActiveSession->SendRequest(TEXT("tools/call"), Params, TimeoutSeconds, OutResult, OutError);
 }
 
 bool FMcpServerConnection::ReadResource(
@@ -119,7 +159,8 @@ bool FMcpServerConnection::ReadResource(
 	TSharedPtr<FJsonObject>& OutResult,
 	FString& OutError)
 {
-	if (!Session.IsValid())
+	const TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> ActiveSession = GetSession();
+	if (!ActiveSession.IsValid())
 	{
 		OutError = TEXT("MCP session is not active");
 		return false;
@@ -127,7 +168,7 @@ bool FMcpServerConnection::ReadResource(
 
 	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
 	Params->SetStringField(TEXT("uri"), Uri);
-	return Session->SendRequest(TEXT("resources/read"), Params, TimeoutSeconds, OutResult, OutError);
+	return ActiveSession->SendRequest(TEXT("resources/read"), Params, TimeoutSeconds, OutResult, OutError);
 }
 
 bool FMcpServerConnection::GetPrompt(
@@ -137,7 +178,8 @@ bool FMcpServerConnection::GetPrompt(
 	TSharedPtr<FJsonObject>& OutResult,
 	FString& OutError)
 {
-	if (!Session.IsValid())
+	const TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> ActiveSession = GetSession();
+	if (!ActiveSession.IsValid())
 	{
 		OutError = TEXT("MCP session is not active");
 		return false;
@@ -149,7 +191,7 @@ bool FMcpServerConnection::GetPrompt(
 	{
 		Params->SetObjectField(TEXT("arguments"), Arguments);
 	}
-	return Session->SendRequest(TEXT("prompts/get"), Params, TimeoutSeconds, OutResult, OutError);
+	return ActiveSession->SendRequest(TEXT("prompts/get"), Params, TimeoutSeconds, OutResult, OutError);
 }
 
 bool FMcpServerConnection::ParseToolsList(const TSharedPtr<FJsonObject>& Result)
@@ -252,14 +294,14 @@ bool FMcpServerConnection::ParsePromptsList(const TSharedPtr<FJsonObject>& Resul
 	return true;
 }
 
-void FMcpServerManager::ReloadFromSettings()
+TArray<FMcpServerConnectionPtr> FMcpServerManager::ConnectFromSettings()
 {
-	DisconnectAll();
+	TArray<FMcpServerConnectionPtr> NewConnections;
 
 	const UUnrealGPTSettings* Settings = GetDefault<UUnrealGPTSettings>();
 	if (!Settings || !Settings->bEnableMcpTool)
 	{
-		return;
+		return NewConnections;
 	}
 
 	for (const FMcpServerConfig& ServerConfig : Settings->McpServers)
@@ -269,7 +311,7 @@ void FMcpServerManager::ReloadFromSettings()
 			continue;
 		}
 
-		TUniquePtr<FMcpServerConnection> Connection = MakeUnique<FMcpServerConnection>(ServerConfig);
+		FMcpServerConnectionPtr Connection = MakeShared<FMcpServerConnection, ESPMode::ThreadSafe>(ServerConfig);
 		FString Error;
 		if (!Connection->Connect(Settings->ExecutionTimeoutSeconds, Error))
 		{
@@ -281,19 +323,20 @@ void FMcpServerManager::ReloadFromSettings()
 				*ServerConfig.Name, Connection->GetStatus().Tools.Num());
 		}
 
-		Connections.Add(MoveTemp(Connection));
+		NewConnections.Add(MoveTemp(Connection));
 	}
+
+	return NewConnections;
+}
+
+void FMcpServerManager::SetConnections(TArray<FMcpServerConnectionPtr> InConnections)
+{
+	// Replaced servers disconnect when their last in-flight request lets go of them.
+	Connections = MoveTemp(InConnections);
 }
 
 void FMcpServerManager::DisconnectAll()
 {
-	for (TUniquePtr<FMcpServerConnection>& Connection : Connections)
-	{
-		if (Connection.IsValid())
-		{
-			Connection->Disconnect();
-		}
-	}
 	Connections.Reset();
 }
 
@@ -305,7 +348,7 @@ bool FMcpServerManager::HasEnabledServers() const
 int32 FMcpServerManager::GetConnectedCount() const
 {
 	int32 Count = 0;
-	for (const TUniquePtr<FMcpServerConnection>& Connection : Connections)
+	for (const FMcpServerConnectionPtr& Connection : Connections)
 	{
 		if (Connection.IsValid() && Connection->IsConnected())
 		{
@@ -318,7 +361,7 @@ int32 FMcpServerManager::GetConnectedCount() const
 TArray<FMcpServerStatus> FMcpServerManager::GetStatuses() const
 {
 	TArray<FMcpServerStatus> Statuses;
-	for (const TUniquePtr<FMcpServerConnection>& Connection : Connections)
+	for (const FMcpServerConnectionPtr& Connection : Connections)
 	{
 		if (Connection.IsValid())
 		{
@@ -328,46 +371,14 @@ TArray<FMcpServerStatus> FMcpServerManager::GetStatuses() const
 	return Statuses;
 }
 
-FMcpServerConnection* FMcpServerManager::FindServer(const FString& ServerName)
+FMcpServerConnectionPtr FMcpServerManager::FindServer(const FString& ServerName) const
 {
-	for (TUniquePtr<FMcpServerConnection>& Connection : Connections)
+	for (const FMcpServerConnectionPtr& Connection : Connections)
 	{
 		if (Connection.IsValid() && Connection->GetConfig().Name.Equals(ServerName, ESearchCase::IgnoreCase))
 		{
-			return Connection.Get();
+			return Connection;
 		}
 	}
 	return nullptr;
 }
-
-const FMcpServerConnection* FMcpServerManager::FindServer(const FString& ServerName) const
-{
-	for (const TUniquePtr<FMcpServerConnection>& Connection : Connections)
-	{
-		if (Connection.IsValid() && Connection->GetConfig().Name.Equals(ServerName, ESearchCase::IgnoreCase))
-		{
-			return Connection.Get();
-		}
-	}
-	return nullptr;
-}
-
-bool FMcpServerManager::EnsureConnected(const FString& ServerName, float TimeoutSeconds, FString& OutError)
-{
-	FMcpServerConnection* Connection = FindServer(ServerName);
-	if (!Connection)
-	{
-		OutError = FString::Printf(TEXT("MCP server '%s' is not configured or enabled"), *ServerName);
-		return false;
-	}
-
-	if (!Connection->IsConnected())
-	{
-		if (!Connection->Connect(TimeoutSeconds, OutError))
-		{
-			return false;
-		}
-	}
-
-	return true;
-}
@@ -6,17 +6,24 @@
 #include "McpJsonRpcSession.h"
 #include "McpTypes.h"
 
+/**
+ * One configured MCP server. Requests run on the caller's thread and are serialized by the session;
+ * StateLock only guards the session pointer and Status, so status reads never wait on a request.
+ */
 class FMcpServerConnection
 {
 public:
 	explicit FMcpServerConnection(const FMcpServerConfig& InConfig);
+	~FMcpServerConnection();
 
 	bool Connect(float TimeoutSeconds, FString& OutError);
+	/** Connect unless already connected; concurrent callers wait for one attempt. */
+	bool EnsureConnected(float TimeoutSeconds, FString& OutError);
 	void Disconnect();
 	bool IsConnected() const;
 
 	const FMcpServerConfig& GetConfig() const { return Config; }
-	const FMcpServerStatus& GetStatus() const { return Status; }
+	FMcpServerStatus GetStatus() const;
 
 	bool RefreshCapabilities(float TimeoutSeconds, FString& OutError);
 	bool CallTool(
@@ -39,30 +46,40 @@ public:
 
 private:
 	static TUniquePtr<IMcpTransport> CreateTransport(const FMcpServerConfig& Config);
+	TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> GetSession() const;
 	bool ParseToolsList(const TSharedPtr<FJsonObject>& Result);
 	bool ParseResourcesList(const TSharedPtr<FJsonObject>& Result);
 	bool ParsePromptsList(const TSharedPtr<FJsonObject>& Result);
 
 	FMcpServerConfig Config;
 	FMcpServerStatus Status;
-	TUniquePtr<FMcpJsonRpcSession> Session;
+	TSharedPtr<FMcpJsonRpcSession, ESPMode::ThreadSafe> Session;
+	mutable FCriticalSection StateLock;
+	FCriticalSection ConnectLock;
 };
 
+using FMcpServerConnectionPtr = TSharedPtr<FMcpServerConnection, ESPMode::ThreadSafe>;
+
+/**
+ * The configured server set. Not locked itself; the owner guards it and only holds that lock to read or
+ * swap the list. Connections are shared so a request keeps its server alive across a reload.
+ */
 class FMcpServerManager
 {
 public:
-	void ReloadFromSettings();
+	/** Create and connect every enabled server from settings. Blocking; touches no manager state. */
+	static TArray<FMcpServerConnectionPtr> ConnectFromSettings();
+
+	void SetConnections(TArray<FMcpServerConnectionPtr> InConnections);
 	void DisconnectAll();
 
 	bool HasEnabledServers() const;
 	int32 GetConnectedCount() const;
+	int32 GetServerCount() const { return Connections.Num(); }
 	TArray<FMcpServerStatus> GetStatuses() const;
 
-	FMcpServerConnection* FindServer(const FString& ServerName);
-	const FMcpServerConnection* FindServer(const FString& ServerName) const;
-
-	bool EnsureConnected(const FString& ServerName, float TimeoutSeconds, FString& OutError);
+	FMcpServerConnectionPtr FindServer(const FString& ServerName) const;
 
 private:
-	TArray<TUniquePtr<FMcpServerConnection>> Connections;
+	TArray<FMcpServerConnectionPtr> Connections;
 };
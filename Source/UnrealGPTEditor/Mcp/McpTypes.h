@@ -99,3 +99,12 @@ struct FMcpServerStatus
 	TArray<FMcpResourceInfo> Resources;
 	TArray<FMcpPromptInfo> Prompts;
 };
+
+/** Summary of the server set, published whenever it changes; cheap to copy. */
+struct FMcpStatusSnapshot
+{
+	int32 ConnectedCount = 0;
+	int32 TotalCount = 0;
+	/** Incremented on every published change. */
+	uint32 Generation = 0;
+};
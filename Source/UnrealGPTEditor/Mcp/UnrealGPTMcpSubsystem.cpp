@@ -3,6 +3,8 @@
 #include "UnrealGPTMcpSubsystem.h"
 
 #include "McpResultNormalizer.h"
+#include "Async/Async.h"
+#include "Misc/ScopeExit.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -12,19 +14,136 @@ void UUnrealGPTMcpSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 	ReloadServers();
+
+	StatusTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UUnrealGPTMcpSubsystem::TickStatus), StatusPollInterval);
 }
 
 void UUnrealGPTMcpSubsystem::Deinitialize()
 {
-	FScopeLock Lock(&ManagerLock);
-	ServerManager.DisconnectAll();
+	FTSTicker::GetCoreTicker().RemoveTicker(StatusTickerHandle);
+	StatusTickerHandle.Reset();
+	if (StatusRecount.IsValid())
+	{
+		StatusRecount.Wait();
+	}
+
+	{
+		FScopeLock Lock(&ManagerLock);
+		ServerManager.DisconnectAll();
+	}
+	PublishStatusIfChanged();
 	Super::Deinitialize();
 }
 
 void UUnrealGPTMcpSubsystem::ReloadServers()
+{
+	TArray<FMcpServerConnectionPtr> Connections = FMcpServerManager::ConnectFromSettings();
+	{
+		FScopeLock Lock(&ManagerLock);
+		ServerManager.SetConnections(MoveTemp(Connections));
+	}
+	PublishStatusIfChanged();
+}
+
+int32 UUnrealGPTMcpSubsystem::GetConnectedServerCount() const
+{
+	FScopeLock Lock(&ManagerLock);
+	return ServerManager.GetConnectedCount();
+}
+
+TArray<FMcpServerStatus> UUnrealGPTMcpSubsystem::GetServerStatuses() const
+{
+	FScopeLock Lock(&ManagerLock);
+	return ServerManager.GetStatuses();
+}
+
+bool UUnrealGPTMcpSubsystem::HasEnabledServers() const
 {
 	FScopeLock Lock(&ManagerLock);
-	ServerManager.ReloadFromSettings();
+	return ServerManager.HasEnabledServers();
+}
+
+FMcpStatusSnapshot UUnrealGPTMcpSubsystem::GetStatusSnapshot() const
+{
+	FScopeLock Lock(&SnapshotLock);
+	return StatusSnapshot;
+}
+
+void UUnrealGPTMcpSubsystem::PublishStatusIfChanged() const
+{
+	int32 Connected = 0;
+	int32 Total = 0;
+	{
+		FScopeLock Lock(&ManagerLock);
+		Connected = ServerManager.GetConnectedCount();
+		Total = ServerManager.GetServerCount();
+	}
+	PublishStatus(Connected, Total);
+}
+
+void UUnrealGPTMcpSubsystem::PublishStatus(int32 ConnectedCount, int32 TotalCount) const
+{
+	FMcpStatusSnapshot Snapshot;
+	{
+		FScopeLock Lock(&SnapshotLock);
+		if (StatusSnapshot.ConnectedCount == ConnectedCount && StatusSnapshot.TotalCount == TotalCount)
+		{
+			return;
+		}
+		StatusSnapshot.ConnectedCount = ConnectedCount;
+		StatusSnapshot.TotalCount = TotalCount;
+		++StatusSnapshot.Generation;
+		Snapshot = StatusSnapshot;
+	}
+
+	if (IsInGameThread())
+	{
+		StatusChanged.Broadcast(Snapshot);
+		return;
+	}
+
+	TWeakObjectPtr<const UUnrealGPTMcpSubsystem> WeakThis(this);
+	AsyncTask(ENamedThreads::GameThread, [WeakThis, Snapshot]()
+	{
+		if (const UUnrealGPTMcpSubsystem* Subsystem = WeakThis.Get())
+		{
+			Subsystem->StatusChanged.Broadcast(Snapshot);
+		}
+	});
+}
+
+bool UUnrealGPTMcpSubsystem::TickStatus(float DeltaTime)
+{
+	// Deinitialize waits for the recount, so capturing this is safe.
+	if (!StatusRecount.IsValid() || StatusRecount.IsReady())
+	{
+		StatusRecount = Async(EAsyncExecution::ThreadPool, [this]()
+		{
+			PublishStatusIfChanged();
+		});
+	}
+	return true;
+}
+
+FMcpServerConnectionPtr UUnrealGPTMcpSubsystem::AcquireConnection(const FString& ServerName, FString& OutError) const
+{
+	FMcpServerConnectionPtr Connection;
+	{
+		FScopeLock Lock(&ManagerLock);
+		Connection = ServerManager.FindServer(ServerName);
+	}
+
+	if (!Connection.IsValid())
+	{
+		OutError = FString::Printf(TEXT("MCP server '%s' is not configured or enabled"), *ServerName);
+		return nullptr;
+	}
+	if (!Connection->EnsureConnected(GetTimeoutSeconds(), OutError))
+	{
+		return nullptr;
+	}
+	return Connection;
 }
 
 float UUnrealGPTMcpSubsystem::GetTimeoutSeconds() const
@@ -35,8 +154,6 @@ float UUnrealGPTMcpSubsystem::GetTimeoutSeconds() const
 
 FString UUnrealGPTMcpSubsystem::ExecuteMcpListTools(const FString& ArgumentsJson) const
 {
-	FScopeLock Lock(&ManagerLock);
-
 	TSharedPtr<FJsonObject> ArgsObj;
 	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
 	if (!ArgumentsJson.IsEmpty() && !(FJsonSerializer::Deserialize(Reader, ArgsObj) && ArgsObj.IsValid()))
@@ -51,7 +168,7 @@ FString UUnrealGPTMcpSubsystem::ExecuteMcpListTools(const FString& ArgumentsJson
 	}
 
 	TArray<TSharedPtr<FJsonValue>> ServersArray;
-	for (const FMcpServerStatus& Status : ServerManager.GetStatuses())
+	for (const FMcpServerStatus& Status : GetServerStatuses())
 	{
 		if (!ServerFilter.IsEmpty() && !Status.ServerName.Equals(ServerFilter, ESearchCase::IgnoreCase))
 		{
@@ -90,7 +207,8 @@ FString UUnrealGPTMcpSubsystem::ExecuteMcpListTools(const FString& ArgumentsJson
 
 FString UUnrealGPTMcpSubsystem::ExecuteMcpCall(const FString& ArgumentsJson) const
 {
-	FScopeLock Lock(&ManagerLock);
+	// The call may have connected or lost a server.
+	ON_SCOPE_EXIT { PublishStatusIfChanged(); };
 
 	TSharedPtr<FJsonObject> ArgsObj;
 	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
@@ -121,17 +239,12 @@ FString UUnrealGPTMcpSubsystem::ExecuteMcpCall(const FString& ArgumentsJson) con
 	ArgsObj->TryGetStringField(TEXT("output_kind"), KindHint);
 
 	FString Error;
-	if (!const_cast<FMcpServerManager&>(ServerManager).EnsureConnected(ServerName, GetTimeoutSeconds(), Error))
+	const FMcpServerConnectionPtr Connection = AcquireConnection(ServerName, Error);
+	if (!Connection.IsValid())
 	{
 		return FString::Printf(TEXT("{\"status\":\"error\",\"message\":\"%s\"}"), *Error);
 	}
 
-	FMcpServerConnection* Connection = const_cast<FMcpServerManager&>(ServerManager).FindServer(ServerName);
-	if (!Connection)
-	{
-		return TEXT("{\"status\":\"error\",\"message\":\"MCP server not found\"}");
-	}
-
 	TSharedPtr<FJsonObject> McpResult;
 	if (!Connection->CallTool(ToolName, ToolArgs, GetTimeoutSeconds(), McpResult, Error))
 	{
@@ -143,7 +256,8 @@ FString UUnrealGPTMcpSubsystem::ExecuteMcpCall(const FString& ArgumentsJson) con
 
 FString UUnrealGPTMcpSubsystem::ExecuteMcpReadResource(const FString& ArgumentsJson) const
 {
-	FScopeLock Lock(&ManagerLock);
+	// The call may have connected or lost a server.
+	ON_SCOPE_EXIT { PublishStatusIfChanged(); };
 
 	TSharedPtr<FJsonObject> ArgsObj;
 	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
@@ -164,17 +278,12 @@ FString UUnrealGPTMcpSubsystem::ExecuteMcpReadResource(const FString& ArgumentsJ
 	}
 
 	FString Error;
-	if (!const_cast<FMcpServerManager&>(ServerManager).EnsureConnected(ServerName, GetTimeoutSeconds(), Error))
+	const FMcpServerConnectionPtr Connection = AcquireConnection(ServerName, Error);
+	if (!Connection.IsValid())
 	{
 		return FString::Printf(TEXT("{\"status\":\"error\",\"message\":\"%s\"}"), *Error);
 	}
 
-	FMcpServerConnection* Connection = const_cast<FMcpServerManager&>(ServerManager).FindServer(ServerName);
-	if (!Connection)
-	{
-		return TEXT("{\"status\":\"error\",\"message\":\"MCP server not found\"}");
-	}
-
 	TSharedPtr<FJsonObject> McpResult;
 	if (!Connection->ReadResource(Uri, GetTimeoutSeconds(), McpResult, Error))
 	{
@@ -186,7 +295,8 @@ FString UUnrealGPTMcpSubsystem::ExecuteMcpReadResource(const FString& ArgumentsJ
 
 FString UUnrealGPTMcpSubsystem::ExecuteMcpGetPrompt(const FString& ArgumentsJson) const
 {
-	FScopeLock Lock(&ManagerLock);
+	// The call may have connected or lost a server.
+	ON_SCOPE_EXIT { PublishStatusIfChanged(); };
 
 	TSharedPtr<FJsonObject> ArgsObj;
 	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
@@ -214,17 +324,12 @@ FString UUnrealGPTMcpSubsystem::ExecuteMcpGetPrompt(const FString& ArgumentsJson
 	}
 
 	FString Error;
-	if (!const_cast<FMcpServerManager&>(ServerManager).EnsureConnected(ServerName, GetTimeoutSeconds(), Error))
+	const FMcpServerConnectionPtr Connection = AcquireConnection(ServerName, Error);
+	if (!Connection.IsValid())
 	{
 		return FString::Printf(TEXT("{\"status\":\"error\",\"message\":\"%s\"}"), *Error);
 	}
 
-	FMcpServerConnection* Connection = const_cast<FMcpServerManager&>(ServerManager).FindServer(ServerName);
-	if (!Connection)
-	{
-		return TEXT("{\"status\":\"error\",\"message\":\"MCP server not found\"}");
-	}
-
 	TSharedPtr<FJsonObject> McpResult;
 	if (!Connection->GetPrompt(PromptName, PromptArgs, GetTimeoutSeconds(), McpResult, Error))
 	{
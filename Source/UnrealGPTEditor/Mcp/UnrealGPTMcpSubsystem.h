@@ -5,8 +5,12 @@
 #include "CoreMinimal.h"
 #include "EditorSubsystem.h"
 #include "McpServerManager.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
 #include "UnrealGPTMcpSubsystem.generated.h"
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMcpStatusChanged, const FMcpStatusSnapshot&);
+
 UCLASS()
 class UNREALGPTEDITOR_API UUnrealGPTMcpSubsystem : public UEditorSubsystem
 {
@@ -16,13 +20,18 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	/** Reconnect from settings. Servers connect before ManagerLock is taken to swap them in. */
 	void ReloadServers();
-	FMcpServerManager& GetManager() { return ServerManager; }
-	const FMcpServerManager& GetManager() const { return ServerManager; }
 
-	int32 GetConnectedServerCount() const { return ServerManager.GetConnectedCount(); }
-	TArray<FMcpServerStatus> GetServerStatuses() const { return ServerManager.GetStatuses(); }
-	bool HasEnabledServers() const { return ServerManager.HasEnabledServers(); }
+	int32 GetConnectedServerCount() const;
+	TArray<FMcpServerStatus> GetServerStatuses() const;
+	bool HasEnabledServers() const;
+
+	/** Last published connected/total counts; does not touch the server list. */
+	FMcpStatusSnapshot GetStatusSnapshot() const;
+
+	/** Broadcast on the game thread when the connected or total server count changes. */
+	FOnMcpStatusChanged& OnStatusChanged() { return StatusChanged; }
 
 	FString ExecuteMcpListTools(const FString& ArgumentsJson) const;
 	FString ExecuteMcpCall(const FString& ArgumentsJson) const;
@@ -30,8 +39,28 @@ public:
 	FString ExecuteMcpGetPrompt(const FString& ArgumentsJson) const;
 
 private:
+	/** Seconds between checks for sessions that dropped without a call going through the subsystem. */
+	static constexpr float StatusPollInterval = 2.0f;
+
 	float GetTimeoutSeconds() const;
 
+	/** Find ServerName under ManagerLock, then connect it if needed with the lock released. */
+	FMcpServerConnectionPtr AcquireConnection(const FString& ServerName, FString& OutError) const;
+
+	/** Recount servers and publish a new snapshot if the counts changed. Call without holding ManagerLock. */
+	void PublishStatusIfChanged() const;
+	void PublishStatus(int32 ConnectedCount, int32 TotalCount) const;
+
+	/** Starts a recount on the thread pool; the game thread never takes ManagerLock here. */
+	bool TickStatus(float DeltaTime);
+
+	/** Only held to read or swap the server list; requests run on connections copied out of it. */
 	mutable FCriticalSection ManagerLock;
 	FMcpServerManager ServerManager;
+	TFuture<void> StatusRecount;
+
+	mutable FCriticalSection SnapshotLock;
+	mutable FMcpStatusSnapshot StatusSnapshot;
+	FOnMcpStatusChanged StatusChanged;
+	FTSTicker::FDelegateHandle StatusTickerHandle;
 };
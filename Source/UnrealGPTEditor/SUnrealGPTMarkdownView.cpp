@@ -0,0 +1,179 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "SUnrealGPTMarkdownView.h"
+#include "UnrealGPTWidget.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SSpacer.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+#include "Styling/AppStyle.h"
+#include "Styling/CoreStyle.h"
+#include "Styling/StyleColors.h"
+
+void SUnrealGPTMarkdownView::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SAssignNew(Container, SVerticalBox)
+	];
+
+	SetText(InArgs._Text);
+}
+
+void SUnrealGPTMarkdownView::SetText(const FString& Text)
+{
+	Document.SetText(Text);
+	SyncWidgets();
+}
+
+void SUnrealGPTMarkdownView::AppendText(const FString& Delta)
+{
+	Document.Append(Delta);
+	SyncWidgets();
+}
+
+void SUnrealGPTMarkdownView::SyncWidgets()
+{
+	const TArray<FUnrealGPTMarkdownBlock>& Blocks = Document.GetBlocks();
+	const int32 FirstChanged = FMath::Min(Document.GetFirstChangedBlock(), Rendered.Num());
+
+	// Everything before FirstChanged is untouched. A virtualized code block at FirstChanged is still
+	// being streamed into, so it is updated in place; every other changed block is rebuilt.
+	int32 KeepCount = FirstChanged;
+	if (Rendered.IsValidIndex(FirstChanged) && Rendered[FirstChanged].Code.IsValid()
+		&& Blocks.IsValidIndex(FirstChanged) && Blocks[FirstChanged].Type == EUnrealGPTMarkdownBlockType::Code)
+	{
+		SyncCodeLines(*Rendered[FirstChanged].Code, Blocks[FirstChanged]);
+		++KeepCount;
+	}
+
+	for (int32 Index = Rendered.Num() - 1; Index >= KeepCount; --Index)
+	{
+		Container->RemoveSlot(Rendered[Index].Widget.ToSharedRef());
+	}
+	Rendered.SetNum(KeepCount);
+
+	for (int32 Index = KeepCount; Index < Blocks.Num(); ++Index)
+	{
+		FRenderedBlock Block = BuildBlock(Blocks[Index]);
+		Container->AddSlot()
+			.AutoHeight()
+			[
+				Block.Widget.ToSharedRef()
+			];
+		Rendered.Add(MoveTemp(Block));
+	}
+
+	Document.ClearChanges();
+}
+
+SUnrealGPTMarkdownView::FRenderedBlock SUnrealGPTMarkdownView::BuildBlock(const FUnrealGPTMarkdownBlock& Block) const
+{
+	FRenderedBlock Result;
+	const FString Text = Block.Lines.Num() > 0 ? Block.Lines[0] : FString();
+
+	switch (Block.Type)
+	{
+	case EUnrealGPTMarkdownBlockType::Blank:
+		Result.Widget = SNew(SSpacer).Size(FVector2D(1.0f, 4.0f));
+		break;
+
+	case EUnrealGPTMarkdownBlockType::Heading:
+		Result.Widget =
+			SNew(SBox)
+			.Padding(Block.HeadingLevel == 1 ? FMargin(0.0f, 8.0f, 0.0f, 4.0f) : FMargin(0.0f, 6.0f, 0.0f, 2.0f))
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Text))
+				.AutoWrapText(true)
+				.Font(UnrealGPTAgentUI::BodyBoldFont())
+				.ColorAndOpacity(FStyleColors::Foreground)
+			];
+		break;
+
+	case EUnrealGPTMarkdownBlockType::Bullet:
+		Result.Widget =
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Top)
+			.Padding(0.0f, 0.0f, 6.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(TEXT("\u2022"))) // Bullet character
+				.Font(UnrealGPTAgentUI::BodyFont())
+				.ColorAndOpacity(FStyleColors::Foreground)
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Top)
+			[
+				UnrealGPTAgentUI::CreateInlineMarkdownTextWidget(Text)
+			];
+		break;
+
+	case EUnrealGPTMarkdownBlockType::Code:
+		if (Block.Lines.Num() > VirtualizedCodeLines)
+		{
+			Result.Code = MakeShared<FCodeView>();
+			SyncCodeLines(*Result.Code, Block);
+			Result.Widget =
+				SNew(SBox)
+				.MaxDesiredHeight(MaxCodeListHeight)
+				[
+					SAssignNew(Result.Code->ListView, SListView<TSharedPtr<FString>>)
+					.ListItemsSource(&Result.Code->Lines)
+					.OnGenerateRow_Static(&SUnrealGPTMarkdownView::OnGenerateCodeRow)
+					.SelectionMode(ESelectionMode::None)
+				];
+		}
+		else
+		{
+			// Short blocks stay a single text block: monospace, no wrapping
+			Result.Widget =
+				SNew(STextBlock)
+				.Text(FText::FromString(FString::Join(Block.Lines, TEXT("\n"))))
+				.AutoWrapText(false)
+				.Font(FCoreStyle::GetDefaultFontStyle("Mono", 9))
+				.ColorAndOpacity(FStyleColors::Foreground);
+		}
+		break;
+
+	default:
+		// Paragraph line (supports inline **bold** spans)
+		Result.Widget = UnrealGPTAgentUI::CreateInlineMarkdownTextWidget(Text);
+		break;
+	}
+
+	return Result;
+}
+
+void SUnrealGPTMarkdownView::SyncCodeLines(FCodeView& Code, const FUnrealGPTMarkdownBlock& Block)
+{
+	// Earlier lines are final; only the last shared line may have been a partial streamed line.
+	const int32 KeepCount = FMath::Max(0, FMath::Min(Code.Lines.Num(), Block.Lines.Num()) - 1);
+	Code.Lines.SetNum(KeepCount);
+	for (int32 Index = KeepCount; Index < Block.Lines.Num(); ++Index)
+	{
+		Code.Lines.Add(MakeShared<FString>(Block.Lines[Index]));
+	}
+
+	if (Code.ListView.IsValid())
+	{
+		Code.ListView->RequestListRefresh();
+	}
+}
+
+TSharedRef<ITableRow> SUnrealGPTMarkdownView::OnGenerateCodeRow(TSharedPtr<FString> Line, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FString>>, OwnerTable)
+		.Style(&FAppStyle::Get().GetWidgetStyle<FTableRowStyle>("TableView.NoHoverTableRow"))
+		.ShowSelection(false)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(Line.IsValid() ? *Line : FString()))
+			.Font(FCoreStyle::GetDefaultFontStyle("Mono", 9))
+			.ColorAndOpacity(FStyleColors::Foreground)
+		];
+}
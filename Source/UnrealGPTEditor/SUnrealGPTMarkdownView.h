@@ -0,0 +1,62 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/Views/SListView.h"
+#include "UnrealGPTMarkdown.h"
+
+class SVerticalBox;
+class ITableRow;
+class STableViewBase;
+
+/**
+ * Chat markdown renderer backed by FUnrealGPTMarkdownDocument. Appending text only rebuilds the widgets of
+ * blocks that changed; an open code block keeps its widget and grows in place. Code blocks longer than
+ * VirtualizedCodeLines render through a height-capped list view so only visible lines exist as widgets.
+ * SUnrealGPTWidget feeds streamed assistant text through AppendText.
+ */
+class SUnrealGPTMarkdownView : public SCompoundWidget
+{
+public:
+	static constexpr int32 VirtualizedCodeLines = 40;
+	static constexpr float MaxCodeListHeight = 400.f;
+
+	SLATE_BEGIN_ARGS(SUnrealGPTMarkdownView) {}
+		SLATE_ARGUMENT(FString, Text)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Replace the text; a value that extends the current text is treated as an append. */
+	void SetText(const FString& Text);
+
+	void AppendText(const FString& Delta);
+
+	const FString& GetText() const { return Document.GetSource(); }
+
+private:
+	struct FCodeView
+	{
+		TArray<TSharedPtr<FString>> Lines;
+		TSharedPtr<SListView<TSharedPtr<FString>>> ListView;
+	};
+
+	struct FRenderedBlock
+	{
+		TSharedPtr<SWidget> Widget;
+		/** Set for virtualized code blocks, which are updated in place instead of rebuilt. */
+		TSharedPtr<FCodeView> Code;
+	};
+
+	void SyncWidgets();
+	FRenderedBlock BuildBlock(const FUnrealGPTMarkdownBlock& Block) const;
+	static void SyncCodeLines(FCodeView& Code, const FUnrealGPTMarkdownBlock& Block);
+	static TSharedRef<ITableRow> OnGenerateCodeRow(TSharedPtr<FString> Line, const TSharedRef<STableViewBase>& OwnerTable);
+
+	FUnrealGPTMarkdownDocument Document;
+	TArray<FRenderedBlock> Rendered;
+	TSharedPtr<SVerticalBox> Container;
+};
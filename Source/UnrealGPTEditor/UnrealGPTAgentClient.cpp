@@ -2,14 +2,13 @@
 
 #include "UnrealGPTAgentClient.h"
 #include "UnrealGPTSettings.h"
+#include "UnrealGPTCodexAuth.h"
 #include "UnrealGPTAgentInstructions.h"
 #include "UnrealGPTClarifyTypes.h"
-#include "GenericPlatform/GenericPlatformHttp.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Misc/Base64.h"
-#include "IPythonScriptPlugin.h"
 #include "LevelEditor.h"
 #include "Editor.h"
 #include "Engine/World.h"
@@ -17,9 +16,13 @@
 #include "UnrealGPTSceneContext.h"
 #include "UnrealGPTBlueprintContext.h"
 #include "UnrealGPTReflectionQuery.h"
+#include "UnrealGPTReflectionSearch.h"
 #include "UnrealGPTAssetContext.h"
 #include "UnrealGPTLogReader.h"
 #include "UnrealGPTLogCapture.h"
+#include "UnrealGPTPythonRunner.h"
+#include "UnrealGPTReplicateClient.h"
+#include "UnrealGPTDownloadManager.h"
 // #include "UnrealGPTComputerUse.h" // Computer Use tool disabled
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
@@ -35,6 +38,7 @@
 #include "Engine/Texture2D.h"
 #include "TextureResource.h"
 #include "UnrealGPTToolSchemas.h"
+#include "UnrealGPTSseClient.h"
 #include "Mcp/UnrealGPTMcpSubsystem.h"
 #include "EditorSubsystem.h"
 
@@ -93,6 +97,44 @@ void UUnrealGPTAgentClient::SendMessage(const FString& UserMessage, const TArray
 		}
 	}
 
+	// An access token that is about to expire would only come back as a 401; renew it before sending.
+	const bool bCodexAuthJustRefreshed = bCodexAuthRefreshedForSend;
+	bCodexAuthRefreshedForSend = false;
+	if (Settings->bUseCodexAuth && !bCodexAuthJustRefreshed)
+	{
+		FUnrealGPTCodexAuth& CodexAuth = FUnrealGPTCodexAuth::Get();
+		const FUnrealGPTCodexAuth::FCredentialsPtr Credentials = CodexAuth.GetCredentials(Settings->GetResolvedCodexAuthFilePath());
+		if (Credentials->ApiKey.IsEmpty() && !Credentials->RefreshToken.IsEmpty()
+			&& FUnrealGPTCodexAuth::ExpiresWithin(*Credentials, FTimespan::FromSeconds(CodexAuthExpiryMarginSeconds)))
+		{
+			UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Codex access token expires at %s; refreshing before sending"), *Credentials->AccessTokenExpiry.ToIso8601());
+			bRequestInProgress = true;
+			bCodexAuthRefreshedForSend = true;
+			const uint32 RefreshId = ++CodexRefreshId;
+			TWeakObjectPtr<UUnrealGPTAgentClient> WeakThis(this);
+			CodexAuth.RefreshTokens([WeakThis, RefreshId, UserMessage, ImageBase64](bool bSuccess, const FString& Error)
+			{
+				UUnrealGPTAgentClient* This = WeakThis.Get();
+				if (!This || This->CodexRefreshId != RefreshId)
+				{
+					// Cancelled while refreshing
+					return;
+				}
+
+				This->bRequestInProgress = false;
+				if (!bSuccess)
+				{
+					This->bCodexAuthRefreshedForSend = false;
+					This->OnAgentMessage.Broadcast(TEXT("system"), FString::Printf(TEXT("Error: %s"), *Error), TArray<FString>());
+					return;
+				}
+
+				This->SendMessage(UserMessage, ImageBase64);
+			});
+			return;
+		}
+	}
+
 	FString AuthToken;
 	FString ChatGPTAccountId;
 	FString AuthError;
@@ -868,7 +910,7 @@ void UUnrealGPTAgentClient::SendMessage(const FString& UserMessage, const TArray
 		CurrentRequest->SetHeader(TEXT("Referer"), TEXT("https://chatgpt.com/"));
 	}
 	CurrentRequest->SetContentAsString(RequestBody);
-	CurrentRequest->OnProcessRequestComplete().BindUObject(this, &UUnrealGPTAgentClient::OnResponseReceived);
+	BindResponseHandlers(CurrentRequest.ToSharedRef());
 	
 	bRequestInProgress = true;
 	CurrentRequest->ProcessRequest();
@@ -876,16 +918,27 @@ void UUnrealGPTAgentClient::SendMessage(const FString& UserMessage, const TArray
 
 void UUnrealGPTAgentClient::CancelRequest()
 {
+	++ResponseStreamId;
 	if (CurrentRequest.IsValid() && bRequestInProgress)
 	{
 		CurrentRequest->CancelRequest();
-		bRequestInProgress = false;
 	}
 
+	// A token refresh in flight has no request to cancel; its callback sees the new id and drops the send.
+	++CodexRefreshId;
+	bRequestInProgress = false;
+	bCodexAuthRefreshedForSend = false;
+	PendingCodexRefreshRetryBody.Empty();
+
 	if (bAwaitingClarifyResponse)
 	{
 		FinalizeClarifyResponse(PendingClarifyCallId, FUnrealGPTClarifyTypes::BuildCancelledResult(), false);
 	}
+
+	if (PendingAsyncToolCount > 0)
+	{
+		ResetAsyncToolBatch();
+	}
 }
 
 void UUnrealGPTAgentClient::ClearPendingClarify()
@@ -929,6 +982,11 @@ void UUnrealGPTAgentClient::ClearHistory()
 		ClearPendingClarify();
 	}
 
+	if (PendingAsyncToolCount > 0)
+	{
+		ResetAsyncToolBatch();
+	}
+
 	ConversationHistory.Empty();
 	PreviousResponseId.Empty();
 	ToolCallIterationCount = 0;
@@ -1089,6 +1147,30 @@ TArray<TSharedPtr<FJsonObject>> UUnrealGPTAgentClient::BuildToolDefinitions()
 			TEXT("Name or path of the UClass to inspect. Short name (e.g. 'StaticMeshActor'), fully qualified path (e.g. '/Script/Engine.StaticMeshActor'), or Blueprint generated class path (e.g. '/Game/BP_MyActor.BP_MyActor_C')."));
 		Properties->SetObjectField(TEXT("class_name"), ClassNameProp);
 
+		TSharedPtr<FJsonObject> ClassEntryItem = MakeShareable(new FJsonObject);
+		ClassEntryItem->SetStringField(TEXT("type"), TEXT("object"));
+		{
+			TSharedPtr<FJsonObject> EntryProps = MakeShareable(new FJsonObject);
+			TSharedPtr<FJsonObject> EntryClassNameProp = MakeShareable(new FJsonObject);
+			EntryClassNameProp->SetStringField(TEXT("type"), TEXT("string"));
+			EntryProps->SetObjectField(TEXT("class_name"), EntryClassNameProp);
+			TSharedPtr<FJsonObject> EntryMemberContainsProp = MakeShareable(new FJsonObject);
+			EntryMemberContainsProp->SetStringField(TEXT("type"), TEXT("string"));
+			EntryProps->SetObjectField(TEXT("member_contains"), EntryMemberContainsProp);
+			ClassEntryItem->SetObjectField(TEXT("properties"), EntryProps);
+			TArray<TSharedPtr<FJsonValue>> EntryRequired;
+			EntryRequired.Add(MakeShareable(new FJsonValueString(TEXT("class_name"))));
+			ClassEntryItem->SetArrayField(TEXT("required"), EntryRequired);
+		}
+
+		TSharedPtr<FJsonObject> ClassesProp = MakeShareable(new FJsonObject);
+		ClassesProp->SetStringField(TEXT("type"), TEXT("array"));
+		ClassesProp->SetStringField(
+			TEXT("description"),
+			TEXT("Batch form: up to 16 classes inspected in one call, each with an optional per-class member_contains. Other fields apply to every entry. Inherited members already listed for an earlier class are omitted from later ones."));
+		ClassesProp->SetObjectField(TEXT("items"), ClassEntryItem);
+		Properties->SetObjectField(TEXT("classes"), ClassesProp);
+
 		TSharedPtr<FJsonObject> MemberContainsProp = MakeShareable(new FJsonObject);
 		MemberContainsProp->SetStringField(TEXT("type"), TEXT("string"));
 		MemberContainsProp->SetStringField(
@@ -1132,17 +1214,17 @@ TArray<TSharedPtr<FJsonObject>> UUnrealGPTAgentClient::BuildToolDefinitions()
 
 		ReflectionParams->SetObjectField(TEXT("properties"), Properties);
 
-		TArray<TSharedPtr<FJsonValue>> Required;
-		Required.Add(MakeShareable(new FJsonValueString(TEXT("class_name"))));
-		ReflectionParams->SetArrayField(TEXT("required"), Required);
-
 		Tools.Add(BuildToolObject(
 			TEXT("reflection_query"),
 			TEXT("Inspect an Unreal UClass via the reflection system. Returns a compact JSON schema of reflected properties and functions relevant to Python/Blueprint scripting. ")
-			TEXT("By default only scriptable members declared on the class are returned. Use member_contains to search for a specific property/function, and include_super=true only when inherited members are needed."),
+			TEXT("By default only scriptable members declared on the class are returned. Use member_contains to search for a specific property/function, and include_super=true only when inherited members are needed. ")
+			TEXT("Pass either class_name or a 'classes' list to inspect several classes in one call."),
 			ReflectionParams));
 	}
 
+	// Local ranked search over reflected member names, categories and tooltips.
+	Tools.Add(FUnrealGPTToolSchemas::BuildReflectionSearchTool(bUseResponsesApi));
+
 	// Editor log reader: token-efficient tail of UE Output Log / Saved/Logs.
 	{
 		TSharedPtr<FJsonObject> ReadLogParams = MakeShareable(new FJsonObject);
@@ -1207,7 +1289,8 @@ TArray<TSharedPtr<FJsonObject>> UUnrealGPTAgentClient::BuildToolDefinitions()
 			TEXT("Read recent Unreal Editor log output in a token-efficient, filtered way. ")
 			TEXT("Use after failed or ambiguous python_execute calls to inspect errors, warnings, and tracebacks. ")
 			TEXT("Prefer category='LogPython' or contains='Traceback' when debugging Python scripts. ")
-			TEXT("Use mode='since_last_read' when polling logs across retries instead of re-reading the same tail."),
+			TEXT("Use mode='since_last_read' when polling logs across retries instead of re-reading the same tail. ")
+			TEXT("Errors logged during python_execute, blueprint_* and actor edit tools are already attached to their results as 'new_log_errors'; only call read_log when you need more context."),
 			ReadLogParams));
 	}
 
@@ -1519,19 +1602,96 @@ TArray<TSharedPtr<FJsonObject>> UUnrealGPTAgentClient::BuildToolDefinitions()
 		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintCreateTool(bUseResponsesApi));
 		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintAddVariableTool(bUseResponsesApi));
 		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintCompileTool(bUseResponsesApi));
+		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintCompileBatchTool(bUseResponsesApi));
+		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintSearchNodesTool(bUseResponsesApi));
 		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintAddNodeTool(bUseResponsesApi));
 		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintConnectPinsTool(bUseResponsesApi));
 		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintRemoveNodeTool(bUseResponsesApi));
 		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintSetPinDefaultTool(bUseResponsesApi));
+		Tools.Add(FUnrealGPTToolSchemas::BuildBlueprintApplyEditsTool(bUseResponsesApi));
 	}
 
 	return Tools;
 }
 
+void UUnrealGPTAgentClient::BindResponseHandlers(const TSharedRef<IHttpRequest>& Request)
+{
+	CurrentRequest = Request;
+
+	// Deltas are parsed on the HTTP thread as events arrive and broadcast on the game thread; the
+	// completed response still carries the full text, so a delta that arrives after it is dropped.
+	const uint32 StreamId = ++ResponseStreamId;
+	TWeakObjectPtr<UUnrealGPTAgentClient> WeakThis(this);
+	ResponseStream = MakeShared<FUnrealGPTSseBodyStream>([WeakThis, StreamId](const FUnrealGPTSseEvent& Event)
+	{
+		FString Delta;
+		if (!GetStreamTextDelta(Event.Data, Delta))
+		{
+			return;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, StreamId, Delta = MoveTemp(Delta)]()
+		{
+			UUnrealGPTAgentClient* This = WeakThis.Get();
+			if (This && This->ResponseStreamId == StreamId)
+			{
+				This->OnAgentMessageDelta.Broadcast(Delta);
+			}
+		});
+	});
+
+	Request->SetResponseBodyReceiveStream(ResponseStream.ToSharedRef());
+	Request->OnProcessRequestComplete().BindUObject(this, &UUnrealGPTAgentClient::OnResponseReceived);
+}
+
+bool UUnrealGPTAgentClient::GetStreamTextDelta(const FString& EventData, FString& OutDelta)
+{
+	// Cheap filter first: most events (tool arguments, reasoning, item bookkeeping) carry no assistant text
+	if (EventData.IsEmpty() || EventData == TEXT("[DONE]")
+		|| (!EventData.Contains(TEXT("output_text.delta")) && !EventData.Contains(TEXT("\"content\""))))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> EventObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(EventData);
+	if (!FJsonSerializer::Deserialize(Reader, EventObject) || !EventObject.IsValid())
+	{
+		return false;
+	}
+
+	// Responses API
+	FString EventType;
+	if (EventObject->TryGetStringField(TEXT("type"), EventType))
+	{
+		return EventType == TEXT("response.output_text.delta")
+			&& EventObject->TryGetStringField(TEXT("delta"), OutDelta)
+			&& !OutDelta.IsEmpty();
+	}
+
+	// Chat Completions
+	const TArray<TSharedPtr<FJsonValue>>* ChoicesArray = nullptr;
+	const TSharedPtr<FJsonObject>* ChoiceObj = nullptr;
+	const TSharedPtr<FJsonObject>* DeltaObj = nullptr;
+	return EventObject->TryGetArrayField(TEXT("choices"), ChoicesArray) && ChoicesArray->Num() > 0
+		&& (*ChoicesArray)[0]->TryGetObject(ChoiceObj)
+		&& (*ChoiceObj)->TryGetObjectField(TEXT("delta"), DeltaObj)
+		&& (*DeltaObj)->TryGetStringField(TEXT("content"), OutDelta)
+		&& !OutDelta.IsEmpty();
+}
+
 void UUnrealGPTAgentClient::OnResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
 	bRequestInProgress = false;
 
+	// The body went to the receive stream; the response's own content is empty
+	++ResponseStreamId;
+	const TSharedPtr<FUnrealGPTSseBodyStream> BodyStream = MoveTemp(ResponseStream);
+	auto GetResponseBody = [&BodyStream, &Response]()
+	{
+		return BodyStream.IsValid() ? BodyStream->GetBody() : Response->GetContentAsString();
+	};
+
 	// Ensure Settings is valid before proceeding
 	if (!Settings)
 	{
@@ -1553,7 +1713,7 @@ void UUnrealGPTAgentClient::OnResponseReceived(FHttpRequestPtr Request, FHttpRes
 	int32 ResponseCode = Response->GetResponseCode();
 	if (ResponseCode != 200)
 	{
-		const FString ErrorBody = Response->GetContentAsString();
+		const FString ErrorBody = GetResponseBody();
 		UE_LOG(LogTemp, Error, TEXT("UnrealGPT: HTTP error %d: %s"), ResponseCode, *ErrorBody);
 
 		if (ResponseCode == 401
@@ -1628,7 +1788,7 @@ void UUnrealGPTAgentClient::OnResponseReceived(FHttpRequestPtr Request, FHttpRes
 											return;
 										}
 										RetryRequest->SetContentAsString(NewBody);
-										RetryRequest->OnProcessRequestComplete().BindUObject(this, &UUnrealGPTAgentClient::OnResponseReceived);
+										BindResponseHandlers(RetryRequest);
 
 										bRequestInProgress = true;
 										RetryRequest->ProcessRequest();
@@ -1647,7 +1807,7 @@ void UUnrealGPTAgentClient::OnResponseReceived(FHttpRequestPtr Request, FHttpRes
 		return;
 	}
 
-	FString ResponseContent = Response->GetContentAsString();
+	FString ResponseContent = GetResponseBody();
 	
 	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Received response (length: %d)"), ResponseContent.Len());
 	if (ResponseContent.Len() < 500)
@@ -1804,6 +1964,14 @@ void UUnrealGPTAgentClient::ProcessStreamingResponse(const FString& ResponseCont
 									return;
 								}
 
+								if (CurrentToolName == TEXT("replicate_generate"))
+								{
+									const uint32 BatchId = ResetAsyncToolBatch();
+									++PendingAsyncToolCount;
+									StartReplicateGeneration(BatchId, CurrentToolCallId, CurrentToolArguments);
+									return;
+								}
+
 								// Execute tool call
 								FString ToolResult = ExecuteToolCall(CurrentToolCallId, CurrentToolName, CurrentToolArguments);
 								
@@ -2527,6 +2695,7 @@ void UUnrealGPTAgentClient::ProcessResponsesApiResponse(const FString& ResponseC
 
 		bool bHasClientSideTools = false;
 		bool bHasAsyncTools = false;
+		uint32 AsyncBatchId = 0;
 		bool bHasPendingUserInput = false;
 		TArray<FString> ToolResults; // Store results for completion detection
 		TArray<FString> ScreenshotImages; // Viewport screenshots to forward as image input
@@ -2539,8 +2708,9 @@ void UUnrealGPTAgentClient::ProcessResponsesApiResponse(const FString& ResponseC
 			const bool bIsScreenshot = (CallInfo.Name == TEXT("viewport_screenshot"));
 			const bool bIsServerSideTool = IsServerSideTool(CallInfo.Name);
 			const bool bIsAsyncReplicateTool = (CallInfo.Name == TEXT("replicate_generate"));
-			const bool bIsAsyncMcpTool = (CallInfo.Name == TEXT("mcp_call"));
-			const bool bIsAsyncTool = bIsAsyncReplicateTool || bIsAsyncMcpTool;
+			const bool bIsAsyncMcpTool = (CallInfo.Name == TEXT("mcp_call") || CallInfo.Name == TEXT("mcp_read_resource"));
+			const bool bIsReflectionQuery = (CallInfo.Name == TEXT("reflection_query"));
+			const bool bIsAsyncTool = bIsAsyncReplicateTool || bIsAsyncMcpTool || bIsReflectionQuery;
 
 			if (!bIsServerSideTool)
 			{
@@ -2577,51 +2747,45 @@ void UUnrealGPTAgentClient::ProcessResponsesApiResponse(const FString& ResponseC
 				break;
 			}
 
-			// For long-running remote tools, execute asynchronously on a background thread.
+			// Long-running remote tools and snapshot-backed reflection queries report back through CompleteAsyncToolCall instead of blocking the loop.
 			if (bIsAsyncTool)
 			{
-				bHasAsyncTools = true;
+				if (!bHasAsyncTools)
+				{
+					AsyncBatchId = ResetAsyncToolBatch();
+					bHasAsyncTools = true;
+				}
+				++PendingAsyncToolCount;
+
+				if (bIsAsyncReplicateTool)
+				{
+					StartReplicateGeneration(AsyncBatchId, CallInfo.Id, CallInfo.Arguments);
+					continue;
+				}
+
+				if (bIsReflectionQuery)
+				{
+					StartReflectionQuery(AsyncBatchId, CallInfo.Id, CallInfo.Arguments);
+					continue;
+				}
 
 				const FString ToolNameCopy = CallInfo.Name;
 				const FString ArgsCopy = CallInfo.Arguments;
 				const FString CallIdCopy = CallInfo.Id;
-				const int32 MaxToolResultSizeLocal = MaxToolResultSize;
+				const uint32 BatchId = AsyncBatchId;
+				const TWeakObjectPtr<UUnrealGPTAgentClient> WeakThis(this);
 
-				Async(EAsyncExecution::ThreadPool, [this, ToolNameCopy, ArgsCopy, CallIdCopy, MaxToolResultSizeLocal, bIsScreenshot]()
+				Async(EAsyncExecution::ThreadPool, [this, WeakThis, BatchId, ToolNameCopy, ArgsCopy, CallIdCopy]()
 				{
-					// Execute the Replicate tool (may block, but only on this background thread).
+					// Execute the MCP call (may block, but only on this background thread).
 					const FString ToolResult = ExecuteToolCall(CallIdCopy, ToolNameCopy, ArgsCopy);
 
-					// Prepare truncated version for history.
-					FString ToolResultForHistory = ToolResult;
-					if (ToolResultForHistory.Len() > MaxToolResultSizeLocal)
+					AsyncTask(ENamedThreads::GameThread, [WeakThis, BatchId, CallIdCopy, ToolNameCopy, ToolResult]()
 					{
-						if (bIsScreenshot && ToolResultForHistory.StartsWith(TEXT("iVBORw0KGgo")))
-						{
-							ToolResultForHistory = TEXT("Screenshot captured successfully. [Base64 image data omitted from history to prevent context overflow - ")
-								TEXT("the image was captured and can be viewed in the UI. Length: ") + FString::FromInt(ToolResult.Len()) + TEXT(" characters]");
-						}
-						else
+						if (UUnrealGPTAgentClient* Client = WeakThis.Get())
 						{
-							ToolResultForHistory = ToolResultForHistory.Left(MaxToolResultSizeLocal) +
-								TEXT("\n\n[Result truncated - original length: ") + FString::FromInt(ToolResult.Len()) +
-								TEXT(" characters. Full result available in tool output.]");
+							Client->CompleteAsyncToolCall(BatchId, CallIdCopy, ToolNameCopy, ToolResult);
 						}
-					}
-
-					// Back on game thread: update history, broadcast result, and continue conversation.
-					AsyncTask(ENamedThreads::GameThread, [this, CallIdCopy, ToolNameCopy, ToolResult, ToolResultForHistory]()
-					{
-						FAgentMessage ToolMsg;
-						ToolMsg.Role = TEXT("tool");
-						ToolMsg.ToolCallId = CallIdCopy;
-						ToolMsg.Content = ToolResultForHistory;
-						ConversationHistory.Add(ToolMsg);
-
-						OnToolResult.Broadcast(CallIdCopy, ToolResult);
-
-						// Continue conversation with tool result.
-						SendMessage(TEXT(""), TArray<FString>());
 					});
 				});
 
@@ -2681,8 +2845,8 @@ void UUnrealGPTAgentClient::ProcessResponsesApiResponse(const FString& ResponseC
 			return;
 		}
 
-		// If we scheduled any async Replicate tools, do not continue the conversation here.
-		// The async callbacks will add tool results and call SendMessage("") when ready.
+		// If we scheduled any async tools, do not continue the conversation here.
+		// The last CompleteAsyncToolCall of the batch calls SendMessage("").
 		if (bHasAsyncTools)
 		{
 			UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Async tool calls scheduled; waiting for completion callbacks to continue conversation."));
@@ -2753,661 +2917,734 @@ void UUnrealGPTAgentClient::ProcessResponsesApiResponse(const FString& ResponseC
 	}
 }
 
-FString UUnrealGPTAgentClient::ExecuteToolCall(const FString& ToolCallId, const FString& ToolName, const FString& ArgumentsJson)
+// Game-thread editor tools whose side effects commonly surface as log errors (Python exceptions,
+// Blueprint compile failures, transform warnings). Async tools run concurrently on the thread pool,
+// so a capture window around them would pick up unrelated output and is skipped.
+static bool ShouldAttachLogDigest(const FString& ToolName)
 {
-	FString Result;
+	return ToolName == TEXT("python_execute")
+		|| ToolName.StartsWith(TEXT("blueprint_"))
+		|| ToolName == TEXT("set_actor_transform")
+		|| ToolName == TEXT("set_actors_rotation")
+		|| ToolName == TEXT("duplicate_actor")
+		|| ToolName == TEXT("snap_actor_to_ground");
+}
 
-	const bool bIsPythonExecute = (ToolName == TEXT("python_execute"));
-	const bool bIsSceneQuery = (ToolName == TEXT("scene_query"));
+// Attach errors logged during a tool call to its result so the model does not need a follow-up read_log.
+static void AttachLogDigest(FString& Result, const FUnrealGPTLogSubscriptionResult& NewErrors)
+{
+	const TSharedPtr<FJsonObject> Digest = FUnrealGPTLogReader::BuildDigest(NewErrors);
 
-	if (bIsPythonExecute)
+	TSharedPtr<FJsonObject> ResultObj;
+	if (Result.StartsWith(TEXT("{")))
 	{
-		TSharedPtr<FJsonObject> ArgsObj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
-		if (FJsonSerializer::Deserialize(Reader, ArgsObj) && ArgsObj.IsValid())
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result);
+		if (!FJsonSerializer::Deserialize(Reader, ResultObj))
 		{
-			FString Code;
-			if (ArgsObj->TryGetStringField(TEXT("code"), Code))
-			{
-				Result = ExecutePythonCode(Code);
-			}
+			ResultObj.Reset();
 		}
 	}
-	// else if (ToolName == TEXT("computer_use"))
-	// {
-	// 	TSharedPtr<FJsonObject> ArgsObj;
-	// 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
-	// 	if (FJsonSerializer::Deserialize(Reader, ArgsObj) && ArgsObj.IsValid())
-	// 	{
-	// 		FString Action;
-	// 		if (ArgsObj->TryGetStringField(TEXT("action"), Action))
-	// 		{
-	// 			Result = ExecuteComputerUse(Action);
-	// 		}
-	// 	}
-	// }
-	else if (ToolName == TEXT("viewport_screenshot"))
+
+	if (ResultObj.IsValid())
 	{
-		Result = GetViewportScreenshot();
+		ResultObj->SetObjectField(TEXT("new_log_errors"), Digest);
+		Result.Reset();
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Result);
+		FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
 	}
-	else if (ToolName == TEXT("scene_query"))
+	else
 	{
-		// Pass the raw JSON arguments through to the scene query helper.
-		// The JSON can specify filters like class_contains, label_contains,
-		// name_contains, component_class_contains, and max_results.
-		Result = UUnrealGPTSceneContext::QueryScene(ArgumentsJson);
-		
-		// Check if scene_query returned results (non-empty JSON array).
-		// If it did, mark that we found results so we can block subsequent python_execute calls.
-		// scene_query returns a JSON array string, so check if it's not just "[]"
-		bLastSceneQueryFoundResults = !Result.IsEmpty() && Result != TEXT("[]") && Result.StartsWith(TEXT("["));
-		if (bLastSceneQueryFoundResults)
+		FString DigestJson;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&DigestJson);
+		FJsonSerializer::Serialize(Digest.ToSharedRef(), Writer);
+		Result += TEXT("\n\n[new_log_errors] ") + DigestJson;
+	}
+}
+
+static FString MakeReplicateError(const FString& Message)
+{
+	TSharedPtr<FJsonObject> ErrorObj = MakeShareable(new FJsonObject);
+	ErrorObj->SetStringField(TEXT("status"), TEXT("error"));
+	ErrorObj->SetStringField(TEXT("message"), Message);
+
+	FString ErrorJson;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ErrorJson);
+	FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+	return ErrorJson;
+}
+
+// Output file URLs of a finished Replicate prediction. For most models 'output' is an array of URLs,
+// but some return nested objects or arrays containing HTTPS URLs.
+static TArray<FString> CollectReplicateOutputUris(const TSharedPtr<FJsonObject>& FinalObj)
+{
+	TArray<FString> OutputUris;
+	TFunction<void(const TSharedPtr<FJsonValue>&)> CollectUrisFromJsonValue;
+	CollectUrisFromJsonValue = [&OutputUris, &CollectUrisFromJsonValue](const TSharedPtr<FJsonValue>& Val)
+	{
+		if (!Val.IsValid())
 		{
-			// Try to parse and verify it's actually a non-empty array
-			TSharedPtr<FJsonValue> JsonValue;
-			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result);
-			if (FJsonSerializer::Deserialize(Reader, JsonValue) && JsonValue.IsValid())
+			return;
+		}
+
+		switch (Val->Type)
+		{
+		case EJson::String:
 			{
-				const TArray<TSharedPtr<FJsonValue>>* JsonArray = nullptr;
-				if (JsonValue->Type == EJson::Array && JsonValue->TryGetArray(JsonArray))
+				const FString Str = Val->AsString();
+				if (Str.StartsWith(TEXT("http://")) || Str.StartsWith(TEXT("https://")))
 				{
-					bLastSceneQueryFoundResults = (JsonArray->Num() > 0);
-					if (bLastSceneQueryFoundResults)
+					OutputUris.AddUnique(Str);
+				}
+				break;
+			}
+		case EJson::Array:
+			{
+				const TArray<TSharedPtr<FJsonValue>>& Arr = Val->AsArray();
+				for (const TSharedPtr<FJsonValue>& Elem : Arr)
+				{
+					CollectUrisFromJsonValue(Elem);
+				}
+				break;
+			}
+		case EJson::Object:
+			{
+				const TSharedPtr<FJsonObject> Obj = Val->AsObject();
+				if (Obj.IsValid())
+				{
+					for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Obj->Values)
 					{
-						UE_LOG(LogTemp, Log, TEXT("UnrealGPT: scene_query found %d results - will block subsequent python_execute"), JsonArray->Num());
+						CollectUrisFromJsonValue(Pair.Value);
 					}
 				}
-				else
+				break;
+			}
+		default:
+			break;
+		}
+	};
+
+	// Prefer the 'output' field if present.
+	{
+		const TArray<TSharedPtr<FJsonValue>>* OutputArray = nullptr;
+		if (FinalObj->TryGetArrayField(TEXT("output"), OutputArray) && OutputArray)
+		{
+			for (const TSharedPtr<FJsonValue>& Val : *OutputArray)
+			{
+				CollectUrisFromJsonValue(Val);
+			}
+		}
+		else
+		{
+			const TSharedPtr<FJsonObject>* OutputObj = nullptr;
+			if (FinalObj->TryGetObjectField(TEXT("output"), OutputObj) && OutputObj && OutputObj->IsValid())
+			{
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*OutputObj)->Values)
 				{
-					bLastSceneQueryFoundResults = false;
+					CollectUrisFromJsonValue(Pair.Value);
 				}
 			}
 			else
 			{
-				bLastSceneQueryFoundResults = false;
+				FString OutputStr;
+				if (FinalObj->TryGetStringField(TEXT("output"), OutputStr) &&
+					(OutputStr.StartsWith(TEXT("http://")) || OutputStr.StartsWith(TEXT("https://"))))
+				{
+					OutputUris.AddUnique(OutputStr);
+				}
 			}
 		}
 	}
-	else if (ToolName == TEXT("reflection_query"))
-	{
-		Result = FUnrealGPTReflectionQuery::Query(ArgumentsJson);
-	}
-	else if (ToolName == TEXT("read_log"))
-	{
-		Result = FUnrealGPTLogReader::Query(ArgumentsJson);
-	}
-	// New atomic editor tools
-	else if (ToolName == TEXT("get_actor"))
-	{
-		Result = UUnrealGPTSceneContext::GetActor(ArgumentsJson);
-	}
-	else if (ToolName == TEXT("set_actor_transform"))
-	{
-		Result = UUnrealGPTSceneContext::SetActorTransform(ArgumentsJson);
-	}
-	else if (ToolName == TEXT("set_actors_rotation"))
-	{
-		Result = UUnrealGPTSceneContext::SetActorsRotation(ArgumentsJson);
-	}
-	else if (ToolName == TEXT("select_actors"))
-	{
-		Result = UUnrealGPTSceneContext::SelectActors(ArgumentsJson);
-	}
-	else if (ToolName == TEXT("duplicate_actor"))
+
+	// As a fallback, scan the entire response object for HTTPS URLs if we didn't find any in 'output'.
+	if (OutputUris.Num() == 0)
 	{
-		Result = UUnrealGPTSceneContext::DuplicateActor(ArgumentsJson);
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : FinalObj->Values)
+		{
+			CollectUrisFromJsonValue(Pair.Value);
+		}
 	}
-	else if (ToolName == TEXT("snap_actor_to_ground"))
+
+	return OutputUris;
+}
+
+static FString GetReplicateStagingFolder(const FString& Kind)
+{
+	const FString BasePath = FPaths::ProjectContentDir() / TEXT("UnrealGPT/Generated");
+	const FString K = Kind.ToLower();
+
+	if (K == TEXT("image"))
 	{
-		Result = UUnrealGPTSceneContext::SnapActorToGround(ArgumentsJson);
+		return BasePath / TEXT("Images");
 	}
-	else if (ToolName == TEXT("blueprint_query"))
+	if (K == TEXT("audio"))
 	{
-		Result = UUnrealGPTBlueprintContext::Query(ArgumentsJson);
+		return BasePath / TEXT("Audio");
 	}
-	else if (ToolName == TEXT("blueprint_create"))
+	if (K == TEXT("video"))
 	{
-		Result = UUnrealGPTBlueprintContext::Create(ArgumentsJson);
+		return BasePath / TEXT("Video");
 	}
-	else if (ToolName == TEXT("blueprint_add_variable"))
+	if (K == TEXT("3d") || K == TEXT("3d_model") || K == TEXT("model") || K == TEXT("mesh"))
 	{
-		Result = UUnrealGPTBlueprintContext::AddVariable(ArgumentsJson);
+		return BasePath / TEXT("Models");
 	}
-	else if (ToolName == TEXT("blueprint_compile"))
+
+	return BasePath / TEXT("Misc");
+}
+
+// Build the replicate_generate tool result from the downloaded outputs.
+static FString BuildReplicateResult(const TArray<FUnrealGPTDownloadResult>& Downloads, const FString& OutputKind)
+{
+	TArray<TSharedPtr<FJsonValue>> FilesArray;
+	for (const FUnrealGPTDownloadResult& Download : Downloads)
 	{
-		Result = UUnrealGPTBlueprintContext::Compile(ArgumentsJson);
-	}
-	else if (ToolName == TEXT("blueprint_add_node"))
+		if (!Download.bSuccess)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: Replicate output download failed for %s: %s"), *Download.Url, *Download.Error);
+			continue;
+		}
+
+		const FString& LocalPath = Download.LocalPath;
+		TSharedPtr<FJsonObject> FileObj = MakeShareable(new FJsonObject);
+		const FString Ext = FPaths::GetExtension(LocalPath).ToLower();
+		FString MimeType = Ext;
+		if (Ext == TEXT("png")) MimeType = TEXT("image/png");
+		else if (Ext == TEXT("jpg") || Ext == TEXT("jpeg")) MimeType = TEXT("image/jpeg");
+		else if (Ext == TEXT("wav")) MimeType = TEXT("audio/wav");
+		else if (Ext == TEXT("mp3")) MimeType = TEXT("audio/mpeg");
+		else if (Ext == TEXT("fbx")) MimeType = TEXT("model/fbx");
+		else if (Ext == TEXT("glb")) MimeType = TEXT("model/gltf-binary");
+
+		FString InferredUsage = TEXT("file");
+		if (MimeType.StartsWith(TEXT("image/"))) InferredUsage = TEXT("image");
+		else if (MimeType.StartsWith(TEXT("audio/"))) InferredUsage = TEXT("audio");
+		else if (MimeType.StartsWith(TEXT("video/"))) InferredUsage = TEXT("video");
+		else if (OutputKind == TEXT("3d") || OutputKind == TEXT("3d_model") || OutputKind == TEXT("model") || OutputKind == TEXT("mesh")) InferredUsage = TEXT("3d_model");
+		else if (OutputKind == TEXT("image")) InferredUsage = TEXT("image");
+		else if (OutputKind == TEXT("audio")) InferredUsage = TEXT("audio");
+		else if (OutputKind == TEXT("video")) InferredUsage = TEXT("video");
+
+		FileObj->SetStringField(TEXT("local_path"), LocalPath);
+		FileObj->SetStringField(TEXT("mime_type"), MimeType);
+		FileObj->SetStringField(TEXT("inferred_usage"), InferredUsage);
+		FileObj->SetStringField(TEXT("description"), TEXT("Downloaded output from Replicate prediction"));
+		FilesArray.Add(MakeShareable(new FJsonValueObject(FileObj)));
+	}
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShareable(new FJsonObject);
+	ResultObj->SetStringField(TEXT("status"), TEXT("success"));
+
+	const int32 NumFiles = FilesArray.Num();
+	ResultObj->SetStringField(
+		TEXT("message"),
+		FString::Printf(TEXT("Replicate prediction succeeded with %d downloaded file(s)."), NumFiles));
+
+	TSharedPtr<FJsonObject> DetailsObj = MakeShareable(new FJsonObject);
+	DetailsObj->SetStringField(TEXT("provider"), TEXT("replicate"));
+	DetailsObj->SetStringField(TEXT("output_kind"), OutputKind);
+	DetailsObj->SetArrayField(TEXT("files"), FilesArray);
+
+	ResultObj->SetObjectField(TEXT("details"), DetailsObj);
+
+	FString ResultJsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultJsonString);
+	FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
+	return ResultJsonString;
+}
+
+bool UUnrealGPTAgentClient::BuildReplicateRequest(const FString& ArgumentsJson, FString& OutApiUrl, FString& OutRequestBody, FString& OutOutputKind, FString& OutError) const
+{
+	if (!Settings || !Settings->bEnableReplicateTool || Settings->ReplicateApiToken.IsEmpty())
 	{
-		Result = UUnrealGPTBlueprintContext::AddNode(ArgumentsJson);
+		OutError = MakeReplicateError(TEXT("Replicate tool is not enabled or API token is missing in settings"));
+		return false;
 	}
-	else if (ToolName == TEXT("blueprint_connect_pins"))
+
+	TSharedPtr<FJsonObject> ArgsObj;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
+	if (!(FJsonSerializer::Deserialize(Reader, ArgsObj) && ArgsObj.IsValid()))
 	{
-		Result = UUnrealGPTBlueprintContext::ConnectPins(ArgumentsJson);
+		OutError = MakeReplicateError(TEXT("Failed to parse replicate_generate arguments"));
+		return false;
 	}
-	else if (ToolName == TEXT("blueprint_remove_node"))
+
+	FString Prompt;
+	if (!(ArgsObj->TryGetStringField(TEXT("prompt"), Prompt) && !Prompt.IsEmpty()))
 	{
-		Result = UUnrealGPTBlueprintContext::RemoveNode(ArgumentsJson);
+		OutError = MakeReplicateError(TEXT("Missing required field: prompt"));
+		return false;
 	}
-	else if (ToolName == TEXT("blueprint_set_pin_default"))
+
+	FString OutputKind;
+	ArgsObj->TryGetStringField(TEXT("output_kind"), OutputKind);
+	OutputKind = OutputKind.ToLower();
+	if (OutputKind.IsEmpty())
 	{
-		Result = UUnrealGPTBlueprintContext::SetPinDefault(ArgumentsJson);
+		OutputKind = TEXT("image");
 	}
-	else if (ToolName == TEXT("replicate_generate"))
+	OutOutputKind = OutputKind;
+
+	// Resolve the effective Replicate model version to use:
+	// 1) If the tool call explicitly provided a 'version', respect that.
+	// 2) Otherwise, pick a default per output kind from settings where possible.
+	FString Version;
+	if (!ArgsObj->TryGetStringField(TEXT("version"), Version) || Version.IsEmpty())
 	{
-		// Dedicated Replicate generation helper using the Replicate HTTP API directly (no MCP).
-		if (!Settings)
+		if (OutputKind == TEXT("image"))
 		{
-			Settings = GetMutableDefault<UUnrealGPTSettings>();
+			Version = Settings->ReplicateImageModel;
 		}
-
-		if (!Settings || !Settings->bEnableReplicateTool || Settings->ReplicateApiToken.IsEmpty())
+		else if (OutputKind == TEXT("video"))
 		{
-			return TEXT("{\"status\":\"error\",\"message\":\"Replicate tool is not enabled or API token is missing in settings\"}");
+			Version = Settings->ReplicateVideoModel;
 		}
-
-		TSharedPtr<FJsonObject> ArgsObj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
-		if (!(FJsonSerializer::Deserialize(Reader, ArgsObj) && ArgsObj.IsValid()))
+		else if (OutputKind == TEXT("audio"))
 		{
-			return TEXT("{\"status\":\"error\",\"message\":\"Failed to parse replicate_generate arguments\"}");
+			// For audio we distinguish SFX vs music via conventions in the prompt;
+			// by default prefer the SFX model, and the model itself can be a music model if desired.
+			Version = Settings->ReplicateSFXModel;
 		}
-
-		FString Prompt;
-		if (!(ArgsObj->TryGetStringField(TEXT("prompt"), Prompt) && !Prompt.IsEmpty()))
+		else if (OutputKind == TEXT("3d") || OutputKind == TEXT("3d_model") || OutputKind == TEXT("model") || OutputKind == TEXT("mesh"))
 		{
-			return TEXT("{\"status\":\"error\",\"message\":\"Missing required field: prompt\"}");
+			Version = Settings->Replicate3DModel;
 		}
 
-		FString OutputKind;
-		ArgsObj->TryGetStringField(TEXT("output_kind"), OutputKind);
-		OutputKind = OutputKind.ToLower();
-		if (OutputKind.IsEmpty())
-		{
-			OutputKind = TEXT("image");
-		}
-
-		// Resolve the effective Replicate model version to use:
-		// 1) If the tool call explicitly provided a 'version', respect that.
-		// 2) Otherwise, pick a default per output kind from settings where possible.
-		FString Version;
-		if (!ArgsObj->TryGetStringField(TEXT("version"), Version) || Version.IsEmpty())
+		// If still empty, try additional hints from optional 'output_subkind',
+		// e.g. 'sfx', 'music', or 'speech' for audio cases.
+		if (Version.IsEmpty())
 		{
-			if (OutputKind == TEXT("image"))
+			FString OutputSubkind;
+			if (ArgsObj->TryGetStringField(TEXT("output_subkind"), OutputSubkind))
 			{
-				Version = Settings->ReplicateImageModel;
-			}
-			else if (OutputKind == TEXT("video"))
-			{
-				Version = Settings->ReplicateVideoModel;
-			}
-			else if (OutputKind == TEXT("audio"))
-			{
-				// For audio we distinguish SFX vs music via conventions in the prompt;
-				// by default prefer the SFX model, and the model itself can be a music model if desired.
-				Version = Settings->ReplicateSFXModel;
-			}
-			else if (OutputKind == TEXT("3d") || OutputKind == TEXT("3d_model") || OutputKind == TEXT("model") || OutputKind == TEXT("mesh"))
-			{
-				Version = Settings->Replicate3DModel;
-			}
+				OutputSubkind = OutputSubkind.ToLower();
 
-			// If still empty, try additional hints from optional 'output_subkind',
-			// e.g. 'sfx', 'music', or 'speech' for audio cases.
-			if (Version.IsEmpty())
-			{
-				FString OutputSubkind;
-				if (ArgsObj->TryGetStringField(TEXT("output_subkind"), OutputSubkind))
+				if (OutputSubkind == TEXT("sfx"))
 				{
-					OutputSubkind = OutputSubkind.ToLower();
-
-					if (OutputSubkind == TEXT("sfx"))
-					{
-						Version = Settings->ReplicateSFXModel;
-					}
-					else if (OutputSubkind == TEXT("music"))
-					{
-						Version = Settings->ReplicateMusicModel;
-					}
-					else if (OutputSubkind == TEXT("speech") || OutputSubkind == TEXT("voice"))
-					{
-						Version = Settings->ReplicateSpeechModel;
-					}
+					Version = Settings->ReplicateSFXModel;
+				}
+				else if (OutputSubkind == TEXT("music"))
+				{
+					Version = Settings->ReplicateMusicModel;
+				}
+				else if (OutputSubkind == TEXT("speech") || OutputSubkind == TEXT("voice"))
+				{
+					Version = Settings->ReplicateSpeechModel;
 				}
 			}
 		}
+	}
 
-		// Detect when the configured identifier looks like an owner/name model slug
-		// instead of a raw version id. For official models, Replicate supports
-		// POST /v1/models/{owner}/{name}/predictions without a version field.
-		const bool bLooksLikeModelSlug = Version.Contains(TEXT("/"));
+	// Detect when the configured identifier looks like an owner/name model slug
+	// instead of a raw version id. For official models, Replicate supports
+	// POST /v1/models/{owner}/{name}/predictions without a version field.
+	const bool bLooksLikeModelSlug = Version.Contains(TEXT("/"));
 
-		// If we still don't have any identifier at this point, fail fast with a clear error
-		// instead of sending an invalid request to Replicate.
-		if (Version.IsEmpty())
-		{
-			return TEXT("{\"status\":\"error\",\"message\":\"Replicate prediction requires a model identifier. Configure a default model (owner/name slug or version id) in UnrealGPT settings or pass 'version' explicitly in replicate_generate arguments.\"}");
-		}
+	// If we still don't have any identifier at this point, fail fast with a clear error
+	// instead of sending an invalid request to Replicate.
+	if (Version.IsEmpty())
+	{
+		OutError = MakeReplicateError(TEXT("Replicate prediction requires a model identifier. Configure a default model (owner/name slug or version id) in UnrealGPT settings or pass 'version' explicitly in replicate_generate arguments."));
+		return false;
+	}
 
-		// Build Replicate prediction request body.
-		TSharedPtr<FJsonObject> RequestObj = MakeShareable(new FJsonObject);
+	// Build Replicate prediction request body.
+	TSharedPtr<FJsonObject> RequestObj = MakeShareable(new FJsonObject);
 
-		TSharedPtr<FJsonObject> InputObj = MakeShareable(new FJsonObject);
-		InputObj->SetStringField(TEXT("prompt"), Prompt);
+	TSharedPtr<FJsonObject> InputObj = MakeShareable(new FJsonObject);
+	InputObj->SetStringField(TEXT("prompt"), Prompt);
 
-		// For image generation, request PNG output directly from the model where supported.
-		// Many Replicate image models accept an 'output_format' parameter; models that do not
-		// simply ignore unknown fields, so this is safe as a default.
-		if (OutputKind == TEXT("image"))
-		{
-			InputObj->SetStringField(TEXT("output_format"), TEXT("png"));
-		}
+	// For image generation, request PNG output directly from the model where supported.
+	// Many Replicate image models accept an 'output_format' parameter; models that do not
+	// simply ignore unknown fields, so this is safe as a default.
+	if (OutputKind == TEXT("image"))
+	{
+		InputObj->SetStringField(TEXT("output_format"), TEXT("png"));
+	}
 
-		// Handle optional input_image for image-to-image models
-		FString InputImagePath;
-		if (ArgsObj->TryGetStringField(TEXT("input_image"), InputImagePath) && !InputImagePath.IsEmpty())
+	// Handle optional input_image for image-to-image models
+	FString InputImagePath;
+	if (ArgsObj->TryGetStringField(TEXT("input_image"), InputImagePath) && !InputImagePath.IsEmpty())
+	{
+		FString ImageError;
+		FString ImageDataUri = FUnrealGPTAssetContext::ConvertImageToBase64DataUri(InputImagePath, ImageError);
+		
+		if (ImageDataUri.IsEmpty())
 		{
-			FString ImageError;
-			FString ImageDataUri = FUnrealGPTAssetContext::ConvertImageToBase64DataUri(InputImagePath, ImageError);
-			
-			if (ImageDataUri.IsEmpty())
-			{
-				return FString::Printf(TEXT("{\"status\":\"error\",\"message\":\"Failed to load input_image: %s\"}"), *ImageError);
-			}
-
-			// Determine the parameter name for the image (default: "image")
-			FString ImageParamName = TEXT("image");
-			ArgsObj->TryGetStringField(TEXT("input_image_param"), ImageParamName);
-			if (ImageParamName.IsEmpty())
-			{
-				ImageParamName = TEXT("image");
-			}
-
-			InputObj->SetStringField(*ImageParamName, ImageDataUri);
-			UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Added input image as '%s' parameter (%d chars)"), *ImageParamName, ImageDataUri.Len());
+			OutError = MakeReplicateError(FString::Printf(TEXT("Failed to load input_image: %s"), *ImageError));
+			return false;
 		}
 
-		RequestObj->SetObjectField(TEXT("input"), InputObj);
-
-		FString RequestBody;
+		// Determine the parameter name for the image (default: "image")
+		FString ImageParamName = TEXT("image");
+		ArgsObj->TryGetStringField(TEXT("input_image_param"), ImageParamName);
+		if (ImageParamName.IsEmpty())
 		{
-			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-			FJsonSerializer::Serialize(RequestObj.ToSharedRef(), Writer);
+			ImageParamName = TEXT("image");
 		}
 
-		FString ApiUrl = Settings->ReplicateApiUrl.IsEmpty()
-			? TEXT("https://api.replicate.com/v1/predictions")
-			: Settings->ReplicateApiUrl;
-
-		// If the identifier looks like an owner/name slug and we are using the default
-		// predictions endpoint, route this call through the official models endpoint
-		// so the user does not need to look up a separate version id.
-		const bool bIsDefaultPredictionsEndpoint =
-			(ApiUrl == TEXT("https://api.replicate.com/v1/predictions") || ApiUrl.EndsWith(TEXT("/v1/predictions")));
-
-		const bool bUseOfficialModelsEndpoint = bLooksLikeModelSlug && bIsDefaultPredictionsEndpoint;
-
-		if (bUseOfficialModelsEndpoint)
-		{
-			ApiUrl = FString::Printf(TEXT("https://api.replicate.com/v1/models/%s/predictions"), *Version);
-		}
-		else
-		{
-			// For the unified predictions endpoint, send the identifier as the 'version' field.
-			RequestObj->SetStringField(TEXT("version"), Version);
-		}
+		InputObj->SetStringField(*ImageParamName, ImageDataUri);
+		UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Added input image as '%s' parameter (%d chars)"), *ImageParamName, ImageDataUri.Len());
+	}
 
-		// Helper lambda to perform a blocking HTTP request (runs on background thread for this tool).
-		auto PerformHttpRequest = [](const FString& Url, const FString& Verb, const FString& Body, const FString& AuthToken, FString& OutResponse, int32 TimeoutSeconds) -> bool
-		{
-			TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-			Request->SetURL(Url);
-			Request->SetVerb(Verb);
-			Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-			// Replicate HTTP API expects Bearer tokens: Authorization: Bearer <token>
-			Request->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *AuthToken));
-
-			if (!Body.IsEmpty())
-			{
-				Request->SetContentAsString(Body);
-			}
+	RequestObj->SetObjectField(TEXT("input"), InputObj);
 
-			bool bRequestComplete = false;
-			bool bSuccess = false;
+	OutApiUrl = Settings->ReplicateApiUrl.IsEmpty()
+		? TEXT("https://api.replicate.com/v1/predictions")
+		: Settings->ReplicateApiUrl;
 
-			Request->OnProcessRequestComplete().BindLambda(
-				[&](FHttpRequestPtr Req, FHttpResponsePtr Res, bool bConnected)
-				{
-					if (bConnected && Res.IsValid() && Res->GetResponseCode() >= 200 && Res->GetResponseCode() < 300)
-					{
-						OutResponse = Res->GetContentAsString();
-						bSuccess = true;
-					}
-					else if (Res.IsValid())
-					{
-						OutResponse = Res->GetContentAsString();
-					}
-					bRequestComplete = true;
-				});
+	// If the identifier looks like an owner/name slug and we are using the default
+	// predictions endpoint, route this call through the official models endpoint
+	// so the user does not need to look up a separate version id.
+	const bool bIsDefaultPredictionsEndpoint =
+		(OutApiUrl == TEXT("https://api.replicate.com/v1/predictions") || OutApiUrl.EndsWith(TEXT("/v1/predictions")));
 
-			Request->ProcessRequest();
+	const bool bUseOfficialModelsEndpoint = bLooksLikeModelSlug && bIsDefaultPredictionsEndpoint;
 
-			const double StartTime = FPlatformTime::Seconds();
-			while (!bRequestComplete)
-			{
-				FPlatformProcess::Sleep(0.01f);
-				if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
-				{
-					Request->CancelRequest();
-					OutResponse = TEXT("{\"error\":\"Request timed out\"}");
-					return false;
-				}
-			}
+	if (bUseOfficialModelsEndpoint)
+	{
+		OutApiUrl = FString::Printf(TEXT("https://api.replicate.com/v1/models/%s/predictions"), *Version);
+	}
+	else
+	{
+		// For the unified predictions endpoint, send the identifier as the 'version' field.
+		RequestObj->SetStringField(TEXT("version"), Version);
+	}
 
-			return bSuccess;
-		};
+	// Serialize only now that the endpoint choice has had its chance to add 'version'.
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutRequestBody);
+	FJsonSerializer::Serialize(RequestObj.ToSharedRef(), Writer);
+	return true;
+}
 
-		// 1) Create prediction
-		FString CreateResponse;
-		if (!PerformHttpRequest(ApiUrl, TEXT("POST"), RequestBody, Settings->ReplicateApiToken, CreateResponse, 60))
-		{
-			return FString::Printf(TEXT("{\"status\":\"error\",\"message\":\"Failed to create Replicate prediction: %s\"}"), *CreateResponse);
-		}
+void UUnrealGPTAgentClient::StartReplicateGeneration(uint32 BatchId, const FString& ToolCallId, const FString& ArgumentsJson)
+{
+	if (!Settings)
+	{
+		Settings = GetMutableDefault<UUnrealGPTSettings>();
+	}
 
-		TSharedPtr<FJsonObject> CreateObj;
-		{
-			TSharedRef<TJsonReader<>> CreateReader = TJsonReaderFactory<>::Create(CreateResponse);
-			if (!(FJsonSerializer::Deserialize(CreateReader, CreateObj) && CreateObj.IsValid()))
-			{
-				return TEXT("{\"status\":\"error\",\"message\":\"Failed to parse Replicate create prediction response\"}");
-			}
-		}
+	const TWeakObjectPtr<UUnrealGPTAgentClient> WeakThis(this);
 
-		FString PollUrl;
+	FString ApiUrl;
+	FString RequestBody;
+	FString OutputKind;
+	FString Error;
+	if (!BuildReplicateRequest(ArgumentsJson, ApiUrl, RequestBody, OutputKind, Error))
+	{
+		// Report on the next tick so the tool loop can finish scheduling the rest of the batch first.
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, BatchId, ToolCallId, Error]()
 		{
-			const TSharedPtr<FJsonObject>* UrlsObj = nullptr;
-			if (CreateObj->TryGetObjectField(TEXT("urls"), UrlsObj) && UrlsObj && UrlsObj->IsValid())
+			if (UUnrealGPTAgentClient* Client = WeakThis.Get())
 			{
-				(*UrlsObj)->TryGetStringField(TEXT("get"), PollUrl);
+				Client->CompleteAsyncToolCall(BatchId, ToolCallId, TEXT("replicate_generate"), Error);
 			}
-		}
-
-		if (PollUrl.IsEmpty())
-		{
-			return TEXT("{\"status\":\"error\",\"message\":\"Replicate response did not include a poll URL\"}");
-		}
+		});
+		return;
+	}
 
-		// 2) Poll prediction until it completes
-		FString FinalResponse;
-		TSharedPtr<FJsonObject> FinalObj;
-		const int32 MaxPollSeconds = 300;
-		const double PollStart = FPlatformTime::Seconds();
-		while (true)
+	const FString ApiToken = Settings->ReplicateApiToken;
+	const uint32 PredictionId = FUnrealGPTReplicateClient::Get().CreatePrediction(ApiUrl, ApiToken, RequestBody,
+		[WeakThis, BatchId, ToolCallId, OutputKind, ApiToken](const FUnrealGPTReplicateResult& Prediction)
 		{
-			if (!PerformHttpRequest(PollUrl, TEXT("GET"), FString(), Settings->ReplicateApiToken, FinalResponse, 60))
-			{
-				return FString::Printf(TEXT("{\"status\":\"error\",\"message\":\"Failed while polling Replicate prediction: %s\"}"), *FinalResponse);
-			}
-
-			TSharedRef<TJsonReader<>> FinalReader = TJsonReaderFactory<>::Create(FinalResponse);
-			if (!(FJsonSerializer::Deserialize(FinalReader, FinalObj) && FinalObj.IsValid()))
+			UUnrealGPTAgentClient* Client = WeakThis.Get();
+			if (!Client)
 			{
-				return TEXT("{\"status\":\"error\",\"message\":\"Failed to parse Replicate poll response\"}");
-			}
-
-			FString PredStatus;
-			FinalObj->TryGetStringField(TEXT("status"), PredStatus);
-
-			if (PredStatus == TEXT("succeeded"))
-			{
-				break;
+				return;
 			}
 
-			if (PredStatus == TEXT("failed") || PredStatus == TEXT("canceled"))
+			Client->ActiveReplicatePredictions.Remove(ToolCallId);
+			if (BatchId != Client->AsyncToolBatchId)
 			{
-				FString ErrorMsg;
-				FinalObj->TryGetStringField(TEXT("error"), ErrorMsg);
-				return FString::Printf(TEXT("{\"status\":\"error\",\"message\":\"Replicate prediction %s: %s\"}"), *PredStatus, *ErrorMsg);
+				// Canceled or superseded; nothing left to download for.
+				return;
 			}
 
-			if (FPlatformTime::Seconds() - PollStart > MaxPollSeconds)
+			if (!Prediction.bSuccess)
 			{
-				return TEXT("{\"status\":\"error\",\"message\":\"Replicate prediction polling timed out\"}");
+				Client->CompleteAsyncToolCall(BatchId, ToolCallId, TEXT("replicate_generate"), MakeReplicateError(Prediction.Error));
+				return;
 			}
 
-			FPlatformProcess::Sleep(0.5f);
-		}
-
-		// 3) Extract output URIs. For most models, 'output' is an array of URLs,
-		// but some return nested objects or arrays containing HTTPS URLs.
-		TArray<FString> OutputUris;
-		TFunction<void(const TSharedPtr<FJsonValue>&)> CollectUrisFromJsonValue;
-		CollectUrisFromJsonValue = [&OutputUris, &CollectUrisFromJsonValue](const TSharedPtr<FJsonValue>& Val)
-		{
-			if (!Val.IsValid())
+			// Replicate file URLs may require the same Bearer token.
+			TArray<FUnrealGPTDownloadRequest> Downloads;
+			for (const FString& Uri : CollectReplicateOutputUris(Prediction.Prediction))
 			{
-				return;
+				FUnrealGPTDownloadRequest& Download = Downloads.AddDefaulted_GetRef();
+				Download.Url = Uri;
+				Download.Headers.Add(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *ApiToken));
+				Download.StagingFolder = GetReplicateStagingFolder(OutputKind);
 			}
 
-			switch (Val->Type)
-			{
-			case EJson::String:
-				{
-					const FString Str = Val->AsString();
-					if (Str.StartsWith(TEXT("http://")) || Str.StartsWith(TEXT("https://")))
-					{
-						OutputUris.AddUnique(Str);
-					}
-					break;
-				}
-			case EJson::Array:
+			FUnrealGPTDownloadManager::Get().Download(MoveTemp(Downloads),
+				[WeakThis, BatchId, ToolCallId, OutputKind](TArray<FUnrealGPTDownloadResult>&& Results)
 				{
-					const TArray<TSharedPtr<FJsonValue>>& Arr = Val->AsArray();
-					for (const TSharedPtr<FJsonValue>& Elem : Arr)
+					const FString ToolResult = BuildReplicateResult(Results, OutputKind);
+					AsyncTask(ENamedThreads::GameThread, [WeakThis, BatchId, ToolCallId, ToolResult]()
 					{
-						CollectUrisFromJsonValue(Elem);
-					}
-					break;
-				}
-			case EJson::Object:
-				{
-					const TSharedPtr<FJsonObject> Obj = Val->AsObject();
-					if (Obj.IsValid())
-					{
-						for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Obj->Values)
+						if (UUnrealGPTAgentClient* Client = WeakThis.Get())
 						{
-							CollectUrisFromJsonValue(Pair.Value);
+							Client->CompleteAsyncToolCall(BatchId, ToolCallId, TEXT("replicate_generate"), ToolResult);
 						}
-					}
-					break;
-				}
-			default:
-				break;
-			}
-		};
+					});
+				});
+		});
 
-		// Prefer the 'output' field if present.
-		{
-			const TArray<TSharedPtr<FJsonValue>>* OutputArray = nullptr;
-			if (FinalObj->TryGetArrayField(TEXT("output"), OutputArray) && OutputArray)
-			{
-				for (const TSharedPtr<FJsonValue>& Val : *OutputArray)
-				{
-					CollectUrisFromJsonValue(Val);
-				}
-			}
-			else
-			{
-				const TSharedPtr<FJsonObject>* OutputObj = nullptr;
-				if (FinalObj->TryGetObjectField(TEXT("output"), OutputObj) && OutputObj && OutputObj->IsValid())
-				{
-					for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*OutputObj)->Values)
-					{
-						CollectUrisFromJsonValue(Pair.Value);
-					}
-				}
-				else
-				{
-					FString OutputStr;
-					if (FinalObj->TryGetStringField(TEXT("output"), OutputStr) &&
-						(OutputStr.StartsWith(TEXT("http://")) || OutputStr.StartsWith(TEXT("https://"))))
-					{
-						OutputUris.AddUnique(OutputStr);
-					}
-				}
-			}
-		}
+	ActiveReplicatePredictions.Add(ToolCallId, PredictionId);
+}
 
-		// As a fallback, scan the entire response object for HTTPS URLs if we didn't find any in 'output'.
-		if (OutputUris.Num() == 0)
-		{
-			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : FinalObj->Values)
-			{
-				CollectUrisFromJsonValue(Pair.Value);
-			}
-		}
+void UUnrealGPTAgentClient::StartReflectionQuery(uint32 BatchId, const FString& ToolCallId, const FString& ArgumentsJson)
+{
+	const TWeakObjectPtr<UUnrealGPTAgentClient> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, BatchId, ToolCallId, ArgumentsJson]()
+	{
+		// Native classes are answered from the snapshot here; Blueprint and late-loaded classes need the live path.
+		FString SnapshotResult;
+		const bool bAnswered = FUnrealGPTReflectionQuery::TryQuerySnapshot(ArgumentsJson, SnapshotResult);
 
-		// Helper to map output kind to a staging subfolder.
-		auto GetReplicateStagingFolder = [](const FString& Kind) -> FString
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, BatchId, ToolCallId, ArgumentsJson, bAnswered, SnapshotResult]()
 		{
-			const FString BasePath = FPaths::ProjectContentDir() / TEXT("UnrealGPT/Generated");
-			const FString K = Kind.ToLower();
-
-			if (K == TEXT("image"))
-			{
-				return BasePath / TEXT("Images");
-			}
-			if (K == TEXT("audio"))
-			{
-				return BasePath / TEXT("Audio");
-			}
-			if (K == TEXT("video"))
-			{
-				return BasePath / TEXT("Video");
-			}
-			if (K == TEXT("3d") || K == TEXT("3d_model") || K == TEXT("model") || K == TEXT("mesh"))
+			UUnrealGPTAgentClient* Client = WeakThis.Get();
+			if (!Client || BatchId != Client->AsyncToolBatchId)
 			{
-				return BasePath / TEXT("Models");
+				return;
 			}
 
-			return BasePath / TEXT("Misc");
-		};
+			const FString ToolResult = bAnswered
+				? SnapshotResult
+				: Client->ExecuteToolCall(ToolCallId, TEXT("reflection_query"), ArgumentsJson);
+			Client->CompleteAsyncToolCall(BatchId, ToolCallId, TEXT("reflection_query"), ToolResult);
+		});
+	});
+}
 
-		// Helper to download a file from URL to a staging folder.
-		auto DownloadReplicateFile = [&](const FString& Uri, const FString& Kind) -> FString
-		{
-			TArray<uint8> Content;
+uint32 UUnrealGPTAgentClient::ResetAsyncToolBatch()
+{
+	// Moving to a new batch id drops whatever tools of the previous batch report later.
+	PendingAsyncToolCount = 0;
+	++AsyncToolBatchId;
 
-			// Try HTTP download.
-			TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-			Request->SetURL(Uri);
-			Request->SetVerb(TEXT("GET"));
-			// Replicate file URLs may require the same Bearer token.
-			Request->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Settings->ReplicateApiToken));
+	TArray<uint32> PredictionIds;
+	ActiveReplicatePredictions.GenerateValueArray(PredictionIds);
+	ActiveReplicatePredictions.Reset();
+	for (const uint32 PredictionId : PredictionIds)
+	{
+		FUnrealGPTReplicateClient::Get().Cancel(PredictionId);
+	}
 
-			bool bComplete = false;
+	return AsyncToolBatchId;
+}
 
-			Request->OnProcessRequestComplete().BindLambda(
-				[&](FHttpRequestPtr Req, FHttpResponsePtr Res, bool bSuccess)
-				{
-					if (bSuccess && Res.IsValid() && Res->GetResponseCode() == 200)
-					{
-						Content = Res->GetContent();
-					}
-					bComplete = true;
-				});
+void UUnrealGPTAgentClient::CompleteAsyncToolCall(uint32 BatchId, const FString& ToolCallId, const FString& ToolName, const FString& ToolResult)
+{
+	if (BatchId != AsyncToolBatchId)
+	{
+		UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Ignoring %s result for canceled tool call %s"), *ToolName, *ToolCallId);
+		return;
+	}
 
-			Request->ProcessRequest();
+	FString ToolResultForHistory = ToolResult;
+	if (ToolResultForHistory.Len() > MaxToolResultSize)
+	{
+		ToolResultForHistory = ToolResultForHistory.Left(MaxToolResultSize) +
+			TEXT("\n\n[Result truncated - original length: ") + FString::FromInt(ToolResult.Len()) +
+			TEXT(" characters. Full result available in tool output.]");
+	}
 
-			const double StartTime = FPlatformTime::Seconds();
-			while (!bComplete)
-			{
-				FPlatformProcess::Sleep(0.01f);
-				if (FPlatformTime::Seconds() - StartTime > 120.0)
-				{
-					Request->CancelRequest();
-					break;
-				}
-			}
+	FAgentMessage ToolMsg;
+	ToolMsg.Role = TEXT("tool");
+	ToolMsg.ToolCallId = ToolCallId;
+	ToolMsg.Content = ToolResultForHistory;
+	ConversationHistory.Add(ToolMsg);
 
-			if (Content.Num() == 0)
-			{
-				return FString();
-			}
+	OnToolResult.Broadcast(ToolCallId, ToolResult);
 
-			FString Ext = FPaths::GetExtension(Uri);
-			if (Ext.IsEmpty())
-			{
-				Ext = TEXT("dat");
-			}
+	PendingAsyncToolCount = FMath::Max(0, PendingAsyncToolCount - 1);
+	if (PendingAsyncToolCount > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("UnrealGPT: %s finished; waiting for %d more async tool call(s)"), *ToolName, PendingAsyncToolCount);
+		return;
+	}
+
+	// Continue conversation once every async tool of the batch has reported.
+	SendMessage(TEXT(""), TArray<FString>());
+}
 
-			const FString Filename = FGuid::NewGuid().ToString() + TEXT(".") + Ext;
-			const FString SavePath = GetReplicateStagingFolder(Kind) / Filename;
+FString UUnrealGPTAgentClient::ExecuteToolCall(const FString& ToolCallId, const FString& ToolName, const FString& ArgumentsJson)
+{
+	FString Result;
 
-			if (FFileHelper::SaveArrayToFile(Content, *SavePath))
-			{
-				return SavePath;
-			}
+	const bool bIsPythonExecute = (ToolName == TEXT("python_execute"));
+	const bool bIsSceneQuery = (ToolName == TEXT("scene_query"));
 
-			return FString();
-		};
+	// Buffer errors logged while this tool runs; they are attached to the result below.
+	int32 LogSubscriptionId = INDEX_NONE;
+	if (ShouldAttachLogDigest(ToolName))
+	{
+		FUnrealGPTLogSubscriptionFilter LogFilter;
+		LogFilter.MinVerbosity = ELogVerbosity::Error;
+		LogFilter.MaxBufferedLines = 10;
+		LogSubscriptionId = FUnrealGPTLogCapture::Get().Subscribe(LogFilter);
+	}
 
-		// 4) Download any output files and build result JSON.
-		TArray<TSharedPtr<FJsonValue>> FilesArray;
-		for (const FString& Uri : OutputUris)
+	if (bIsPythonExecute)
+	{
+		TSharedPtr<FJsonObject> ArgsObj;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
+		if (FJsonSerializer::Deserialize(Reader, ArgsObj) && ArgsObj.IsValid())
 		{
-			const FString LocalPath = DownloadReplicateFile(Uri, OutputKind);
-			if (!LocalPath.IsEmpty())
+			FString Code;
+			if (ArgsObj->TryGetStringField(TEXT("code"), Code))
 			{
-				TSharedPtr<FJsonObject> FileObj = MakeShareable(new FJsonObject);
-				const FString Ext = FPaths::GetExtension(LocalPath).ToLower();
-				FString MimeType = Ext;
-				if (Ext == TEXT("png")) MimeType = TEXT("image/png");
-				else if (Ext == TEXT("jpg") || Ext == TEXT("jpeg")) MimeType = TEXT("image/jpeg");
-				else if (Ext == TEXT("wav")) MimeType = TEXT("audio/wav");
-				else if (Ext == TEXT("mp3")) MimeType = TEXT("audio/mpeg");
-				else if (Ext == TEXT("fbx")) MimeType = TEXT("model/fbx");
-				else if (Ext == TEXT("glb")) MimeType = TEXT("model/gltf-binary");
-
-				FString InferredUsage = TEXT("file");
-				if (MimeType.StartsWith(TEXT("image/"))) InferredUsage = TEXT("image");
-				else if (MimeType.StartsWith(TEXT("audio/"))) InferredUsage = TEXT("audio");
-				else if (MimeType.StartsWith(TEXT("video/"))) InferredUsage = TEXT("video");
-				else if (OutputKind == TEXT("3d") || OutputKind == TEXT("3d_model") || OutputKind == TEXT("model") || OutputKind == TEXT("mesh")) InferredUsage = TEXT("3d_model");
-				else if (OutputKind == TEXT("image")) InferredUsage = TEXT("image");
-				else if (OutputKind == TEXT("audio")) InferredUsage = TEXT("audio");
-				else if (OutputKind == TEXT("video")) InferredUsage = TEXT("video");
-
-				FileObj->SetStringField(TEXT("local_path"), LocalPath);
-				FileObj->SetStringField(TEXT("mime_type"), MimeType);
-				FileObj->SetStringField(TEXT("inferred_usage"), InferredUsage);
-				FileObj->SetStringField(TEXT("description"), TEXT("Downloaded output from Replicate prediction"));
-				FilesArray.Add(MakeShareable(new FJsonValueObject(FileObj)));
+				bool bProfile = false;
+				int32 ProfileTopN = 15;
+				bool bCountUnrealCalls = false;
+				ArgsObj->TryGetBoolField(TEXT("profile"), bProfile);
+				ArgsObj->TryGetNumberField(TEXT("profile_top"), ProfileTopN);
+				ArgsObj->TryGetBoolField(TEXT("count_unreal_calls"), bCountUnrealCalls);
+				Result = ExecutePythonCode(Code, bProfile, ProfileTopN, bCountUnrealCalls);
 			}
 		}
-
-		TSharedPtr<FJsonObject> ResultObj = MakeShareable(new FJsonObject);
-		ResultObj->SetStringField(TEXT("status"), TEXT("success"));
-
-		const int32 NumFiles = FilesArray.Num();
-		ResultObj->SetStringField(
-			TEXT("message"),
-			FString::Printf(TEXT("Replicate prediction succeeded with %d downloaded file(s)."), NumFiles));
-
-		TSharedPtr<FJsonObject> DetailsObj = MakeShareable(new FJsonObject);
-		DetailsObj->SetStringField(TEXT("provider"), TEXT("replicate"));
-		DetailsObj->SetStringField(TEXT("output_kind"), OutputKind);
-		DetailsObj->SetArrayField(TEXT("files"), FilesArray);
-
-		ResultObj->SetObjectField(TEXT("details"), DetailsObj);
-
-		FString ResultJsonString;
+	}
+	// else if (ToolName == TEXT("computer_use"))
+	// {
+	// 	TSharedPtr<FJsonObject> ArgsObj;
+	// 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
+	// 	if (FJsonSerializer::Deserialize(Reader, ArgsObj) && ArgsObj.IsValid())
+	// 	{
+	// 		FString Action;
+	// 		if (ArgsObj->TryGetStringField(TEXT("action"), Action))
+	// 		{
+	// 			Result = ExecuteComputerUse(Action);
+	// 		}
+	// 	}
+	// }
+	else if (ToolName == TEXT("viewport_screenshot"))
+	{
+		Result = GetViewportScreenshot();
+	}
+	else if (ToolName == TEXT("scene_query"))
+	{
+		// Pass the raw JSON arguments through to the scene query helper.
+		// The JSON can specify filters like class_contains, label_contains,
+		// name_contains, component_class_contains, and max_results.
+		Result = UUnrealGPTSceneContext::QueryScene(ArgumentsJson);
+		
+		// Check if scene_query returned results (non-empty JSON array).
+		// If it did, mark that we found results so we can block subsequent python_execute calls.
+		// scene_query returns a JSON array string, so check if it's not just "[]"
+		bLastSceneQueryFoundResults = !Result.IsEmpty() && Result != TEXT("[]") && Result.StartsWith(TEXT("["));
+		if (bLastSceneQueryFoundResults)
 		{
-			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultJsonString);
-			FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
+			// Try to parse and verify it's actually a non-empty array
+			TSharedPtr<FJsonValue> JsonValue;
+			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result);
+			if (FJsonSerializer::Deserialize(Reader, JsonValue) && JsonValue.IsValid())
+			{
+				const TArray<TSharedPtr<FJsonValue>>* JsonArray = nullptr;
+				if (JsonValue->Type == EJson::Array && JsonValue->TryGetArray(JsonArray))
+				{
+					bLastSceneQueryFoundResults = (JsonArray->Num() > 0);
+					if (bLastSceneQueryFoundResults)
+					{
+						UE_LOG(LogTemp, Log, TEXT("UnrealGPT: scene_query found %d results - will block subsequent python_execute"), JsonArray->Num());
+					}
+				}
+				else
+				{
+					bLastSceneQueryFoundResults = false;
+				}
+			}
+			else
+			{
+				bLastSceneQueryFoundResults = false;
+			}
 		}
-
-		Result = ResultJsonString;
+	}
+	else if (ToolName == TEXT("reflection_query"))
+	{
+		Result = FUnrealGPTReflectionQuery::Query(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("reflection_search"))
+	{
+		Result = FUnrealGPTReflectionSearch::Query(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("read_log"))
+	{
+		Result = FUnrealGPTLogReader::Query(ArgumentsJson);
+	}
+	// New atomic editor tools
+	else if (ToolName == TEXT("get_actor"))
+	{
+		Result = UUnrealGPTSceneContext::GetActor(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("set_actor_transform"))
+	{
+		Result = UUnrealGPTSceneContext::SetActorTransform(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("set_actors_rotation"))
+	{
+		Result = UUnrealGPTSceneContext::SetActorsRotation(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("select_actors"))
+	{
+		Result = UUnrealGPTSceneContext::SelectActors(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("duplicate_actor"))
+	{
+		Result = UUnrealGPTSceneContext::DuplicateActor(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("snap_actor_to_ground"))
+	{
+		Result = UUnrealGPTSceneContext::SnapActorToGround(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_query"))
+	{
+		Result = UUnrealGPTBlueprintContext::Query(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_create"))
+	{
+		Result = UUnrealGPTBlueprintContext::Create(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_add_variable"))
+	{
+		Result = UUnrealGPTBlueprintContext::AddVariable(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_compile"))
+	{
+		Result = UUnrealGPTBlueprintContext::Compile(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_search_nodes"))
+	{
+		Result = UUnrealGPTBlueprintContext::SearchNodes(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_add_node"))
+	{
+		Result = UUnrealGPTBlueprintContext::AddNode(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_connect_pins"))
+	{
+		Result = UUnrealGPTBlueprintContext::ConnectPins(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_remove_node"))
+	{
+		Result = UUnrealGPTBlueprintContext::RemoveNode(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_set_pin_default"))
+	{
+		Result = UUnrealGPTBlueprintContext::SetPinDefault(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_compile_batch"))
+	{
+		Result = UUnrealGPTBlueprintContext::CompileBatch(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("blueprint_apply_edits"))
+	{
+		Result = UUnrealGPTBlueprintContext::ApplyEdits(ArgumentsJson);
+	}
+	else if (ToolName == TEXT("replicate_generate"))
+	{
+		// Predictions run through StartReplicateGeneration so nothing waits on Replicate.
+		Result = MakeReplicateError(TEXT("replicate_generate runs asynchronously and cannot be executed inline"));
 	}
 	else if (ToolName == TEXT("mcp_list_tools"))
 	{
@@ -3465,6 +3702,15 @@ FString UUnrealGPTAgentClient::ExecuteToolCall(const FString& ToolCallId, const
 		Result = FString::Printf(TEXT("Unknown tool: %s"), *ToolName);
 	}
 
+	if (LogSubscriptionId != INDEX_NONE)
+	{
+		const FUnrealGPTLogSubscriptionResult NewErrors = FUnrealGPTLogCapture::Get().Unsubscribe(LogSubscriptionId);
+		if (NewErrors.TotalMatched > 0)
+		{
+			AttachLogDigest(Result, NewErrors);
+		}
+	}
+
 	// Track last tool type so we can avoid repeated python_execute runs.
 	bLastToolWasPythonExecute = bIsPythonExecute;
 	
@@ -3493,87 +3739,17 @@ FString UUnrealGPTAgentClient::ExecuteToolCall(const FString& ToolCallId, const
 	return Result;
 }
 
-// Helper to indent arbitrary Python source one level (4 spaces), preserving empty lines.
-static FString IndentPythonCode(const FString& Code)
+FString UUnrealGPTAgentClient::ExecutePythonCode(const FString& Code, bool bProfile, int32 ProfileTopN, bool bCountUnrealCalls)
 {
-	FString Indented;
-	TArray<FString> Lines;
-	Code.ParseIntoArrayLines(Lines);
-
-	for (const FString& Line : Lines)
-	{
-		if (Line.TrimStartAndEnd().IsEmpty())
-		{
-			Indented += TEXT("    \n");
-		}
-		else
-		{
-			Indented += TEXT("    ") + Line + TEXT("\n");
-		}
-	}
-
-	return Indented;
-}
-
-FString UUnrealGPTAgentClient::ExecutePythonCode(const FString& Code)
-{
-	if (!IPythonScriptPlugin::Get()->IsPythonAvailable())
-	{
-		return TEXT("Error: Python is not available in this Unreal Engine installation");
-	}
-
-	// Use a deterministic result file the Python wrapper can write to.
-	const FString ResultFilePath = FPaths::ConvertRelativePathToFull(
-		FPaths::ProjectSavedDir() / TEXT("UnrealGPT_PythonResult.json"));
-
-	// Clear any previous result.
-	IFileManager::Get().Delete(*ResultFilePath, /*RequireExists=*/false, /*EvenIfReadOnly=*/true);
-
-	const FString IndentedUserCode = IndentPythonCode(Code);
-
-	// Build a small wrapper that:
-	// - defines a default JSON-serializable `result` dict,
-	// - runs the user code inside try/except (where the code can modify `result`),
-	// - writes the final `result` to ResultFilePath as JSON.
-	FString WrappedCode;
-	WrappedCode += TEXT("import json, traceback, os\n");
-	WrappedCode += TEXT("import unreal\n");
-	WrappedCode += TEXT("result = {\n");
-	WrappedCode += TEXT("    \"status\": \"ok\",\n");
-	WrappedCode += TEXT("    \"message\": \"Python code executed. No custom result message was set.\",\n");
-	WrappedCode += TEXT("    \"details\": {}\n");
-	WrappedCode += TEXT("}\n\n");
-	WrappedCode += TEXT("try:\n");
-	WrappedCode += IndentedUserCode;
-	WrappedCode += TEXT("except Exception as e:\n");
-	WrappedCode += TEXT("    result[\"status\"] = \"error\"\n");
-	WrappedCode += TEXT("    result[\"message\"] = str(e)\n");
-	WrappedCode += TEXT("    result[\"details\"][\"traceback\"] = traceback.format_exc()\n\n");
-
-	const FString EscapedPath = ResultFilePath.ReplaceCharWithEscapedChar();
-	WrappedCode += TEXT("result_path = \"") + EscapedPath + TEXT("\"\n");
-	WrappedCode += TEXT("with open(result_path, \"w\", encoding=\"utf-8\") as f:\n");
-	WrappedCode += TEXT("    f.write(json.dumps(result))\n");
-
-	IPythonScriptPlugin::Get()->ExecPythonCommand(*WrappedCode);
-
-	// Try to read the JSON result back from disk so the agent can reason about it.
-	FString ResultJson;
-	if (FPaths::FileExists(ResultFilePath))
-	{
-		if (FFileHelper::LoadFileToString(ResultJson, *ResultFilePath))
-		{
-			// Try to focus viewport on the last created asset
-			FocusViewportOnCreatedAsset(ResultJson);
-			return ResultJson;
-		}
-	}
-
-	// Fallback if no structured result was produced.
-	return TEXT(
-		"Python code was sent to the Unreal Editor for execution, but no structured result JSON "
-		"was produced. The script may have succeeded or failed; check the Unreal Python log for "
-		"details, and consider writing to the shared `result` dict for future runs.");
+	FUnrealGPTPythonRunner::FOptions Options;
+	Options.bProfile = bProfile;
+	Options.ProfileTopN = FMath::Clamp(ProfileTopN, 1, 50);
+	Options.bCountUnrealCalls = bCountUnrealCalls;
+	const FString ResultJson = FUnrealGPTPythonRunner::Execute(Code, Options);
+
+	// Try to focus viewport on the last created asset
+	FocusViewportOnCreatedAsset(ResultJson);
+	return ResultJson;
 }
 
 // FString UUnrealGPTAgentClient::ExecuteComputerUse(const FString& ActionJson)
@@ -3739,77 +3915,28 @@ bool UUnrealGPTAgentClient::RefreshCodexAuthAndRetry(const FString& RequestBody)
 
 	PendingCodexRefreshRetryBody = RequestBody;
 
-	const FString RequestForm = FString::Printf(
-		TEXT("grant_type=refresh_token&refresh_token=%s&client_id=%s"),
-		*FGenericPlatformHttp::UrlEncode(RefreshToken),
-		*FGenericPlatformHttp::UrlEncode(TEXT("app_EMoamEEZ73f0CkXaXp7hrann")));
-
-	TSharedRef<IHttpRequest> RefreshRequest = CreateHttpRequest();
-	RefreshRequest->SetURL(TEXT("https://auth.openai.com/oauth/token"));
-	RefreshRequest->SetVerb(TEXT("POST"));
-	RefreshRequest->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
-	RefreshRequest->SetContentAsString(RequestForm);
-	RefreshRequest->OnProcessRequestComplete().BindUObject(this, &UUnrealGPTAgentClient::OnCodexAuthRefreshResponse);
-
 	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Refreshing Codex auth after 401"));
 	bRequestInProgress = true;
-	RefreshRequest->ProcessRequest();
+	const uint32 RefreshId = ++CodexRefreshId;
+	TWeakObjectPtr<UUnrealGPTAgentClient> WeakThis(this);
+	FUnrealGPTCodexAuth::Get().RefreshTokens([WeakThis, RefreshId](bool bSuccess, const FString& Error)
+	{
+		UUnrealGPTAgentClient* This = WeakThis.Get();
+		if (This && This->CodexRefreshId == RefreshId)
+		{
+			This->OnCodexAuthRefreshed(bSuccess, Error);
+		}
+	});
 	return true;
 }
 
-void UUnrealGPTAgentClient::OnCodexAuthRefreshResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+void UUnrealGPTAgentClient::OnCodexAuthRefreshed(bool bSuccess, const FString& Error)
 {
 	bRequestInProgress = false;
 
-	if (!bWasSuccessful || !Response.IsValid())
-	{
-		OnAgentMessage.Broadcast(TEXT("system"), TEXT("Error: Codex auth refresh failed. Please use Codex Login again."), TArray<FString>());
-		PendingCodexRefreshRetryBody.Empty();
-		return;
-	}
-
-	const int32 ResponseCode = Response->GetResponseCode();
-	const FString ResponseBody = Response->GetContentAsString();
-	if (ResponseCode < 200 || ResponseCode >= 300)
-	{
-		UE_LOG(LogTemp, Error, TEXT("UnrealGPT: Codex auth refresh failed %d: %s"), ResponseCode, *ResponseBody);
-		OnAgentMessage.Broadcast(TEXT("system"), FString::Printf(TEXT("Error: Codex auth refresh failed. Please use Codex Login again. HTTP %d"), ResponseCode), TArray<FString>());
-		PendingCodexRefreshRetryBody.Empty();
-		return;
-	}
-
-	TSharedPtr<FJsonObject> ResponseJson;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseBody);
-	if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-	{
-		OnAgentMessage.Broadcast(TEXT("system"), TEXT("Error: Codex auth refresh returned invalid JSON. Please use Codex Login again."), TArray<FString>());
-		PendingCodexRefreshRetryBody.Empty();
-		return;
-	}
-
-	FString IdToken;
-	FString AccessToken;
-	FString RefreshToken;
-	ResponseJson->TryGetStringField(TEXT("id_token"), IdToken);
-	ResponseJson->TryGetStringField(TEXT("access_token"), AccessToken);
-	ResponseJson->TryGetStringField(TEXT("refresh_token"), RefreshToken);
-	if (RefreshToken.IsEmpty())
-	{
-		FString ExistingRefreshToken;
-		FString RefreshError;
-		if (UUnrealGPTSettings* SafeSettings = GetMutableDefault<UUnrealGPTSettings>())
-		{
-			SafeSettings->GetCodexRefreshToken(ExistingRefreshToken, RefreshError);
-		}
-		RefreshToken = ExistingRefreshToken;
-	}
-
-	FString SaveError;
-	UUnrealGPTSettings* SafeSettings = GetMutableDefault<UUnrealGPTSettings>();
-	if (!SafeSettings || IdToken.IsEmpty() || AccessToken.IsEmpty() || RefreshToken.IsEmpty() || !SafeSettings->SaveCodexChatGPTAuth(IdToken, AccessToken, RefreshToken, SaveError))
+	if (!bSuccess)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UnrealGPT: Codex auth refresh could not be saved: %s"), *SaveError);
-		OnAgentMessage.Broadcast(TEXT("system"), TEXT("Error: Codex auth refresh could not be saved. Please use Codex Login again."), TArray<FString>());
+		OnAgentMessage.Broadcast(TEXT("system"), FString::Printf(TEXT("Error: %s"), *Error), TArray<FString>());
 		PendingCodexRefreshRetryBody.Empty();
 		return;
 	}
@@ -3833,7 +3960,7 @@ void UUnrealGPTAgentClient::OnCodexAuthRefreshResponse(FHttpRequestPtr Request,
 
 	RetryRequest->SetContentAsString(PendingCodexRefreshRetryBody);
 	PendingCodexRefreshRetryBody.Empty();
-	RetryRequest->OnProcessRequestComplete().BindUObject(this, &UUnrealGPTAgentClient::OnResponseReceived);
+	BindResponseHandlers(RetryRequest);
 
 	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Retrying request after Codex auth refresh"));
 	bRequestInProgress = true;
@@ -9,6 +9,7 @@
 #include "UnrealGPTAgentClient.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAgentMessage, const FString&, Role, const FString&, Content, const TArray<FString>&, ToolCalls);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAgentMessageDelta, const FString&, Delta);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAgentReasoning, const FString&, ReasoningContent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnToolCall, const FString&, ToolCallId, const FString&, ToolName, const FString&, Arguments);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnToolResult, const FString&, ToolCallId, const FString&, Result);
@@ -82,6 +83,10 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FOnAgentMessage OnAgentMessage;
 
+	/** Delegate for assistant text as it arrives, on the game thread; OnAgentMessage still carries the full text afterwards */
+	UPROPERTY(BlueprintAssignable)
+	FOnAgentMessageDelta OnAgentMessageDelta;
+
 	/** Delegate for reasoning updates */
 	UPROPERTY(BlueprintAssignable)
 	FOnAgentReasoning OnAgentReasoning;
@@ -101,6 +106,12 @@ private:
 	/** Handle HTTP response */
 	void OnResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 
+	/** Make Request the one in flight: stream its body through ResponseStream and bind OnResponseReceived. */
+	void BindResponseHandlers(const TSharedRef<IHttpRequest>& Request);
+
+	/** Assistant text carried by one SSE event of a Chat Completions or Responses API stream. */
+	static bool GetStreamTextDelta(const FString& EventData, FString& OutDelta);
+
 	/** Process streaming response */
 	void ProcessStreamingResponse(const FString& ResponseContent);
 
@@ -116,8 +127,26 @@ private:
 	/** Clear any pending clarify state without continuing the loop */
 	void ClearPendingClarify();
 
-	/** Execute Python code */
-	FString ExecutePythonCode(const FString& Code);
+	/** Parse replicate_generate arguments into the predictions endpoint and request body; OutError is a tool result */
+	bool BuildReplicateRequest(const FString& ArgumentsJson, FString& OutApiUrl, FString& OutRequestBody, FString& OutOutputKind, FString& OutError) const;
+
+	/** Start a Replicate prediction for a replicate_generate call; its result arrives through CompleteAsyncToolCall */
+	void StartReplicateGeneration(uint32 BatchId, const FString& ToolCallId, const FString& ArgumentsJson);
+
+	/** Answer a reflection_query from the snapshot on a worker thread, falling back to the live query on the game thread */
+	void StartReflectionQuery(uint32 BatchId, const FString& ToolCallId, const FString& ArgumentsJson);
+
+	/** Start a new batch of async tool calls, dropping and canceling whatever the previous batch still runs */
+	uint32 ResetAsyncToolBatch();
+
+	/**
+	 * Record an async tool result and continue the agent loop once the last pending one of its batch is in.
+	 * Results from a batch that was canceled or superseded are ignored.
+	 */
+	void CompleteAsyncToolCall(uint32 BatchId, const FString& ToolCallId, const FString& ToolName, const FString& ToolResult);
+
+	/** Execute Python code; bProfile runs it under cProfile and reports the ProfileTopN hottest functions, bCountUnrealCalls only counts unreal.* calls */
+	FString ExecutePythonCode(const FString& Code, bool bProfile = false, int32 ProfileTopN = 15, bool bCountUnrealCalls = false);
 
 	// /** Execute Computer Use action */
 	// FString ExecuteComputerUse(const FString& ActionJson);
@@ -140,7 +169,7 @@ private:
 	/** Refresh Codex ChatGPT auth and retry the cached request once. */
 	bool RefreshCodexAuthAndRetry(const FString& RequestBody);
 
-	void OnCodexAuthRefreshResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+	void OnCodexAuthRefreshed(bool bSuccess, const FString& Error);
 
 	/** Get the effective API URL, applying base URL override if set */
 	FString GetEffectiveApiUrl() const;
@@ -157,6 +186,12 @@ private:
 	/** Current HTTP request */
 	TSharedPtr<IHttpRequest> CurrentRequest;
 
+	/** Body of CurrentRequest as it arrives; text deltas are broadcast from it before the response completes. */
+	TSharedPtr<class FUnrealGPTSseBodyStream> ResponseStream;
+
+	/** Bumped when a response completes or is canceled, so deltas still queued for the game thread are dropped. */
+	uint32 ResponseStreamId = 0;
+
 	/** Conversation history */
 	TArray<FAgentMessage> ConversationHistory;
 
@@ -172,6 +207,9 @@ private:
 	 */
 	static constexpr int32 MaxToolResultSize = 10000; // ~10KB
 
+	/** SendMessage refreshes a Codex ChatGPT access token first when it expires within this many seconds. */
+	static constexpr double CodexAuthExpiryMarginSeconds = 60.0;
+
 	/** Signatures of tool calls that have already been executed in this conversation.
 	 *  Used to avoid re-running identical python_execute calls in a loop.
 	 */
@@ -204,9 +242,20 @@ private:
 
 	FString PendingCodexRefreshRetryBody;
 	bool bHasRetriedAfterCodexRefresh = false;
+	/** Set while SendMessage waits on a pre-send token refresh, so the resent message skips the expiry check. */
+	bool bCodexAuthRefreshedForSend = false;
+	/** Bumped per token refresh and by CancelRequest; a refresh callback whose id is stale does nothing. */
+	uint32 CodexRefreshId = 0;
 
 	/** Pending clarify tool call awaiting user input */
 	FString PendingClarifyCallId;
 	bool bAwaitingClarifyResponse = false;
+
+	/** Current batch of async tool calls (replicate_generate, mcp_call, mcp_read_resource, reflection_query); bumped per batch and on cancel */
+	uint32 AsyncToolBatchId = 0;
+	/** Async tool calls of the current batch that have not reported yet */
+	int32 PendingAsyncToolCount = 0;
+	/** Replicate client prediction ids by tool call id, so CancelRequest can stop them */
+	TMap<FString, uint32> ActiveReplicatePredictions;
 };
 
@@ -25,26 +25,32 @@ FString UnrealGPTAgentInstructions::GetInstructions(const FString& EngineVersion
 		"  - 'blueprint_query': Read graphs, nodes, pins, connections, variables, components, and compile status\n"
 		"  - 'blueprint_create': Create a new Actor Blueprint asset\n"
 		"  - 'blueprint_add_variable': Add a member variable (types: bool, int, float, string, name, text, vector, rotator, transform, object, class)\n"
-		"  - 'blueprint_add_node': Add a K2 node — supported node_type values: Event, CallFunction, VariableGet, VariableSet, CustomEvent, Branch, Sequence, Self, PrintString\n"
+		"  - 'blueprint_search_nodes': Find any palette node (math, casts, ForEach/macros, switches, timelines) and get its action_id\n"
+		"  - 'blueprint_add_node': Add a K2 node — node_type Event, CallFunction, VariableGet, VariableSet, CustomEvent, Branch, Sequence, Self, PrintString, or Action with params.action_id for anything else\n"
 		"  - 'blueprint_connect_pins': Wire pins using node_guid + pin names from blueprint_query (never guess GUIDs)\n"
 		"  - 'blueprint_remove_node': Remove a node by GUID\n"
 		"  - 'blueprint_set_pin_default': Set a pin default/literal value (e.g. PrintString InString)\n"
-		"  - 'blueprint_compile': Compile and check for errors\n"
+		"  - 'blueprint_compile': Compile and check for errors; failures list 'diagnostics' with the node_guid and pin_name at fault, so fix those directly instead of calling read_log\n"
+		"  - 'blueprint_compile_batch': Recompile many Blueprints at once — pass dependency_root after changing a shared parent Blueprint, struct or enum\n"
+		"  - 'blueprint_apply_edits': Several of the edits above in one undoable call; give add_node ops an 'id' and reference it as from_node/to_node/node in later ops\n"
 		"Do NOT use python_execute to add/connect Blueprint nodes or edit event graphs — the native tools are the correct path.\n"
 		"Use 'python_execute' for level/scene work, materials, asset import, Content Browser batch ops, and other editor subsystems not covered by atomic tools.\n\n"
 
 		"BLUEPRINT EDITING WORKFLOW (follow this every time):\n"
-		"1. blueprint_query the target asset_path (use graph_name only when editing a non-default graph). Set include_pins=true before connecting or editing pins.\n"
+		"1. blueprint_query the target asset_path (use graph_name only when editing a non-default graph). Set include_pins=true before connecting or editing pins. For large graphs pass format=\"compact\" so the whole graph fits in one result.\n"
 		"2. If the asset does not exist, blueprint_create it first (default parent_class: /Script/Engine.Actor).\n"
 		"3. Add variables with blueprint_add_variable before VariableGet/VariableSet nodes that reference them.\n"
-		"4. Add nodes with blueprint_add_node; store each returned node_guid from the tool result details.\n"
+		"4. Add nodes with blueprint_add_node; store each returned node_guid from the tool result details. Do not pick coordinates — new nodes are laid out automatically.\n"
 		"   - Event nodes: params.event_name = ReceiveBeginPlay | ReceiveTick | ReceiveEndPlay\n"
 		"   - CallFunction nodes: params.function_name + params.target_class (e.g. /Script/Engine.KismetSystemLibrary PrintString)\n"
 		"   - VariableGet/VariableSet: params.variable_name\n"
 		"   - CustomEvent: params.event_name\n"
+		"   - Action: params.action_id from blueprint_search_nodes (never fall back to python_execute for nodes missing from this list)\n"
 		"5. blueprint_connect_pins using from_node_guid, from_pin, to_node_guid, to_pin from blueprint_query pin names (common exec pins: then, execute).\n"
 		"6. blueprint_set_pin_default for literal inputs that are not wired (e.g. PrintString InString).\n"
 		"7. blueprint_compile, then blueprint_query again to verify nodes, connections, and compile_status.\n"
+		"   Every blueprint_query returns a 'revision'. When re-querying an asset you already read, pass it as since_revision to receive only changed_nodes/removed_nodes instead of the whole graph.\n"
+		"When steps 3-7 are known up front, send them as one blueprint_apply_edits call with compile=true instead of one tool call per edit; an atomic batch that fails is undone, so fix the reported op and resend the whole list.\n"
 		"8. Only after the Blueprint compiles cleanly, use python_execute to spawn actors from the asset or scene_query to verify level instances.\n"
 		"When the user attaches a Blueprint asset, use its object_path as asset_path in blueprint tools immediately — do not fall back to Python for graph inspection.\n"
 		"Use reflection_query for UClass member introspection (callable functions, properties); use blueprint_query for graph topology.\n\n"
@@ -74,7 +80,8 @@ FString UnrealGPTAgentInstructions::GetInstructions(const FString& EngineVersion
 		" - You can set 'result[\"status\"]' (e.g., 'ok' or 'error'), 'result[\"message\"]', and add rich details under 'result[\"details\"]' (such as asset paths, actor counts, or custom flags).\n"
 		" - When creating actors or assets, include 'result[\"details\"][\"actor_name\"]' or 'result[\"details\"][\"actor_label\"]' to enable automatic viewport focusing on the created object.\n"
 		" - If an exception is raised, the wrapper automatically sets 'status' to 'error' and includes a traceback; you should read this JSON to decide what to do next.\n"
-		" - If python_execute returns an error, ambiguous result, or no structured JSON, call 'read_log' next with category='LogPython' or contains='Traceback' to inspect editor logs.\n"
+		" - Errors logged while python_execute, blueprint_* or actor edit tools run are attached to their result as 'new_log_errors'; read those first instead of calling read_log.\n"
+		" - If python_execute returns an error, ambiguous result, or no structured JSON and 'new_log_errors' is absent or insufficient, call 'read_log' next with category='LogPython' or contains='Traceback' to inspect editor logs.\n"
 		"Use both the JSON result and scene_query / viewport_screenshot to determine whether a step truly succeeded before moving on.\n"
 		"For log inspection, prefer min_verbosity='warning' unless you need verbose output. Use mode='since_last_read' when polling logs across retries. Do not call read_log repeatedly with identical arguments.\n"
 
@@ -133,8 +140,10 @@ FString UnrealGPTAgentInstructions::GetInstructions(const FString& EngineVersion
 
 		"You can also use the 'file_search' tool to search the attached UE %s Python API docs vector store for information on how to use the Python API. Prefer the 'file_search' tool to search for information on how to use the Python API, not the 'web_search' tool.\n"
 		"When you need to know exactly what reflected C++ or Blueprint class members exist, use 'reflection_query'. "
+		"When you know what a member should do but not its class or name, use 'reflection_search' first; it is local and faster than file_search for API discovery. "
 		"When you need graph structure (nodes, pins, connections, variables), use 'blueprint_query'. "
-		"Pass member_contains to look up a specific property/function, and only set include_super=true when you need inherited base-class members.\n"
+		"Pass member_contains to look up a specific property/function, and only set include_super=true when you need inherited base-class members. "
+		"To inspect several classes, pass them together in one reflection_query 'classes' list instead of making one call per class.\n"
 		"Check level tasks with scene_query/viewport_screenshot; check Blueprint tasks with blueprint_compile + blueprint_query.\n\n"
 
 		"When MCP servers are configured in Project Settings (Plugins → UnrealGPT → MCP), you have MCP client tools: 'mcp_list_tools', 'mcp_call', 'mcp_read_resource', and 'mcp_get_prompt'.\n"
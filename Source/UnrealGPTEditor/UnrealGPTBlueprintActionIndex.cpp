@@ -0,0 +1,368 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTBlueprintActionIndex.h"
+#include "UnrealGPTReflectionSearch.h"
+#include "BlueprintActionDatabase.h"
+#include "BlueprintActionFilter.h"
+#include "BlueprintNodeSpawner.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "K2Node.h"
+
+namespace UnrealGPTBlueprintActionIndexPrivate
+{
+	// Where a query term lands: the menu name outranks category and keywords.
+	constexpr int32 NameScore = 3;
+	constexpr int32 CategoryScore = 1;
+	constexpr int32 KeywordScore = 1;
+	constexpr int32 ExactNameBonus = 10;
+	constexpr int32 MaxResolveCandidates = 8;
+
+	static FString MakePath(const FString& Category, const FString& Name)
+	{
+		return Category.IsEmpty() ? Name : Category + TEXT("|") + Name;
+	}
+
+	/** Total score, or INDEX_NONE when a term matches nothing. */
+	static int32 ScoreAction(const FUnrealGPTBlueprintActionIndex::FAction& Action, const TArray<FString>& Terms, const FString& LowerQuery)
+	{
+		int32 Score = 0;
+		for (const FString& Term : Terms)
+		{
+			if (Action.LowerName.Contains(Term))
+			{
+				Score += NameScore;
+			}
+			else if (Action.LowerCategory.Contains(Term))
+			{
+				Score += CategoryScore;
+			}
+			else if (Action.LowerKeywords.Contains(Term))
+			{
+				Score += KeywordScore;
+			}
+			else
+			{
+				return INDEX_NONE;
+			}
+		}
+
+		if (Action.LowerName == LowerQuery)
+		{
+			Score += ExactNameBonus;
+		}
+		return Score;
+	}
+}
+
+FUnrealGPTBlueprintActionIndex& FUnrealGPTBlueprintActionIndex::Get()
+{
+	static FUnrealGPTBlueprintActionIndex Instance;
+	return Instance;
+}
+
+void FUnrealGPTBlueprintActionIndex::Shutdown()
+{
+	// TryGet: creating the database during shutdown would walk every class for nothing.
+	if (FBlueprintActionDatabase* Database = FBlueprintActionDatabase::TryGet())
+	{
+		Database->OnEntryUpdated().Remove(EntryUpdatedHandle);
+		Database->OnEntryRemoved().Remove(EntryRemovedHandle);
+	}
+	EntryUpdatedHandle.Reset();
+	EntryRemovedHandle.Reset();
+
+	ActionsByOwner.Empty();
+	OwnerById.Empty();
+	IdsByLowerPath.Empty();
+	DirtyOwners.Empty();
+	ActionCount = 0;
+	bBuilt = false;
+}
+
+void FUnrealGPTBlueprintActionIndex::EnsureBuilt()
+{
+	if (bBuilt)
+	{
+		if (DirtyOwners.Num() > 0)
+		{
+			const TSet<FObjectKey> Owners = MoveTemp(DirtyOwners);
+			DirtyOwners.Reset();
+			for (const FObjectKey& Owner : Owners)
+			{
+				RefreshOwner(Owner);
+			}
+		}
+		return;
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	// The first Get() populates the database from every loaded class and asset.
+	FBlueprintActionDatabase& Database = FBlueprintActionDatabase::Get();
+	if (!EntryUpdatedHandle.IsValid())
+	{
+		EntryUpdatedHandle = Database.OnEntryUpdated().AddRaw(this, &FUnrealGPTBlueprintActionIndex::HandleEntryUpdated);
+		EntryRemovedHandle = Database.OnEntryRemoved().AddRaw(this, &FUnrealGPTBlueprintActionIndex::HandleEntryRemoved);
+	}
+
+	ActionsByOwner.Reset();
+	OwnerById.Reset();
+	IdsByLowerPath.Reset();
+	DirtyOwners.Reset();
+	ActionCount = 0;
+
+	for (const TPair<FObjectKey, FBlueprintActionDatabase::FActionList>& Entry : Database.GetAllActions())
+	{
+		RefreshOwner(Entry.Key);
+	}
+
+	bBuilt = true;
+	LastBuildSeconds = FPlatformTime::Seconds() - StartSeconds;
+	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Indexed %d Blueprint actions in %.0f ms"), ActionCount, LastBuildSeconds * 1000.0);
+}
+
+void FUnrealGPTBlueprintActionIndex::RefreshOwner(const FObjectKey& Owner)
+{
+	using namespace UnrealGPTBlueprintActionIndexPrivate;
+
+	RemoveOwner(Owner);
+
+	const FBlueprintActionDatabase::FActionList* Spawners = FBlueprintActionDatabase::Get().GetAllActions().Find(Owner);
+	if (!Spawners)
+	{
+		return;
+	}
+
+	TArray<FAction> Actions;
+	Actions.Reserve(Spawners->Num());
+	for (UBlueprintNodeSpawner* Spawner : *Spawners)
+	{
+		if (!Spawner || !Spawner->NodeClass || !Spawner->NodeClass->IsChildOf(UK2Node::StaticClass()))
+		{
+			continue;
+		}
+
+		// Resolves the menu text through the spawner's template node; cached by the spawner afterwards.
+		const FBlueprintActionUiSpec& UiSpec = Spawner->PrepareUiSpec(FBlueprintActionContext(), IBlueprintNodeBinder::FBindingSet());
+		if (UiSpec.MenuName.IsEmpty())
+		{
+			continue;
+		}
+
+		FAction& Action = Actions.AddDefaulted_GetRef();
+		Action.Spawner = Spawner;
+		Action.ActionId = Spawner->GetSpawnerSignature().AsGuid().ToString(EGuidFormats::Digits);
+		Action.Name = UiSpec.MenuName.ToString();
+		Action.Category = UiSpec.Category.ToString();
+		Action.Tooltip = UiSpec.Tooltip.ToString();
+		Action.NodeClass = Spawner->NodeClass->GetName();
+		Action.Path = MakePath(Action.Category, Action.Name);
+		Action.LowerName = Action.Name.ToLower();
+		Action.LowerCategory = Action.Category.ToLower();
+		Action.LowerKeywords = UiSpec.Keywords.ToString().ToLower();
+	}
+
+	if (Actions.Num() == 0)
+	{
+		return;
+	}
+
+	for (const FAction& Action : Actions)
+	{
+		OwnerById.Add(Action.ActionId, Owner);
+		IdsByLowerPath.FindOrAdd(Action.Path.ToLower()).AddUnique(Action.ActionId);
+	}
+	ActionCount += Actions.Num();
+	ActionsByOwner.Add(Owner, MoveTemp(Actions));
+}
+
+void FUnrealGPTBlueprintActionIndex::RemoveOwner(const FObjectKey& Owner)
+{
+	TArray<FAction> Removed;
+	if (!ActionsByOwner.RemoveAndCopyValue(Owner, Removed))
+	{
+		return;
+	}
+
+	for (const FAction& Action : Removed)
+	{
+		OwnerById.Remove(Action.ActionId);
+		const FString LowerPath = Action.Path.ToLower();
+		if (TArray<FString>* Ids = IdsByLowerPath.Find(LowerPath))
+		{
+			Ids->Remove(Action.ActionId);
+			if (Ids->Num() == 0)
+			{
+				IdsByLowerPath.Remove(LowerPath);
+			}
+		}
+	}
+	ActionCount -= Removed.Num();
+}
+
+void FUnrealGPTBlueprintActionIndex::HandleEntryUpdated(UObject* ActionKey)
+{
+	if (bBuilt && ActionKey)
+	{
+		DirtyOwners.Add(FObjectKey(ActionKey));
+	}
+}
+
+void FUnrealGPTBlueprintActionIndex::HandleEntryRemoved(UObject* ActionKey)
+{
+	if (bBuilt && ActionKey)
+	{
+		RemoveOwner(FObjectKey(ActionKey));
+		DirtyOwners.Remove(FObjectKey(ActionKey));
+	}
+}
+
+int32 FUnrealGPTBlueprintActionIndex::GetActionCount()
+{
+	EnsureBuilt();
+	return ActionCount;
+}
+
+void FUnrealGPTBlueprintActionIndex::Search(const FString& QueryText, int32 MaxResults, TArray<const FAction*>& OutActions)
+{
+	using namespace UnrealGPTBlueprintActionIndexPrivate;
+
+	OutActions.Reset();
+	EnsureBuilt();
+
+	const FString LowerQuery = QueryText.TrimStartAndEnd().ToLower();
+	TArray<FString> Terms;
+	FUnrealGPTReflectionSearchIndex::Tokenize(QueryText, Terms);
+	if (Terms.Num() == 0)
+	{
+		// Operators such as "+" or "==" tokenize to nothing; match them literally.
+		if (LowerQuery.IsEmpty())
+		{
+			return;
+		}
+		Terms.Add(LowerQuery);
+	}
+
+	struct FScored
+	{
+		const FAction* Action;
+		int32 Score;
+	};
+	TArray<FScored> Scored;
+	for (const TPair<FObjectKey, TArray<FAction>>& Entry : ActionsByOwner)
+	{
+		for (const FAction& Action : Entry.Value)
+		{
+			const int32 Score = ScoreAction(Action, Terms, LowerQuery);
+			if (Score != INDEX_NONE)
+			{
+				Scored.Add({ &Action, Score });
+			}
+		}
+	}
+
+	Scored.Sort([](const FScored& A, const FScored& B)
+	{
+		if (A.Score != B.Score)
+		{
+			return A.Score > B.Score;
+		}
+		if (A.Action->Name.Len() != B.Action->Name.Len())
+		{
+			return A.Action->Name.Len() < B.Action->Name.Len();
+		}
+		return A.Action->Path < B.Action->Path;
+	});
+
+	const int32 Count = FMath::Min(Scored.Num(), FMath::Clamp(MaxResults, 1, MaxSearchResults));
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		OutActions.Add(Scored[Index].Action);
+	}
+}
+
+const FUnrealGPTBlueprintActionIndex::FAction* FUnrealGPTBlueprintActionIndex::Resolve(const FString& ActionKey, FString& OutError, TArray<FString>& OutCandidates)
+{
+	using namespace UnrealGPTBlueprintActionIndexPrivate;
+
+	EnsureBuilt();
+
+	const FString Key = ActionKey.TrimStartAndEnd();
+	FString ActionId;
+
+	FGuid ParsedId;
+	if (FGuid::Parse(Key, ParsedId))
+	{
+		ActionId = ParsedId.ToString(EGuidFormats::Digits);
+	}
+	else if (const TArray<FString>* Ids = IdsByLowerPath.Find(Key.ToLower()))
+	{
+		if (Ids->Num() > 1)
+		{
+			OutError = FString::Printf(TEXT("Action '%s' is ambiguous; pass one of the candidate action ids"), *Key);
+			OutCandidates = *Ids;
+			return nullptr;
+		}
+		ActionId = (*Ids)[0];
+	}
+
+	if (const FObjectKey* Owner = OwnerById.Find(ActionId))
+	{
+		if (const TArray<FAction>* Actions = ActionsByOwner.Find(*Owner))
+		{
+			for (const FAction& Action : *Actions)
+			{
+				if (Action.ActionId == ActionId)
+				{
+					if (!Action.Spawner.IsValid())
+					{
+						break;
+					}
+					return &Action;
+				}
+			}
+		}
+	}
+
+	OutError = FString::Printf(TEXT("Unknown action '%s'. Use blueprint_search_nodes to find an action_id"), *Key);
+	TArray<const FAction*> Similar;
+	Search(Key, MaxResolveCandidates, Similar);
+	for (const FAction* Action : Similar)
+	{
+		OutCandidates.Add(Action->Path);
+	}
+	return nullptr;
+}
+
+UEdGraphNode* FUnrealGPTBlueprintActionIndex::Spawn(UEdGraph* Graph, const FString& ActionKey, const FVector2D& Position, FString& OutError)
+{
+	TArray<FString> Candidates;
+	const FAction* Action = Resolve(ActionKey, OutError, Candidates);
+	if (!Action)
+	{
+		if (Candidates.Num() > 0)
+		{
+			OutError += FString::Printf(TEXT(". Candidates: %s"), *FString::Join(Candidates, TEXT(", ")));
+		}
+		return nullptr;
+	}
+
+	UBlueprintNodeSpawner* Spawner = Action->Spawner.Get();
+	const FString Path = Action->Path;
+
+	// The template node is the spawner's cached preview instance, so this check does not touch Graph.
+	const UEdGraphNode* Template = Spawner->GetTemplateNode(Graph);
+	if (!Template || !Template->CanCreateUnderSpecifiedSchema(Graph->GetSchema()) || !Template->IsCompatibleWithGraph(Graph))
+	{
+		OutError = FString::Printf(TEXT("Action '%s' cannot be placed in graph '%s'"), *Path, *Graph->GetName());
+		return nullptr;
+	}
+
+	UEdGraphNode* NewNode = Spawner->Invoke(Graph, IBlueprintNodeBinder::FBindingSet(), Position);
+	if (!NewNode)
+	{
+		OutError = FString::Printf(TEXT("Action '%s' did not create a node"), *Path);
+	}
+	return NewNode;
+}
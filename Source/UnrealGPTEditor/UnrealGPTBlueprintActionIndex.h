@@ -0,0 +1,81 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBlueprintNodeSpawner;
+class UEdGraph;
+class UEdGraphNode;
+
+/**
+ * Search table over every K2 node spawner in the Blueprint action database, i.e. the editor's
+ * right-click palette. Menu names, categories and keywords are resolved once on first use; later
+ * database updates (new assets, Blueprint compiles) only refresh the entries of the object that changed.
+ * Actions are addressed by their spawner signature (action_id) or by their "Category|Name" path.
+ * Game thread only.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTBlueprintActionIndex
+{
+public:
+	static constexpr int32 MaxSearchResults = 50;
+
+	struct FAction
+	{
+		TWeakObjectPtr<UBlueprintNodeSpawner> Spawner;
+		/** Spawner signature GUID; stable for a given engine build and asset set. */
+		FString ActionId;
+		/** "Category|Menu Name" as shown in the palette. */
+		FString Path;
+		FString Name;
+		FString Category;
+		FString Tooltip;
+		FString NodeClass;
+		FString LowerName;
+		FString LowerCategory;
+		FString LowerKeywords;
+	};
+
+	static FUnrealGPTBlueprintActionIndex& Get();
+
+	void Shutdown();
+
+	/** Actions whose name, category or keywords contain every query term, best first. */
+	void Search(const FString& QueryText, int32 MaxResults, TArray<const FAction*>& OutActions);
+
+	/**
+	 * Resolve an action_id or an exact "Category|Name" path (case-insensitive). When the path is ambiguous
+	 * or unknown, returns null and fills OutCandidates with action ids or close matches.
+	 */
+	const FAction* Resolve(const FString& ActionKey, FString& OutError, TArray<FString>& OutCandidates);
+
+	/** Place the node an action spawns into Graph. Returns null with OutError set when the node does not fit the graph. */
+	UEdGraphNode* Spawn(UEdGraph* Graph, const FString& ActionKey, const FVector2D& Position, FString& OutError);
+
+	int32 GetActionCount();
+
+	/** Seconds spent on the last full build, for diagnostics. */
+	double GetLastBuildSeconds() const { return LastBuildSeconds; }
+
+private:
+	FUnrealGPTBlueprintActionIndex() = default;
+
+	void EnsureBuilt();
+	void RefreshOwner(const FObjectKey& Owner);
+	void RemoveOwner(const FObjectKey& Owner);
+	void HandleEntryUpdated(UObject* ActionKey);
+	void HandleEntryRemoved(UObject* ActionKey);
+
+	TMap<FObjectKey, TArray<FAction>> ActionsByOwner;
+	TMap<FString, FObjectKey> OwnerById;
+	TMap<FString, TArray<FString>> IdsByLowerPath;
+	TSet<FObjectKey> DirtyOwners;
+	int32 ActionCount = 0;
+	double LastBuildSeconds = 0.0;
+	bool bBuilt = false;
+
+	FDelegateHandle EntryUpdatedHandle;
+	FDelegateHandle EntryRemovedHandle;
+};
@@ -3,6 +3,9 @@
 #include "UnrealGPTBlueprintContext.h"
 
 #include "Editor.h"
+#include "Editor/Transactor.h"
+#include "ScopedTransaction.h"
+#include "UnrealGPTBlueprintActionIndex.h"
 #include "UnrealGPTBlueprintGraph.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/Blueprint.h"
@@ -76,6 +79,256 @@ namespace UnrealGPTBlueprintContextPrivate
 		}
 		return FUnrealGPTBlueprintGraph::NormalizeAssetPath(AssetPath);
 	}
+
+	/** Per-batch state shared by the blueprint_apply_edits operations. */
+	struct FApplyEditsState
+	{
+		UBlueprint* Blueprint = nullptr;
+		FString DefaultGraphName;
+		TMap<FString, UEdGraph*> Graphs;
+		/** Local id -> GUID of nodes added earlier in the batch. */
+		TMap<FString, FString> NodeIds;
+		/**
+		 * Nodes added without an explicit position, laid out once the batch has run. Existing nodes the
+		 * batch rewires keep their positions and anchor the layout.
+		 */
+		TMap<UEdGraph*, TArray<UEdGraphNode*>> NodesToLayout;
+		bool bStructural = false;
+		/** Variables were added since the skeleton class was last regenerated. */
+		bool bSkeletonStale = false;
+		/**
+		 * Pre-batch state of everything an atomic batch may touch, restored on failure. Kept apart from the
+		 * editor transaction, which may be nested in an outer one that must not be undone.
+		 */
+		FTransaction* Snapshot = nullptr;
+	};
+
+	static UEdGraph* ResolveBatchGraph(FApplyEditsState& State, const FJsonObject& Op, FString& OutError)
+	{
+		FString GraphName = State.DefaultGraphName;
+		Op.TryGetStringField(TEXT("graph_name"), GraphName);
+
+		if (UEdGraph** Cached = State.Graphs.Find(GraphName))
+		{
+			return *Cached;
+		}
+
+		UEdGraph* Graph = FUnrealGPTBlueprintGraph::ResolveGraph(State.Blueprint, GraphName, OutError);
+		if (Graph)
+		{
+			State.Graphs.Add(GraphName, Graph);
+
+			// Connections can break links on nodes the batch never names, so the whole graph is recorded.
+			if (State.Snapshot)
+			{
+				State.Snapshot->SaveObject(Graph);
+				for (UEdGraphNode* Node : Graph->Nodes)
+				{
+					if (Node)
+					{
+						State.Snapshot->SaveObject(Node);
+					}
+				}
+			}
+		}
+		return Graph;
+	}
+
+	/** Reads Field (or Field + "_guid") and maps a local id from an earlier add_node to its GUID. */
+	static bool ResolveNodeReference(const FApplyEditsState& State, const FJsonObject& Op, const FString& Field, FString& OutGuid, FString& OutError)
+	{
+		FString Reference;
+		if (!Op.TryGetStringField(Field, Reference) || Reference.IsEmpty())
+		{
+			if (!Op.TryGetStringField(Field + TEXT("_guid"), Reference) || Reference.IsEmpty())
+			{
+				OutError = FString::Printf(TEXT("Missing required field: %s"), *Field);
+				return false;
+			}
+		}
+
+		if (const FString* Guid = State.NodeIds.Find(Reference))
+		{
+			OutGuid = *Guid;
+			return true;
+		}
+
+		FGuid Parsed;
+		if (!FGuid::Parse(Reference, Parsed))
+		{
+			OutError = FString::Printf(TEXT("'%s' is neither a local id from an earlier add_node nor a node GUID"), *Reference);
+			return false;
+		}
+		OutGuid = Reference;
+		return true;
+	}
+
+	static bool ApplyEditOperation(FApplyEditsState& State, const FString& OpName, const FJsonObject& Op, TSharedPtr<FJsonObject>& Result, FString& OutError)
+	{
+		if (OpName == TEXT("add_variable"))
+		{
+			FString VarName;
+			if (!Op.TryGetStringField(TEXT("name"), VarName) || VarName.IsEmpty())
+			{
+				OutError = TEXT("Missing required field: name");
+				return false;
+			}
+
+			FString TypeName = TEXT("bool");
+			FString SubTypeObject;
+			FString DefaultValue;
+			bool bInstanceEditable = false;
+			bool bExposeOnSpawn = false;
+			Op.TryGetStringField(TEXT("type"), TypeName);
+			Op.TryGetStringField(TEXT("sub_type_object"), SubTypeObject);
+			Op.TryGetStringField(TEXT("default_value"), DefaultValue);
+			Op.TryGetBoolField(TEXT("instance_editable"), bInstanceEditable);
+			Op.TryGetBoolField(TEXT("expose_on_spawn"), bExposeOnSpawn);
+
+			FEdGraphPinType PinType;
+			if (!FUnrealGPTBlueprintGraph::ParsePinType(TypeName, SubTypeObject, PinType, OutError)
+				|| !FUnrealGPTBlueprintGraph::AddMemberVariable(
+					State.Blueprint, VarName, PinType, DefaultValue, bInstanceEditable, bExposeOnSpawn, OutError, false))
+			{
+				return false;
+			}
+
+			State.bStructural = true;
+			State.bSkeletonStale = true;
+			Result->SetStringField(TEXT("name"), VarName);
+			return true;
+		}
+
+		UEdGraph* Graph = ResolveBatchGraph(State, Op, OutError);
+		if (!Graph)
+		{
+			return false;
+		}
+
+		// Variable get/set nodes and their pins resolve against the skeleton class.
+		if (State.bSkeletonStale)
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(State.Blueprint);
+			State.bSkeletonStale = false;
+		}
+
+		if (OpName == TEXT("add_node"))
+		{
+			FString NodeType;
+			if (!Op.TryGetStringField(TEXT("node_type"), NodeType) || NodeType.IsEmpty())
+			{
+				OutError = TEXT("Missing required field: node_type");
+				return false;
+			}
+
+			FString LocalId;
+			if (Op.TryGetStringField(TEXT("id"), LocalId) && State.NodeIds.Contains(LocalId))
+			{
+				OutError = FString::Printf(TEXT("Local id '%s' is already used earlier in this batch"), *LocalId);
+				return false;
+			}
+
+			double PosX = 0.0;
+			double PosY = 0.0;
+			const bool bHasPosX = Op.TryGetNumberField(TEXT("pos_x"), PosX);
+			const bool bHasPosY = Op.TryGetNumberField(TEXT("pos_y"), PosY);
+			const bool bPlaced = bHasPosX || bHasPosY;
+
+			const TSharedPtr<FJsonObject>* ParamsObj = nullptr;
+			Op.TryGetObjectField(TEXT("params"), ParamsObj);
+
+			FString NodeGuid;
+			if (!FUnrealGPTBlueprintGraph::AddNode(
+				State.Blueprint,
+				Graph,
+				NodeType,
+				FVector2D(static_cast<float>(PosX), static_cast<float>(PosY)),
+				ParamsObj ? *ParamsObj : nullptr,
+				NodeGuid,
+				OutError,
+				false))
+			{
+				return false;
+			}
+
+			if (!bPlaced)
+			{
+				FString LookupError;
+				if (UEdGraphNode* Node = FUnrealGPTBlueprintGraph::FindNodeByGuid(Graph, NodeGuid, LookupError))
+				{
+					State.NodesToLayout.FindOrAdd(Graph).Add(Node);
+				}
+			}
+			State.bStructural = true;
+			if (!LocalId.IsEmpty())
+			{
+				State.NodeIds.Add(LocalId, NodeGuid);
+				Result->SetStringField(TEXT("id"), LocalId);
+			}
+			Result->SetStringField(TEXT("node_guid"), NodeGuid);
+			return true;
+		}
+
+		if (OpName == TEXT("connect_pins"))
+		{
+			FString FromGuid;
+			FString ToGuid;
+			FString FromPin;
+			FString ToPin;
+			if (!ResolveNodeReference(State, Op, TEXT("from_node"), FromGuid, OutError)
+				|| !ResolveNodeReference(State, Op, TEXT("to_node"), ToGuid, OutError))
+			{
+				return false;
+			}
+			if (!Op.TryGetStringField(TEXT("from_pin"), FromPin) || FromPin.IsEmpty()
+				|| !Op.TryGetStringField(TEXT("to_pin"), ToPin) || ToPin.IsEmpty())
+			{
+				OutError = TEXT("Missing required fields: from_pin, to_pin");
+				return false;
+			}
+
+			if (!FUnrealGPTBlueprintGraph::ConnectPins(Graph, FromGuid, FromPin, ToGuid, ToPin, OutError))
+			{
+				return false;
+			}
+			State.bStructural = true;
+			return true;
+		}
+
+		if (OpName == TEXT("set_pin_default"))
+		{
+			FString NodeGuid;
+			FString PinName;
+			FString Value;
+			if (!ResolveNodeReference(State, Op, TEXT("node"), NodeGuid, OutError))
+			{
+				return false;
+			}
+			if (!Op.TryGetStringField(TEXT("pin_name"), PinName) || PinName.IsEmpty()
+				|| !Op.TryGetStringField(TEXT("value"), Value))
+			{
+				OutError = TEXT("Missing required fields: pin_name, value");
+				return false;
+			}
+			return FUnrealGPTBlueprintGraph::SetPinDefault(Graph, NodeGuid, PinName, Value, OutError);
+		}
+
+		if (OpName == TEXT("remove_node"))
+		{
+			FString NodeGuid;
+			if (!ResolveNodeReference(State, Op, TEXT("node"), NodeGuid, OutError)
+				|| !FUnrealGPTBlueprintGraph::RemoveNode(State.Blueprint, Graph, NodeGuid, OutError))
+			{
+				return false;
+			}
+			State.bStructural = true;
+			Result->SetStringField(TEXT("node_guid"), NodeGuid);
+			return true;
+		}
+
+		OutError = FString::Printf(TEXT("Unsupported op '%s'. Supported: add_node, connect_pins, set_pin_default, remove_node, add_variable"), *OpName);
+		return false;
+	}
 }
 
 FString UUnrealGPTBlueprintContext::Query(const FString& ArgumentsJson)
@@ -111,8 +364,15 @@ FString UUnrealGPTBlueprintContext::Query(const FString& ArgumentsJson)
 	bool bIncludePins = true;
 	Args->TryGetBoolField(TEXT("include_pins"), bIncludePins);
 
+	FString SinceRevision;
+	Args->TryGetStringField(TEXT("since_revision"), SinceRevision);
+
+	FString Format;
+	Args->TryGetStringField(TEXT("format"), Format);
+	const bool bCompact = Format.Equals(TEXT("compact"), ESearchCase::IgnoreCase);
+
 	const TSharedPtr<FJsonObject> Details = FUnrealGPTBlueprintGraph::SerializeBlueprintSummary(
-		Blueprint, AssetPath, GraphName, NodeGuid, bIncludePins);
+		Blueprint, AssetPath, GraphName, NodeGuid, bIncludePins, SinceRevision, bCompact);
 	return MakeOk(TEXT("Blueprint query succeeded"), Details);
 }
 
@@ -285,29 +545,25 @@ FString UUnrealGPTBlueprintContext::Compile(const FString& ArgumentsJson)
 		return SerializeJson(FUnrealGPTBlueprintGraph::MakeError(LoadError));
 	}
 
-	TArray<FString> Errors;
-	TArray<FString> Warnings;
-	FString Status;
-	const bool bSuccess = FUnrealGPTBlueprintGraph::CompileBlueprint(Blueprint, Errors, Warnings, Status);
+	bool bForce = false;
+	Args->TryGetBoolField(TEXT("force"), bForce);
 
 	TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
 	Details->SetStringField(TEXT("asset_path"), AssetPath);
-	Details->SetStringField(TEXT("compile_status"), Status);
-	Details->SetBoolField(TEXT("success"), bSuccess);
 
-	TArray<TSharedPtr<FJsonValue>> ErrorValues;
-	for (const FString& Error : Errors)
+	// Edits mark the Blueprint dirty, so an up-to-date status means there is nothing new to report.
+	if (!bForce && Blueprint->Status == BS_UpToDate)
 	{
-		ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+		Details->SetStringField(TEXT("compile_status"), TEXT("up_to_date"));
+		Details->SetBoolField(TEXT("success"), true);
+		Details->SetBoolField(TEXT("skipped"), true);
+		return MakeOk(TEXT("Blueprint is already up to date"), Details);
 	}
-	Details->SetArrayField(TEXT("compile_errors"), ErrorValues);
 
-	TArray<TSharedPtr<FJsonValue>> WarningValues;
-	for (const FString& Warning : Warnings)
-	{
-		WarningValues.Add(MakeShared<FJsonValueString>(Warning));
-	}
-	Details->SetArrayField(TEXT("compile_warnings"), WarningValues);
+	FUnrealGPTCompileReport Report;
+	const bool bSuccess = FUnrealGPTBlueprintGraph::CompileBlueprint(Blueprint, Report);
+	Details->SetBoolField(TEXT("success"), bSuccess);
+	FUnrealGPTBlueprintGraph::AppendCompileReport(Report, Details);
 
 	if (!bSuccess)
 	{
@@ -349,8 +605,8 @@ FString UUnrealGPTBlueprintContext::AddNode(const FString& ArgumentsJson)
 
 	double PosX = 0.0;
 	double PosY = 0.0;
-	Args->TryGetNumberField(TEXT("pos_x"), PosX);
-	Args->TryGetNumberField(TEXT("pos_y"), PosY);
+	const bool bHasPosX = Args->TryGetNumberField(TEXT("pos_x"), PosX);
+	const bool bHasPosY = Args->TryGetNumberField(TEXT("pos_y"), PosY);
 
 	const TSharedPtr<FJsonObject>* ParamsObj = nullptr;
 	Args->TryGetObjectField(TEXT("params"), ParamsObj);
@@ -380,6 +636,15 @@ FString UUnrealGPTBlueprintContext::AddNode(const FString& ArgumentsJson)
 		ParamsObj ? *ParamsObj : nullptr,
 		NodeGuid,
 		NodeError);
+	if (bSuccess && !bHasPosX && !bHasPosY)
+	{
+		// Unplaced nodes go below the existing graph instead of piling up at the origin.
+		FString LookupError;
+		if (UEdGraphNode* Node = FUnrealGPTBlueprintGraph::FindNodeByGuid(Graph, NodeGuid, LookupError))
+		{
+			FUnrealGPTBlueprintGraph::LayoutNodes(Graph, { Node });
+		}
+	}
 	if (bTransaction)
 	{
 		EndWriteTransaction();
@@ -601,3 +866,410 @@ FString UUnrealGPTBlueprintContext::SetPinDefault(const FString& ArgumentsJson)
 	Details->SetStringField(TEXT("value"), Value);
 	return MakeOk(TEXT("Blueprint pin default set"), Details);
 }
+
+FString UUnrealGPTBlueprintContext::SearchNodes(const FString& ArgumentsJson)
+{
+	using namespace UnrealGPTBlueprintContextPrivate;
+
+	FString ParseError;
+	const TSharedPtr<FJsonObject> Args = ParseArgs(ArgumentsJson, ParseError);
+	if (!Args.IsValid())
+	{
+		return ReturnErrorJson(ParseError);
+	}
+
+	FString QueryText;
+	if (!Args->TryGetStringField(TEXT("query"), QueryText) || QueryText.TrimStartAndEnd().IsEmpty())
+	{
+		return ReturnErrorJson(TEXT("Missing required field: query"));
+	}
+
+	int32 MaxResults = 15;
+	Args->TryGetNumberField(TEXT("max_results"), MaxResults);
+
+	FUnrealGPTBlueprintActionIndex& ActionIndex = FUnrealGPTBlueprintActionIndex::Get();
+	const double StartSeconds = FPlatformTime::Seconds();
+	TArray<const FUnrealGPTBlueprintActionIndex::FAction*> Actions;
+	ActionIndex.Search(QueryText, MaxResults, Actions);
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	TArray<TSharedPtr<FJsonValue>> ResultsJson;
+	for (const FUnrealGPTBlueprintActionIndex::FAction* Action : Actions)
+	{
+		TSharedPtr<FJsonObject> ActionJson = MakeShared<FJsonObject>();
+		ActionJson->SetStringField(TEXT("action_id"), Action->ActionId);
+		ActionJson->SetStringField(TEXT("name"), Action->Name);
+		ActionJson->SetStringField(TEXT("category"), Action->Category);
+		ActionJson->SetStringField(TEXT("node_class"), Action->NodeClass);
+		if (!Action->Tooltip.IsEmpty())
+		{
+			ActionJson->SetStringField(TEXT("tooltip"), Action->Tooltip.Left(160));
+		}
+		ResultsJson.Add(MakeShared<FJsonValueObject>(ActionJson));
+	}
+
+	TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+	Details->SetArrayField(TEXT("results"), ResultsJson);
+	Details->SetNumberField(TEXT("searched_actions"), ActionIndex.GetActionCount());
+	Details->SetNumberField(TEXT("took_ms"), FMath::RoundToFloat(static_cast<float>(ElapsedMs) * 100.0f) / 100.0f);
+	return MakeOk(
+		ResultsJson.Num() > 0
+			? TEXT("Pass an action_id to blueprint_add_node as node_type Action with params.action_id")
+			: TEXT("No actions matched. Try fewer or more general words"),
+		Details);
+}
+
+FString UUnrealGPTBlueprintContext::ApplyEdits(const FString& ArgumentsJson)
+{
+	using namespace UnrealGPTBlueprintContextPrivate;
+
+	FString ParseError;
+	const TSharedPtr<FJsonObject> Args = ParseArgs(ArgumentsJson, ParseError);
+	if (!Args.IsValid())
+	{
+		return ReturnErrorJson(ParseError);
+	}
+
+	const FString AssetPath = GetRequiredAssetPath(Args, ParseError);
+	if (AssetPath.IsEmpty())
+	{
+		return ReturnErrorJson(ParseError);
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Ops = nullptr;
+	if (!Args->TryGetArrayField(TEXT("ops"), Ops) || !Ops || Ops->Num() == 0)
+	{
+		return ReturnErrorJson(TEXT("Missing required field: ops (non-empty array)"));
+	}
+	if (Ops->Num() > MaxApplyEditsOperations)
+	{
+		return ReturnErrorJson(FString::Printf(TEXT("Too many ops (%d); at most %d per call"), Ops->Num(), MaxApplyEditsOperations));
+	}
+
+	bool bCompile = false;
+	bool bAtomic = true;
+	Args->TryGetBoolField(TEXT("compile"), bCompile);
+	Args->TryGetBoolField(TEXT("atomic"), bAtomic);
+	bool bAutoLayout = true;
+	Args->TryGetBoolField(TEXT("auto_layout"), bAutoLayout);
+
+	FString LoadError;
+	UBlueprint* Blueprint = FUnrealGPTBlueprintGraph::LoadBlueprint(AssetPath, LoadError);
+	if (!Blueprint)
+	{
+		return SerializeJson(FUnrealGPTBlueprintGraph::MakeError(LoadError));
+	}
+
+	FApplyEditsState State;
+	State.Blueprint = Blueprint;
+	Args->TryGetStringField(TEXT("graph_name"), State.DefaultGraphName);
+
+	TOptional<FScopedTransaction> Transaction;
+	Transaction.Emplace(FText::FromString(TEXT("Apply Blueprint Edits")));
+	FTransaction Snapshot(TEXT("UnrealGPT.ApplyEdits"));
+	if (bAtomic)
+	{
+		State.Snapshot = &Snapshot;
+		Snapshot.SaveObject(Blueprint);
+	}
+	Blueprint->Modify();
+
+	TArray<TSharedPtr<FJsonValue>> Results;
+	int32 Applied = 0;
+	int32 Failed = 0;
+	FString FirstError;
+	for (int32 Index = 0; Index < Ops->Num(); ++Index)
+	{
+		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("index"), Index);
+
+		const TSharedPtr<FJsonObject>* OpObj = nullptr;
+		FString OpName;
+		FString OpError;
+		bool bOk = false;
+		if (!(*Ops)[Index].IsValid() || !(*Ops)[Index]->TryGetObject(OpObj) || !OpObj || !OpObj->IsValid())
+		{
+			OpError = TEXT("Operation must be an object");
+		}
+		else if (!(*OpObj)->TryGetStringField(TEXT("op"), OpName) || OpName.IsEmpty())
+		{
+			OpError = TEXT("Missing required field: op");
+		}
+		else
+		{
+			Result->SetStringField(TEXT("op"), OpName);
+			bOk = ApplyEditOperation(State, OpName, **OpObj, Result, OpError);
+		}
+
+		Result->SetStringField(TEXT("status"), bOk ? TEXT("ok") : TEXT("error"));
+		if (!bOk)
+		{
+			Result->SetStringField(TEXT("message"), OpError);
+			if (FirstError.IsEmpty())
+			{
+				FirstError = FString::Printf(TEXT("op %d: %s"), Index, *OpError);
+			}
+			++Failed;
+		}
+		else
+		{
+			++Applied;
+		}
+		Results.Add(MakeShared<FJsonValueObject>(Result));
+
+		if (!bOk && bAtomic)
+		{
+			for (int32 Skipped = Index + 1; Skipped < Ops->Num(); ++Skipped)
+			{
+				TSharedPtr<FJsonObject> SkippedResult = MakeShared<FJsonObject>();
+				SkippedResult->SetNumberField(TEXT("index"), Skipped);
+				SkippedResult->SetStringField(TEXT("status"), TEXT("skipped"));
+				Results.Add(MakeShared<FJsonValueObject>(SkippedResult));
+			}
+			break;
+		}
+	}
+
+	// An atomic batch that failed part way is restored as a whole, so the graph never holds half an edit.
+	const bool bRollBack = bAtomic && Failed > 0;
+	if (bRollBack)
+	{
+		Snapshot.Apply();
+		Transaction->Cancel();
+		if (State.bStructural)
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		}
+	}
+	if (!bRollBack && bAutoLayout)
+	{
+		for (const TPair<UEdGraph*, TArray<UEdGraphNode*>>& Pair : State.NodesToLayout)
+		{
+			FUnrealGPTBlueprintGraph::LayoutNodes(Pair.Key, Pair.Value);
+		}
+	}
+	if (!bRollBack && State.bStructural)
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	}
+	else if (!bRollBack && Applied > 0)
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	}
+	Transaction.Reset();
+
+	TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+	Details->SetStringField(TEXT("asset_path"), AssetPath);
+	Details->SetNumberField(TEXT("applied"), bRollBack ? 0 : Applied);
+	Details->SetNumberField(TEXT("failed"), Failed);
+	Details->SetArrayField(TEXT("results"), Results);
+	if (bRollBack)
+	{
+		Details->SetBoolField(TEXT("rolled_back"), true);
+	}
+	else
+	{
+		TSharedPtr<FJsonObject> NodeIds = MakeShared<FJsonObject>();
+		for (const TPair<FString, FString>& Pair : State.NodeIds)
+		{
+			NodeIds->SetStringField(Pair.Key, Pair.Value);
+		}
+		Details->SetObjectField(TEXT("node_ids"), NodeIds);
+	}
+
+	if (bCompile && !bRollBack)
+	{
+		FUnrealGPTCompileReport Report;
+		const bool bCompiled = FUnrealGPTBlueprintGraph::CompileBlueprint(Blueprint, Report);
+		Details->SetBoolField(TEXT("compile_success"), bCompiled);
+		FUnrealGPTBlueprintGraph::AppendCompileReport(Report, Details);
+	}
+
+	if (Failed > 0)
+	{
+		TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("status"), TEXT("error"));
+		Root->SetStringField(TEXT("message"), bRollBack
+			? FString::Printf(TEXT("Blueprint edits rolled back; %s"), *FirstError)
+			: FString::Printf(TEXT("%d of %d Blueprint edits failed; first: %s"), Failed, Ops->Num(), *FirstError));
+		Root->SetObjectField(TEXT("details"), Details);
+		return SerializeJson(Root);
+	}
+
+	return MakeOk(FString::Printf(TEXT("Applied %d Blueprint edits"), Applied), Details);
+}
+
+FString UUnrealGPTBlueprintContext::CompileBatch(const FString& ArgumentsJson)
+{
+	using namespace UnrealGPTBlueprintContextPrivate;
+
+	FString ParseError;
+	const TSharedPtr<FJsonObject> Args = ParseArgs(ArgumentsJson, ParseError);
+	if (!Args.IsValid())
+	{
+		return ReturnErrorJson(ParseError);
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* AssetPathValues = nullptr;
+	FString DependencyRoot;
+	Args->TryGetArrayField(TEXT("asset_paths"), AssetPathValues);
+	Args->TryGetStringField(TEXT("dependency_root"), DependencyRoot);
+	if ((!AssetPathValues || AssetPathValues->Num() == 0) && DependencyRoot.IsEmpty())
+	{
+		return ReturnErrorJson(TEXT("Provide asset_paths (non-empty array) or dependency_root"));
+	}
+
+	bool bIncludeRoot = true;
+	bool bBenchmark = false;
+	Args->TryGetBoolField(TEXT("include_root"), bIncludeRoot);
+	Args->TryGetBoolField(TEXT("benchmark"), bBenchmark);
+
+	TArray<UBlueprint*> Blueprints;
+	TArray<TSharedPtr<FJsonValue>> LoadFailures;
+	bool bTruncated = false;
+	if (AssetPathValues)
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *AssetPathValues)
+		{
+			FString AssetPath;
+			if (!Value.IsValid() || !Value->TryGetString(AssetPath) || AssetPath.IsEmpty())
+			{
+				continue;
+			}
+			if (Blueprints.Num() >= MaxCompileBatchBlueprints)
+			{
+				bTruncated = true;
+				break;
+			}
+
+			FString LoadError;
+			if (UBlueprint* Blueprint = FUnrealGPTBlueprintGraph::LoadBlueprint(AssetPath, LoadError))
+			{
+				Blueprints.AddUnique(Blueprint);
+			}
+			else
+			{
+				LoadFailures.Add(MakeShared<FJsonValueString>(LoadError));
+			}
+		}
+	}
+
+	if (!DependencyRoot.IsEmpty())
+	{
+		TArray<UBlueprint*> Dependents;
+		bool bDependentsTruncated = false;
+		FString DependencyError;
+		if (!FUnrealGPTBlueprintGraph::CollectDependentBlueprints(
+			DependencyRoot, MaxCompileBatchBlueprints, Dependents, bDependentsTruncated, DependencyError))
+		{
+			return ReturnErrorJson(DependencyError);
+		}
+		bTruncated |= bDependentsTruncated;
+
+		FString LoadError;
+		UBlueprint* RootBlueprint = bIncludeRoot ? FUnrealGPTBlueprintGraph::LoadBlueprint(DependencyRoot, LoadError) : nullptr;
+		if (RootBlueprint)
+		{
+			Blueprints.AddUnique(RootBlueprint);
+		}
+		for (UBlueprint* Dependent : Dependents)
+		{
+			if (Blueprints.Num() >= MaxCompileBatchBlueprints)
+			{
+				bTruncated = true;
+				break;
+			}
+			Blueprints.AddUnique(Dependent);
+		}
+	}
+
+	if (Blueprints.Num() == 0)
+	{
+		TSharedPtr<FJsonObject> Root = FUnrealGPTBlueprintGraph::MakeError(TEXT("No Blueprints to compile"));
+		if (LoadFailures.Num() > 0)
+		{
+			TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+			Details->SetArrayField(TEXT("load_failures"), LoadFailures);
+			Root->SetObjectField(TEXT("details"), Details);
+		}
+		return SerializeJson(Root);
+	}
+
+	FUnrealGPTBlueprintGraph::SortDependenciesFirst(Blueprints);
+
+	// Each benchmark variant starts from the same state: every Blueprint out of date, as after an edit.
+	auto MarkBlueprintsDirty = [&Blueprints]()
+	{
+		for (UBlueprint* Blueprint : Blueprints)
+		{
+			Blueprint->Status = BS_Dirty;
+		}
+	};
+	if (bBenchmark)
+	{
+		MarkBlueprintsDirty();
+	}
+
+	TArray<FUnrealGPTCompileReport> Reports;
+	double BatchSeconds = 0.0;
+	FUnrealGPTBlueprintGraph::CompileBlueprints(Blueprints, Reports, BatchSeconds);
+
+	int32 FailedCount = 0;
+	TArray<TSharedPtr<FJsonValue>> Results;
+	for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+	{
+		const FUnrealGPTCompileReport& Report = Reports[Index];
+		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("asset_path"), Blueprints[Index]->GetPathName());
+		Result->SetBoolField(TEXT("success"), Report.bSuccess);
+		FUnrealGPTBlueprintGraph::AppendCompileReport(Report, Result);
+		// Timing is only known for the whole flush.
+		Result->RemoveField(TEXT("compile_ms"));
+		if (Report.Diagnostics.Num() == 0)
+		{
+			Result->RemoveField(TEXT("diagnostics"));
+		}
+		Results.Add(MakeShared<FJsonValueObject>(Result));
+		FailedCount += Report.bSuccess ? 0 : 1;
+	}
+
+	TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+	Details->SetNumberField(TEXT("compiled"), Blueprints.Num());
+	Details->SetNumberField(TEXT("failed"), FailedCount);
+	Details->SetNumberField(TEXT("compile_ms"), FMath::RoundToInt(BatchSeconds * 1000.0));
+	Details->SetArrayField(TEXT("results"), Results);
+	if (LoadFailures.Num() > 0)
+	{
+		Details->SetArrayField(TEXT("load_failures"), LoadFailures);
+	}
+	if (bTruncated)
+	{
+		Details->SetStringField(TEXT("note"), FString::Printf(TEXT("Only the first %d Blueprints were compiled"), MaxCompileBatchBlueprints));
+	}
+
+	// Optional comparison against compiling each asset on its own, the way repeated blueprint_compile calls do.
+	if (bBenchmark)
+	{
+		MarkBlueprintsDirty();
+		const double SerialStart = FPlatformTime::Seconds();
+		for (UBlueprint* Blueprint : Blueprints)
+		{
+			FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+		}
+		TSharedPtr<FJsonObject> Benchmark = MakeShared<FJsonObject>();
+		Benchmark->SetNumberField(TEXT("batch_ms"), FMath::RoundToInt(BatchSeconds * 1000.0));
+		Benchmark->SetNumberField(TEXT("serial_ms"), FMath::RoundToInt((FPlatformTime::Seconds() - SerialStart) * 1000.0));
+		Details->SetObjectField(TEXT("benchmark"), Benchmark);
+	}
+
+	if (FailedCount > 0)
+	{
+		TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("status"), TEXT("error"));
+		Root->SetStringField(TEXT("message"), FString::Printf(TEXT("%d of %d Blueprints failed to compile"), FailedCount, Blueprints.Num()));
+		Root->SetObjectField(TEXT("details"), Details);
+		return SerializeJson(Root);
+	}
+
+	return MakeOk(FString::Printf(TEXT("Compiled %d Blueprints"), Blueprints.Num()), Details);
+}
@@ -20,4 +20,19 @@ public:
 	static FString ConnectPins(const FString& ArgumentsJson);
 	static FString RemoveNode(const FString& ArgumentsJson);
 	static FString SetPinDefault(const FString& ArgumentsJson);
+
+	/** Search the Blueprint action palette; results carry the action_id that blueprint_add_node accepts with node_type Action. */
+	static FString SearchNodes(const FString& ArgumentsJson);
+
+	/**
+	 * Apply an ordered list of graph edits as one undo transaction. Nodes added by the batch may carry a
+	 * local id that later operations use in place of a GUID; the Blueprint is structurally modified once at the end.
+	 */
+	static FString ApplyEdits(const FString& ArgumentsJson);
+
+	/** Compile a list of Blueprints, or every Blueprint depending on a root asset, in one batched flush. */
+	static FString CompileBatch(const FString& ArgumentsJson);
+
+	static constexpr int32 MaxApplyEditsOperations = 100;
+	static constexpr int32 MaxCompileBatchBlueprints = 100;
 };
@@ -2,12 +2,16 @@
 
 #include "UnrealGPTBlueprintGraph.h"
 
+#include "UnrealGPTBlueprintActionIndex.h"
+#include "Algo/StableSort.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "BlueprintCompilationManager.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraph/EdGraphPin.h"
 #include "EdGraph/EdGraphSchema.h"
 #include "EdGraphSchema_K2.h"
+#include "EdGraphToken.h"
 #include "Engine/Blueprint.h"
 #include "Engine/SCS_Node.h"
 #include "Engine/SimpleConstructionScript.h"
@@ -22,10 +26,13 @@
 #include "K2Node_VariableSet.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "Logging/TokenizedMessage.h"
 #include "Misc/PackageName.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/SavePackage.h"
 
 namespace UnrealGPTBlueprintGraphPrivate
@@ -54,6 +61,59 @@ namespace UnrealGPTBlueprintGraphPrivate
 		}
 	}
 
+	/** Resolve a compiler message to severity, text and the first node or pin token it references. */
+	static bool MakeCompileDiagnostic(const FTokenizedMessage& Message, FUnrealGPTCompileReport::FDiagnostic& OutDiagnostic)
+	{
+		switch (Message.GetSeverity())
+		{
+		case EMessageSeverity::Error: OutDiagnostic.Severity = TEXT("error"); break;
+		case EMessageSeverity::Warning:
+		case EMessageSeverity::PerformanceWarning: OutDiagnostic.Severity = TEXT("warning"); break;
+		case EMessageSeverity::Info: OutDiagnostic.Severity = TEXT("note"); break;
+		default: return false;
+		}
+
+		OutDiagnostic.Message = Message.ToText().ToString().TrimStartAndEnd();
+
+		const UEdGraphNode* Node = nullptr;
+		for (const TSharedRef<IMessageToken>& Token : Message.GetMessageTokens())
+		{
+			if (Token->GetType() == EMessageToken::EdGraph)
+			{
+				const FEdGraphToken& GraphToken = static_cast<const FEdGraphToken&>(*Token);
+				if (const UEdGraphPin* Pin = GraphToken.GetPin())
+				{
+					OutDiagnostic.PinName = Pin->PinName.ToString();
+					Node = Pin->GetOwningNodeUnchecked();
+				}
+				else
+				{
+					Node = Cast<const UEdGraphNode>(GraphToken.GetGraphObject());
+				}
+			}
+			else if (Token->GetType() == EMessageToken::Object)
+			{
+				Node = Cast<const UEdGraphNode>(static_cast<const FUObjectToken&>(*Token).GetObject().Get());
+			}
+
+			if (Node)
+			{
+				break;
+			}
+		}
+
+		if (Node)
+		{
+			OutDiagnostic.NodeGuid = Node->NodeGuid.ToString(EGuidFormats::DigitsWithHyphensInBraces);
+			OutDiagnostic.NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+			if (const UEdGraph* Graph = Node->GetGraph())
+			{
+				OutDiagnostic.GraphName = Graph->GetName();
+			}
+		}
+		return true;
+	}
+
 	static TSharedPtr<FJsonObject> SerializePin(const UEdGraphPin* Pin, bool bIncludeLinks)
 	{
 		TSharedPtr<FJsonObject> PinJson = MakeShared<FJsonObject>();
@@ -123,6 +183,181 @@ namespace UnrealGPTBlueprintGraphPrivate
 		return NodeJson;
 	}
 
+	static FString CompactPinTypeKey(const FEdGraphPinType& PinType)
+	{
+		FString Key = FUnrealGPTBlueprintGraph::PinTypeToString(PinType);
+		const UObject* SubObject = PinType.PinSubCategoryObject.Get();
+		if (SubObject && Key != TEXT("vector") && Key != TEXT("rotator") && Key != TEXT("transform"))
+		{
+			Key += TEXT(":") + SubObject->GetName();
+		}
+
+		if (PinType.IsArray())
+		{
+			return FString::Printf(TEXT("array<%s>"), *Key);
+		}
+		if (PinType.IsSet())
+		{
+			return FString::Printf(TEXT("set<%s>"), *Key);
+		}
+		if (PinType.IsMap())
+		{
+			return FString::Printf(TEXT("map<%s,%s>"), *Key, *PinType.PinValueType.TerminalCategory.ToString());
+		}
+		return Key;
+	}
+
+	/**
+	 * Compact encoding of Nodes: a node table, an interned pin-type table and a flat edge list. Each link is
+	 * emitted once, from its output side; an endpoint outside the node table is written as guid + pin name.
+	 */
+	static void SerializeCompactNodes(
+		const TArray<TPair<UEdGraphNode*, int32>>& Nodes,
+		bool bIncludePins,
+		const TSharedPtr<FJsonObject>& Details,
+		const TCHAR* NodesField)
+	{
+		TMap<const UEdGraphNode*, int32> NodeIndices;
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			NodeIndices.Add(Nodes[Index].Key, Index);
+		}
+
+		TMap<FString, int32> TypeIndices;
+		TArray<TSharedPtr<FJsonValue>> TypeTable;
+		TArray<TSharedPtr<FJsonValue>> NodeTable;
+		TArray<TSharedPtr<FJsonValue>> Edges;
+
+		auto AppendEndpoint = [&NodeIndices](TArray<TSharedPtr<FJsonValue>>& Edge, const UEdGraphPin* Pin, int32 PinIndex)
+		{
+			const UEdGraphNode* Node = Pin->GetOwningNode();
+			if (const int32* NodeIndex = NodeIndices.Find(Node))
+			{
+				Edge.Add(MakeShared<FJsonValueNumber>(*NodeIndex));
+				Edge.Add(MakeShared<FJsonValueNumber>(PinIndex));
+			}
+			else
+			{
+				Edge.Add(MakeShared<FJsonValueString>(Node->NodeGuid.ToString(EGuidFormats::DigitsWithHyphensInBraces)));
+				Edge.Add(MakeShared<FJsonValueString>(Pin->PinName.ToString()));
+			}
+		};
+
+		for (const TPair<UEdGraphNode*, int32>& Entry : Nodes)
+		{
+			const UEdGraphNode* Node = Entry.Key;
+			TArray<TSharedPtr<FJsonValue>> Row;
+			Row.Add(MakeShared<FJsonValueString>(Node->NodeGuid.ToString(EGuidFormats::DigitsWithHyphensInBraces)));
+			Row.Add(MakeShared<FJsonValueString>(Node->GetClass()->GetName()));
+			Row.Add(MakeShared<FJsonValueString>(Node->GetNodeTitle(ENodeTitleType::ListView).ToString()));
+			Row.Add(MakeShared<FJsonValueNumber>(Entry.Value));
+			Row.Add(MakeShared<FJsonValueNumber>(Node->NodePosX));
+			Row.Add(MakeShared<FJsonValueNumber>(Node->NodePosY));
+
+			if (bIncludePins)
+			{
+				TArray<TSharedPtr<FJsonValue>> Pins;
+				for (int32 PinIndex = 0; PinIndex < Node->Pins.Num(); ++PinIndex)
+				{
+					// Null slots are kept so pin indices always match the node's own pin order.
+					const UEdGraphPin* Pin = Node->Pins[PinIndex];
+					if (!Pin)
+					{
+						Pins.Add(MakeShared<FJsonValueNull>());
+						continue;
+					}
+
+					const FString TypeKey = CompactPinTypeKey(Pin->PinType);
+					int32 TypeIndex = INDEX_NONE;
+					if (const int32* Existing = TypeIndices.Find(TypeKey))
+					{
+						TypeIndex = *Existing;
+					}
+					else
+					{
+						TypeIndex = TypeTable.Add(MakeShared<FJsonValueString>(TypeKey));
+						TypeIndices.Add(TypeKey, TypeIndex);
+					}
+
+					TArray<TSharedPtr<FJsonValue>> PinRow;
+					PinRow.Add(MakeShared<FJsonValueString>(Pin->PinName.ToString()));
+					PinRow.Add(MakeShared<FJsonValueString>(Pin->Direction == EGPD_Output ? TEXT("o") : TEXT("i")));
+					PinRow.Add(MakeShared<FJsonValueNumber>(TypeIndex));
+					if (!Pin->DefaultValue.IsEmpty())
+					{
+						PinRow.Add(MakeShared<FJsonValueString>(Pin->DefaultValue));
+					}
+					Pins.Add(MakeShared<FJsonValueArray>(PinRow));
+
+					for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+					{
+						if (!LinkedPin || !LinkedPin->GetOwningNode())
+						{
+							continue;
+						}
+
+						// Links between two listed nodes are written from the output side only.
+						const bool bLinkedListed = NodeIndices.Contains(LinkedPin->GetOwningNode());
+						if (Pin->Direction != EGPD_Output && bLinkedListed)
+						{
+							continue;
+						}
+
+						const int32 LinkedPinIndex = bLinkedListed ? LinkedPin->GetOwningNode()->Pins.IndexOfByKey(LinkedPin) : INDEX_NONE;
+						TArray<TSharedPtr<FJsonValue>> Edge;
+						if (Pin->Direction == EGPD_Output)
+						{
+							AppendEndpoint(Edge, Pin, PinIndex);
+							AppendEndpoint(Edge, LinkedPin, LinkedPinIndex);
+						}
+						else
+						{
+							AppendEndpoint(Edge, LinkedPin, LinkedPinIndex);
+							AppendEndpoint(Edge, Pin, PinIndex);
+						}
+						Edges.Add(MakeShared<FJsonValueArray>(Edge));
+					}
+				}
+				Row.Add(MakeShared<FJsonValueArray>(Pins));
+			}
+
+			NodeTable.Add(MakeShared<FJsonValueArray>(Row));
+		}
+
+		Details->SetStringField(TEXT("format"), TEXT("compact"));
+		Details->SetStringField(
+			TEXT("legend"),
+			TEXT("node: [guid, class, title, graph index, x, y, pins]; pin: [name, i|o, pin_types index, default?]; ")
+			TEXT("edge: [src node, src pin, dst node, dst pin] by index, or guid + pin name for nodes not listed"));
+		Details->SetArrayField(NodesField, NodeTable);
+		if (bIncludePins)
+		{
+			Details->SetArrayField(TEXT("pin_types"), TypeTable);
+			Details->SetArrayField(TEXT("edges"), Edges);
+		}
+	}
+
+	constexpr int32 LayoutColumnWidth = 400;
+	/** Width assumed for a node when checking the placed block against fixed nodes. */
+	constexpr int32 LayoutNodeWidth = 320;
+	constexpr int32 LayoutRowGap = 48;
+	constexpr int32 LayoutGridSize = 16;
+
+	/** Slate sizes are unknown outside the graph editor, so height is estimated from the visible pin rows. */
+	static int32 EstimateNodeHeight(const UEdGraphNode* Node)
+	{
+		int32 Inputs = 0;
+		int32 Outputs = 0;
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (Pin && !Pin->bHidden)
+			{
+				(Pin->Direction == EGPD_Input ? Inputs : Outputs) += 1;
+			}
+		}
+		return 48 + 26 * FMath::Max(Inputs, Outputs);
+	}
+
 	static void CollectGraphs(UBlueprint* Blueprint, TArray<UEdGraph*>& OutGraphs)
 	{
 		OutGraphs.Reset();
@@ -201,6 +436,330 @@ namespace UnrealGPTBlueprintGraphPrivate
 		}
 		return Function;
 	}
+
+	struct FNodeFingerprint
+	{
+		uint32 Hash = 0;
+		FName GraphName;
+
+		bool operator==(const FNodeFingerprint& Other) const { return Hash == Other.Hash && GraphName == Other.GraphName; }
+		bool operator!=(const FNodeFingerprint& Other) const { return !(*this == Other); }
+	};
+
+	/** Content hashes of everything blueprint_query reports, used to diff two queries of one asset. */
+	struct FBlueprintFingerprint
+	{
+		TMap<FGuid, FNodeFingerprint> Nodes;
+		uint32 VariablesHash = 0;
+		uint32 ComponentsHash = 0;
+		uint32 GraphsHash = 0;
+
+		bool operator==(const FBlueprintFingerprint& Other) const
+		{
+			if (VariablesHash != Other.VariablesHash || ComponentsHash != Other.ComponentsHash
+				|| GraphsHash != Other.GraphsHash || Nodes.Num() != Other.Nodes.Num())
+			{
+				return false;
+			}
+			for (const TPair<FGuid, FNodeFingerprint>& Pair : Nodes)
+			{
+				const FNodeFingerprint* OtherNode = Other.Nodes.Find(Pair.Key);
+				if (!OtherNode || *OtherNode != Pair.Value)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	// FString's GetTypeHash ignores case, which would hide edits such as "true" -> "True".
+	static uint32 HashStringExact(const FString& Value)
+	{
+		return FCrc::StrCrc32(*Value);
+	}
+
+	static uint32 HashNode(const UEdGraphNode* Node)
+	{
+		uint32 Hash = GetTypeHash(Node->GetClass()->GetFName());
+		Hash = HashCombine(Hash, GetTypeHash(Node->NodePosX));
+		Hash = HashCombine(Hash, GetTypeHash(Node->NodePosY));
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (!Pin)
+			{
+				continue;
+			}
+			Hash = HashCombine(Hash, GetTypeHash(Pin->PinName));
+			Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Pin->Direction)));
+			Hash = HashCombine(Hash, GetTypeHash(Pin->PinType.PinCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Pin->PinType.PinSubCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Pin->PinType.PinSubCategoryObject.Get()));
+			Hash = HashCombine(Hash, HashStringExact(Pin->DefaultValue));
+			Hash = HashCombine(Hash, GetTypeHash(Pin->DefaultObject.Get()));
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				if (LinkedPin && LinkedPin->GetOwningNode())
+				{
+					Hash = HashCombine(Hash, GetTypeHash(LinkedPin->GetOwningNode()->NodeGuid));
+					Hash = HashCombine(Hash, GetTypeHash(LinkedPin->PinName));
+				}
+			}
+		}
+		return Hash;
+	}
+
+	/**
+	 * Recent fingerprints per asset, keyed by the revision token handed out with each blueprint_query.
+	 * Pin links and defaults change without a graph notification, so revisions compare content hashes
+	 * rather than counting notifications. Tokens carry a per-session tag and never match after a restart.
+	 */
+	class FRevisionStore
+	{
+	public:
+		static constexpr int32 MaxRevisionsPerAsset = 8;
+		static constexpr int32 MaxAssets = 64;
+
+		static FRevisionStore& Get()
+		{
+			static FRevisionStore Instance;
+			return Instance;
+		}
+
+		/** Returns the token for Fingerprint, reusing the latest one when nothing changed. */
+		FString Commit(const FString& AssetPath, FBlueprintFingerprint&& Fingerprint)
+		{
+			FAssetHistory& History = Assets.FindOrAdd(AssetPath);
+			History.LastUse = ++UseCounter;
+			if (History.Revisions.Num() > 0 && History.Revisions.Last().Value == Fingerprint)
+			{
+				return History.Revisions.Last().Key;
+			}
+
+			const FString Token = FString::Printf(TEXT("%s-%d"), *SessionTag, ++RevisionCounter);
+			if (History.Revisions.Num() >= MaxRevisionsPerAsset)
+			{
+				History.Revisions.RemoveAt(0);
+			}
+			History.Revisions.Emplace(Token, MoveTemp(Fingerprint));
+
+			if (Assets.Num() > MaxAssets)
+			{
+				EvictLeastRecentlyUsed();
+			}
+			return Token;
+		}
+
+		const FBlueprintFingerprint* Find(const FString& AssetPath, const FString& Token) const
+		{
+			if (const FAssetHistory* History = Assets.Find(AssetPath))
+			{
+				for (const TPair<FString, FBlueprintFingerprint>& Revision : History->Revisions)
+				{
+					if (Revision.Key == Token)
+					{
+						return &Revision.Value;
+					}
+				}
+			}
+			return nullptr;
+		}
+
+	private:
+		struct FAssetHistory
+		{
+			uint64 LastUse = 0;
+			TArray<TPair<FString, FBlueprintFingerprint>> Revisions;
+		};
+
+		FRevisionStore()
+			: SessionTag(FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(8).ToLower())
+		{
+		}
+
+		void EvictLeastRecentlyUsed()
+		{
+			const FString* Oldest = nullptr;
+			uint64 OldestUse = MAX_uint64;
+			for (const TPair<FString, FAssetHistory>& Pair : Assets)
+			{
+				if (Pair.Value.LastUse < OldestUse)
+				{
+					OldestUse = Pair.Value.LastUse;
+					Oldest = &Pair.Key;
+				}
+			}
+			if (Oldest)
+			{
+				Assets.Remove(FString(*Oldest));
+			}
+		}
+
+		FString SessionTag;
+		int32 RevisionCounter = 0;
+		uint64 UseCounter = 0;
+		TMap<FString, FAssetHistory> Assets;
+	};
+
+	/**
+	 * Per-graph index from node GUID to node and from pin name to pin slot, so repeated lookups during
+	 * batch edits skip the linear scans. An entry is dropped whenever its graph broadcasts a change;
+	 * every hit is re-validated, so an edit that bypasses the notification only costs a rebuild.
+	 * Game thread only.
+	 */
+	class FGraphLookupCache
+	{
+	public:
+		static FGraphLookupCache& Get()
+		{
+			static FGraphLookupCache Instance;
+			return Instance;
+		}
+
+		UEdGraphNode* FindNode(UEdGraph* Graph, const FGuid& NodeGuid)
+		{
+			FGraphEntry& Entry = FindOrAddEntry(Graph);
+			const bool bWasIndexed = Entry.bNodesValid;
+			if (UEdGraphNode* Node = LookupNode(Entry, Graph, NodeGuid))
+			{
+				return Node;
+			}
+
+			// A miss on an older index may be a node added without a notification; a fresh index is final.
+			if (!bWasIndexed)
+			{
+				return nullptr;
+			}
+			RebuildNodes(Entry, Graph);
+			return LookupNode(Entry, Graph, NodeGuid);
+		}
+
+		UEdGraphPin* FindPin(UEdGraphNode* Node, const FName PinName)
+		{
+			UEdGraph* Graph = Node ? Node->GetGraph() : nullptr;
+			if (!Graph)
+			{
+				return Node ? Node->FindPin(PinName) : nullptr;
+			}
+
+			FGraphEntry& Entry = FindOrAddEntry(Graph);
+			TMap<FName, int32>& PinSlots = Entry.PinSlots.FindOrAdd(TObjectKey<UEdGraphNode>(Node));
+			if (UEdGraphPin* Pin = LookupPin(PinSlots, Node, PinName))
+			{
+				return Pin;
+			}
+
+			// Pins are recreated by node reconstruction without a graph notification, so re-index on a miss.
+			PinSlots.Reset();
+			for (int32 Index = 0; Index < Node->Pins.Num(); ++Index)
+			{
+				if (Node->Pins[Index])
+				{
+					PinSlots.FindOrAdd(Node->Pins[Index]->PinName, Index);
+				}
+			}
+			return LookupPin(PinSlots, Node, PinName);
+		}
+
+		/** Unbind from every graph still alive and drop all entries. */
+		void Reset()
+		{
+			for (TPair<TWeakObjectPtr<UEdGraph>, FGraphEntry>& Pair : Entries)
+			{
+				RemoveHandler(Pair.Key, Pair.Value);
+			}
+			Entries.Reset();
+		}
+
+	private:
+		struct FGraphEntry
+		{
+			FDelegateHandle ChangedHandle;
+			bool bNodesValid = false;
+			TMap<FGuid, TWeakObjectPtr<UEdGraphNode>> Nodes;
+			TMap<TObjectKey<UEdGraphNode>, TMap<FName, int32>> PinSlots;
+		};
+
+		FGraphEntry& FindOrAddEntry(UEdGraph* Graph)
+		{
+			const TWeakObjectPtr<UEdGraph> Key(Graph);
+			if (FGraphEntry* Existing = Entries.Find(Key))
+			{
+				return *Existing;
+			}
+
+			for (auto It = Entries.CreateIterator(); It; ++It)
+			{
+				if (!It->Key.IsValid())
+				{
+					RemoveHandler(It->Key, It->Value);
+					It.RemoveCurrent();
+				}
+			}
+
+			FGraphEntry& Entry = Entries.Add(Key);
+			Entry.ChangedHandle = Graph->AddOnGraphChangedHandler(FOnGraphChanged::FDelegate::CreateLambda(
+				[Key](const FEdGraphEditAction&)
+				{
+					FGraphLookupCache::Get().Invalidate(Key);
+				}));
+			return Entry;
+		}
+
+		static void RemoveHandler(const TWeakObjectPtr<UEdGraph>& Key, const FGraphEntry& Entry)
+		{
+			// A graph that is being destroyed still owns its delegate list until it is freed.
+			if (UEdGraph* Graph = Key.Get(true))
+			{
+				Graph->RemoveOnGraphChangedHandler(Entry.ChangedHandle);
+			}
+		}
+
+		void Invalidate(const TWeakObjectPtr<UEdGraph>& Key)
+		{
+			if (FGraphEntry* Entry = Entries.Find(Key))
+			{
+				Entry->bNodesValid = false;
+				Entry->Nodes.Reset();
+				Entry->PinSlots.Reset();
+			}
+		}
+
+		static void RebuildNodes(FGraphEntry& Entry, UEdGraph* Graph)
+		{
+			Entry.Nodes.Reset();
+			Entry.Nodes.Reserve(Graph->Nodes.Num());
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (Node)
+				{
+					Entry.Nodes.FindOrAdd(Node->NodeGuid, Node);
+				}
+			}
+			Entry.bNodesValid = true;
+		}
+
+		static UEdGraphNode* LookupNode(FGraphEntry& Entry, UEdGraph* Graph, const FGuid& NodeGuid)
+		{
+			if (!Entry.bNodesValid)
+			{
+				RebuildNodes(Entry, Graph);
+			}
+
+			const TWeakObjectPtr<UEdGraphNode>* Found = Entry.Nodes.Find(NodeGuid);
+			UEdGraphNode* Node = Found ? Found->Get() : nullptr;
+			return Node && Node->GetGraph() == Graph && Node->NodeGuid == NodeGuid ? Node : nullptr;
+		}
+
+		static UEdGraphPin* LookupPin(const TMap<FName, int32>& PinSlots, UEdGraphNode* Node, const FName PinName)
+		{
+			const int32* Slot = PinSlots.Find(PinName);
+			UEdGraphPin* Pin = Slot && Node->Pins.IsValidIndex(*Slot) ? Node->Pins[*Slot] : nullptr;
+			return Pin && Pin->PinName == PinName ? Pin : nullptr;
+		}
+
+		TMap<TWeakObjectPtr<UEdGraph>, FGraphEntry> Entries;
+	};
 }
 
 FString FUnrealGPTBlueprintGraph::SerializeJson(const TSharedPtr<FJsonObject>& Root)
@@ -337,24 +896,33 @@ UEdGraphNode* FUnrealGPTBlueprintGraph::FindNodeByGuid(UEdGraph* Graph, const FS
 		return nullptr;
 	}
 
-	for (UEdGraphNode* Node : Graph->Nodes)
+	if (UEdGraphNode* Node = UnrealGPTBlueprintGraphPrivate::FGraphLookupCache::Get().FindNode(Graph, NodeGuid))
 	{
-		if (Node && Node->NodeGuid == NodeGuid)
-		{
-			return Node;
-		}
+		return Node;
 	}
 
 	OutError = FString::Printf(TEXT("Node with guid '%s' not found in graph"), *NodeGuidStr);
 	return nullptr;
 }
 
+UEdGraphPin* FUnrealGPTBlueprintGraph::FindPin(UEdGraphNode* Node, const FString& PinName)
+{
+	return UnrealGPTBlueprintGraphPrivate::FGraphLookupCache::Get().FindPin(Node, FName(*PinName));
+}
+
+void FUnrealGPTBlueprintGraph::ResetLookupCache()
+{
+	UnrealGPTBlueprintGraphPrivate::FGraphLookupCache::Get().Reset();
+}
+
 TSharedPtr<FJsonObject> FUnrealGPTBlueprintGraph::SerializeBlueprintSummary(
 	UBlueprint* Blueprint,
 	const FString& AssetPath,
 	const FString& GraphNameFilter,
 	const FString& NodeGuidFilter,
-	bool bIncludePins)
+	bool bIncludePins,
+	const FString& SinceRevision,
+	bool bCompact)
 {
 	using namespace UnrealGPTBlueprintGraphPrivate;
 
@@ -367,18 +935,25 @@ TSharedPtr<FJsonObject> FUnrealGPTBlueprintGraph::SerializeBlueprintSummary(
 	}
 	Details->SetStringField(TEXT("compile_status"), BlueprintStatusToString(Blueprint->Status));
 
+	FBlueprintFingerprint Fingerprint;
+
 	TArray<TSharedPtr<FJsonValue>> Variables;
 	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
 	{
+		const FString TypeString = PinTypeToString(Variable.VarType);
 		TSharedPtr<FJsonObject> VarJson = MakeShared<FJsonObject>();
 		VarJson->SetStringField(TEXT("name"), Variable.VarName.ToString());
-		VarJson->SetStringField(TEXT("type"), PinTypeToString(Variable.VarType));
+		VarJson->SetStringField(TEXT("type"), TypeString);
 		VarJson->SetStringField(TEXT("default_value"), Variable.DefaultValue);
 		VarJson->SetBoolField(TEXT("instance_editable"), (Variable.PropertyFlags & CPF_Edit) != 0);
 		VarJson->SetBoolField(TEXT("expose_on_spawn"), (Variable.PropertyFlags & CPF_ExposeOnSpawn) != 0);
 		Variables.Add(MakeShared<FJsonValueObject>(VarJson));
+
+		Fingerprint.VariablesHash = HashCombine(Fingerprint.VariablesHash, GetTypeHash(Variable.VarName));
+		Fingerprint.VariablesHash = HashCombine(Fingerprint.VariablesHash, HashStringExact(TypeString));
+		Fingerprint.VariablesHash = HashCombine(Fingerprint.VariablesHash, HashStringExact(Variable.DefaultValue));
+		Fingerprint.VariablesHash = HashCombine(Fingerprint.VariablesHash, GetTypeHash(Variable.PropertyFlags & (CPF_Edit | CPF_ExposeOnSpawn)));
 	}
-	Details->SetArrayField(TEXT("variables"), Variables);
 
 	TArray<TSharedPtr<FJsonValue>> Components;
 	if (Blueprint->SimpleConstructionScript)
@@ -394,15 +969,76 @@ TSharedPtr<FJsonObject> FUnrealGPTBlueprintGraph::SerializeBlueprintSummary(
 			CompJson->SetStringField(TEXT("name"), Node->GetVariableName().ToString());
 			CompJson->SetStringField(TEXT("class"), Node->ComponentClass->GetPathName());
 			Components.Add(MakeShared<FJsonValueObject>(CompJson));
+
+			Fingerprint.ComponentsHash = HashCombine(Fingerprint.ComponentsHash, GetTypeHash(Node->GetVariableName()));
+			Fingerprint.ComponentsHash = HashCombine(Fingerprint.ComponentsHash, GetTypeHash(Node->ComponentClass->GetFName()));
 		}
 	}
-	Details->SetArrayField(TEXT("components"), Components);
 
 	TArray<UEdGraph*> Graphs;
 	UnrealGPTBlueprintGraphPrivate::CollectGraphs(Blueprint, Graphs);
 
+	// The revision covers the whole Blueprint, so every graph is fingerprinted regardless of the filters.
+	for (UEdGraph* Graph : Graphs)
+	{
+		Fingerprint.GraphsHash = HashCombine(Fingerprint.GraphsHash, GetTypeHash(Graph->GetFName()));
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node)
+			{
+				Fingerprint.Nodes.Add(Node->NodeGuid, FNodeFingerprint{ HashNode(Node), Graph->GetFName() });
+			}
+		}
+	}
+
+	// Both fingerprints are copied out before Commit, which may evict the baseline.
+	TOptional<FBlueprintFingerprint> Baseline;
+	if (!SinceRevision.IsEmpty())
+	{
+		if (const FBlueprintFingerprint* Found = FRevisionStore::Get().Find(AssetPath, SinceRevision))
+		{
+			Baseline = *Found;
+		}
+	}
+	const bool bDelta = Baseline.IsSet();
+	TMap<FGuid, FNodeFingerprint> CurrentNodes = bDelta ? Fingerprint.Nodes : TMap<FGuid, FNodeFingerprint>();
+	const uint32 VariablesHash = Fingerprint.VariablesHash;
+	const uint32 ComponentsHash = Fingerprint.ComponentsHash;
+
+	const FString Revision = FRevisionStore::Get().Commit(AssetPath, MoveTemp(Fingerprint));
+	Details->SetStringField(TEXT("revision"), Revision);
+
+	if (!SinceRevision.IsEmpty() && !bDelta)
+	{
+		Details->SetStringField(TEXT("delta_unavailable"), TEXT("since_revision is unknown or expired; returning the full Blueprint."));
+	}
+	if (bDelta)
+	{
+		Details->SetBoolField(TEXT("delta"), true);
+		Details->SetStringField(TEXT("since_revision"), SinceRevision);
+		Details->SetBoolField(TEXT("unchanged"), Revision == SinceRevision);
+	}
+
+	if (!bDelta || Baseline->VariablesHash != VariablesHash)
+	{
+		Details->SetArrayField(TEXT("variables"), Variables);
+	}
+	if (!bDelta || Baseline->ComponentsHash != ComponentsHash)
+	{
+		Details->SetArrayField(TEXT("components"), Components);
+	}
+
 	TArray<TSharedPtr<FJsonValue>> GraphSummaries;
-	TArray<TSharedPtr<FJsonValue>> NodeSummaries;
+	TArray<UEdGraph*> ListedGraphs;
+	TArray<TPair<UEdGraphNode*, int32>> SelectedNodes;
+
+	// Parsed once so nodes compare by value; a filter that is not a GUID matches nothing, as before.
+	FGuid FilterGuid;
+	const bool bFilterByGuid = !NodeGuidFilter.IsEmpty();
+	if (bFilterByGuid && !FGuid::Parse(NodeGuidFilter, FilterGuid))
+	{
+		FilterGuid.Invalidate();
+	}
 
 	for (UEdGraph* Graph : Graphs)
 	{
@@ -420,6 +1056,7 @@ TSharedPtr<FJsonObject> FUnrealGPTBlueprintGraph::SerializeBlueprintSummary(
 		GraphJson->SetStringField(TEXT("name"), Graph->GetName());
 		GraphJson->SetNumberField(TEXT("node_count"), Graph->Nodes.Num());
 		GraphSummaries.Add(MakeShared<FJsonValueObject>(GraphJson));
+		const int32 GraphIndex = ListedGraphs.Add(Graph);
 
 		for (UEdGraphNode* Node : Graph->Nodes)
 		{
@@ -428,19 +1065,61 @@ TSharedPtr<FJsonObject> FUnrealGPTBlueprintGraph::SerializeBlueprintSummary(
 				continue;
 			}
 
-			if (!NodeGuidFilter.IsEmpty() && Node->NodeGuid.ToString(EGuidFormats::DigitsWithHyphensInBraces) != NodeGuidFilter)
+			if (bFilterByGuid && Node->NodeGuid != FilterGuid)
 			{
 				continue;
 			}
 
-			TSharedPtr<FJsonObject> NodeJson = SerializeNode(Node, bIncludePins);
-			NodeJson->SetStringField(TEXT("graph_name"), Graph->GetName());
-			NodeSummaries.Add(MakeShared<FJsonValueObject>(NodeJson));
-		}
-	}
+			if (bDelta)
+			{
+				const FNodeFingerprint* Before = Baseline->Nodes.Find(Node->NodeGuid);
+				const FNodeFingerprint* Now = CurrentNodes.Find(Node->NodeGuid);
+				if (Before && Now && *Before == *Now)
+				{
+					continue;
+				}
+			}
+
+			SelectedNodes.Emplace(Node, GraphIndex);
+		}
+	}
 
 	Details->SetArrayField(TEXT("graphs"), GraphSummaries);
-	Details->SetArrayField(TEXT("nodes"), NodeSummaries);
+	const TCHAR* NodesField = bDelta ? TEXT("changed_nodes") : TEXT("nodes");
+	if (bCompact)
+	{
+		SerializeCompactNodes(SelectedNodes, bIncludePins, Details, NodesField);
+	}
+	else
+	{
+		TArray<TSharedPtr<FJsonValue>> NodeSummaries;
+		for (const TPair<UEdGraphNode*, int32>& Entry : SelectedNodes)
+		{
+			TSharedPtr<FJsonObject> NodeJson = SerializeNode(Entry.Key, bIncludePins);
+			NodeJson->SetStringField(TEXT("graph_name"), ListedGraphs[Entry.Value]->GetName());
+			NodeSummaries.Add(MakeShared<FJsonValueObject>(NodeJson));
+		}
+		Details->SetArrayField(NodesField, NodeSummaries);
+	}
+
+	if (bDelta)
+	{
+		TArray<TSharedPtr<FJsonValue>> RemovedNodes;
+		for (const TPair<FGuid, FNodeFingerprint>& Pair : Baseline->Nodes)
+		{
+			if (CurrentNodes.Contains(Pair.Key)
+				|| (bFilterByGuid && Pair.Key != FilterGuid)
+				|| (!GraphNameFilter.IsEmpty() && !Pair.Value.GraphName.ToString().Equals(GraphNameFilter, ESearchCase::IgnoreCase)))
+			{
+				continue;
+			}
+			TSharedPtr<FJsonObject> RemovedJson = MakeShared<FJsonObject>();
+			RemovedJson->SetStringField(TEXT("guid"), Pair.Key.ToString(EGuidFormats::DigitsWithHyphensInBraces));
+			RemovedJson->SetStringField(TEXT("graph_name"), Pair.Value.GraphName.ToString());
+			RemovedNodes.Add(MakeShared<FJsonValueObject>(RemovedJson));
+		}
+		Details->SetArrayField(TEXT("removed_nodes"), RemovedNodes);
+	}
 	return Details;
 }
 
@@ -570,7 +1249,8 @@ const TArray<FString>& FUnrealGPTBlueprintGraph::GetSupportedNodeTypes()
 		TEXT("Branch"),
 		TEXT("Sequence"),
 		TEXT("Self"),
-		TEXT("PrintString")
+		TEXT("PrintString"),
+		TEXT("Action")
 	};
 	return Supported;
 }
@@ -582,7 +1262,8 @@ bool FUnrealGPTBlueprintGraph::AddNode(
 	const FVector2D& Position,
 	const TSharedPtr<FJsonObject>& Params,
 	FString& OutNodeGuid,
-	FString& OutError)
+	FString& OutError,
+	bool bMarkStructurallyModified)
 {
 	if (!Blueprint || !Graph)
 	{
@@ -596,7 +1277,10 @@ bool FUnrealGPTBlueprintGraph::AddNode(
 		return Supported.Equals(NormalizedType, ESearchCase::IgnoreCase) || NodeType.Equals(Supported, ESearchCase::IgnoreCase);
 	}))
 	{
-		OutError = FString::Printf(TEXT("Unsupported node_type '%s'. Supported: %s"), *NodeType, *FString::Join(GetSupportedNodeTypes(), TEXT(", ")));
+		OutError = FString::Printf(
+			TEXT("Unsupported node_type '%s'. Supported: %s. For any other palette node, use node_type Action with an action_id from blueprint_search_nodes"),
+			*NodeType,
+			*FString::Join(GetSupportedNodeTypes(), TEXT(", ")));
 		return false;
 	}
 
@@ -724,6 +1408,26 @@ bool FUnrealGPTBlueprintGraph::AddNode(
 		NewNode = SelfNode;
 	}
 
+	else if (NormalizedType.Equals(TEXT("Action"), ESearchCase::IgnoreCase))
+	{
+		FString ActionKey;
+		if (Params.IsValid() && !Params->TryGetStringField(TEXT("action_id"), ActionKey))
+		{
+			Params->TryGetStringField(TEXT("action"), ActionKey);
+		}
+		if (ActionKey.IsEmpty())
+		{
+			OutError = TEXT("Action requires params.action_id from blueprint_search_nodes, or params.action as an exact \"Category|Name\" palette path");
+			return false;
+		}
+
+		NewNode = FUnrealGPTBlueprintActionIndex::Get().Spawn(Graph, ActionKey, Position, OutError);
+		if (!NewNode)
+		{
+			return false;
+		}
+	}
+
 	if (!NewNode)
 	{
 		OutError = FString::Printf(TEXT("Failed to create node_type '%s'"), *NodeType);
@@ -734,7 +1438,313 @@ bool FUnrealGPTBlueprintGraph::AddNode(
 	NewNode->NodePosY = FMath::RoundToInt(Position.Y);
 	OutNodeGuid = NewNode->NodeGuid.ToString(EGuidFormats::DigitsWithHyphensInBraces);
 
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	if (bMarkStructurallyModified)
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	}
+	return true;
+}
+
+bool FUnrealGPTBlueprintGraph::LayoutNodes(UEdGraph* Graph, const TArray<UEdGraphNode*>& NodesToPlace)
+{
+	using namespace UnrealGPTBlueprintGraphPrivate;
+
+	if (!Graph || NodesToPlace.Num() == 0)
+	{
+		return false;
+	}
+
+	// Index the movable nodes; everything else in the graph is an anchor that keeps its position.
+	TArray<UEdGraphNode*> Nodes;
+	TMap<const UEdGraphNode*, int32> IndexOf;
+	for (UEdGraphNode* Node : NodesToPlace)
+	{
+		if (Node && Node->GetGraph() == Graph && !IndexOf.Contains(Node))
+		{
+			IndexOf.Add(Node, Nodes.Add(Node));
+		}
+	}
+	const int32 Count = Nodes.Num();
+	if (Count == 0)
+	{
+		return false;
+	}
+
+	TArray<TArray<int32>> Successors;
+	TArray<TArray<int32>> Predecessors;
+	TArray<bool> HasExec;
+	Successors.SetNum(Count);
+	Predecessors.SetNum(Count);
+	HasExec.Init(false, Count);
+
+	const UEdGraphNode* AnchorNode = nullptr;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		for (const UEdGraphPin* Pin : Nodes[Index]->Pins)
+		{
+			if (!Pin)
+			{
+				continue;
+			}
+			HasExec[Index] |= Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				const UEdGraphNode* Other = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+				if (!Other)
+				{
+					continue;
+				}
+
+				const int32* OtherIndex = IndexOf.Find(Other);
+				if (!OtherIndex)
+				{
+					// The right-most fixed node feeding the new ones decides where the block starts.
+					if (Pin->Direction == EGPD_Input && (!AnchorNode || Other->NodePosX > AnchorNode->NodePosX))
+					{
+						AnchorNode = Other;
+					}
+					continue;
+				}
+				if (Pin->Direction == EGPD_Output && *OtherIndex != Index)
+				{
+					Successors[Index].AddUnique(*OtherIndex);
+				}
+			}
+		}
+	}
+
+	// Break cycles: an iterative DFS drops edges that point back into the active path.
+	{
+		TArray<uint8> State;
+		State.Init(0, Count);
+		for (int32 Root = 0; Root < Count; ++Root)
+		{
+			if (State[Root] != 0)
+			{
+				continue;
+			}
+			TArray<TPair<int32, int32>> Stack;
+			Stack.Emplace(Root, 0);
+			State[Root] = 1;
+			while (Stack.Num() > 0)
+			{
+				TPair<int32, int32>& Top = Stack.Last();
+				TArray<int32>& Out = Successors[Top.Key];
+				if (Top.Value >= Out.Num())
+				{
+					State[Top.Key] = 2;
+					Stack.Pop(EAllowShrinking::No);
+					continue;
+				}
+				const int32 Next = Out[Top.Value];
+				if (State[Next] == 1)
+				{
+					Out.RemoveAt(Top.Value);
+					continue;
+				}
+				++Top.Value;
+				if (State[Next] == 0)
+				{
+					State[Next] = 1;
+					Stack.Emplace(Next, 0);
+				}
+			}
+		}
+	}
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		for (const int32 Next : Successors[Index])
+		{
+			Predecessors[Next].Add(Index);
+		}
+	}
+
+	// Longest-path layering in topological order, with sources taken in exec-flow (then top-to-bottom) order.
+	TArray<int32> Order;
+	{
+		TArray<int32> InDegree;
+		InDegree.SetNumZeroed(Count);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			InDegree[Index] = Predecessors[Index].Num();
+		}
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			if (InDegree[Index] == 0)
+			{
+				Order.Add(Index);
+			}
+		}
+		Order.StableSort([&HasExec](int32 A, int32 B) { return HasExec[A] && !HasExec[B]; });
+		for (int32 Cursor = 0; Cursor < Order.Num(); ++Cursor)
+		{
+			for (const int32 Next : Successors[Order[Cursor]])
+			{
+				if (--InDegree[Next] == 0)
+				{
+					Order.Add(Next);
+				}
+			}
+		}
+	}
+
+	TArray<int32> Layer;
+	Layer.SetNumZeroed(Count);
+	for (const int32 Index : Order)
+	{
+		for (const int32 Next : Successors[Index])
+		{
+			Layer[Next] = FMath::Max(Layer[Next], Layer[Index] + 1);
+		}
+	}
+
+	// Pure nodes only feed data, so pull them right to sit just before their first consumer.
+	for (int32 Cursor = Order.Num() - 1; Cursor >= 0; --Cursor)
+	{
+		const int32 Index = Order[Cursor];
+		if (HasExec[Index] || Successors[Index].Num() == 0)
+		{
+			continue;
+		}
+		int32 Nearest = MAX_int32;
+		for (const int32 Next : Successors[Index])
+		{
+			Nearest = FMath::Min(Nearest, Layer[Next]);
+		}
+		Layer[Index] = FMath::Max(Layer[Index], Nearest - 1);
+	}
+
+	int32 LayerCount = 0;
+	for (const int32 Value : Layer)
+	{
+		LayerCount = FMath::Max(LayerCount, Value + 1);
+	}
+
+	TArray<TArray<int32>> Layers;
+	Layers.SetNum(LayerCount);
+	for (const int32 Index : Order)
+	{
+		Layers[Layer[Index]].Add(Index);
+	}
+
+	// Barycenter sweeps to reduce crossings, alternating downstream and upstream.
+	TArray<float> Rank;
+	Rank.SetNumZeroed(Count);
+	auto AssignRanks = [&Layers, &Rank](int32 LayerIndex)
+	{
+		for (int32 Position = 0; Position < Layers[LayerIndex].Num(); ++Position)
+		{
+			Rank[Layers[LayerIndex][Position]] = static_cast<float>(Position);
+		}
+	};
+	for (int32 LayerIndex = 0; LayerIndex < LayerCount; ++LayerIndex)
+	{
+		AssignRanks(LayerIndex);
+	}
+
+	constexpr int32 Sweeps = 4;
+	TArray<float> Barycenter;
+	Barycenter.SetNumZeroed(Count);
+	for (int32 Sweep = 0; Sweep < Sweeps; ++Sweep)
+	{
+		const bool bDownstream = Sweep % 2 == 0;
+		const TArray<TArray<int32>>& Neighbours = bDownstream ? Predecessors : Successors;
+		for (int32 Step = 1; Step < LayerCount; ++Step)
+		{
+			const int32 LayerIndex = bDownstream ? Step : LayerCount - 1 - Step;
+			TArray<int32>& Members = Layers[LayerIndex];
+			for (const int32 Index : Members)
+			{
+				float Sum = 0.0f;
+				for (const int32 Neighbour : Neighbours[Index])
+				{
+					Sum += Rank[Neighbour];
+				}
+				Barycenter[Index] = Neighbours[Index].Num() > 0 ? Sum / Neighbours[Index].Num() : Rank[Index];
+			}
+			Members.StableSort([&Barycenter](int32 A, int32 B) { return Barycenter[A] < Barycenter[B]; });
+			AssignRanks(LayerIndex);
+		}
+	}
+
+	// Stack each layer top-down from Y = 0; a node aims for the mean Y of its placed predecessors so exec chains stay level.
+	TArray<float> PosY;
+	PosY.SetNumZeroed(Count);
+	float BlockHeight = 0.0f;
+	for (int32 LayerIndex = 0; LayerIndex < LayerCount; ++LayerIndex)
+	{
+		float Cursor = 0.0f;
+		for (const int32 Index : Layers[LayerIndex])
+		{
+			float Desired = Cursor;
+			if (Predecessors[Index].Num() > 0)
+			{
+				float Sum = 0.0f;
+				for (const int32 Previous : Predecessors[Index])
+				{
+					Sum += PosY[Previous];
+				}
+				Desired = Sum / Predecessors[Index].Num();
+			}
+			PosY[Index] = FMath::Max(Cursor, Desired);
+			Cursor = PosY[Index] + EstimateNodeHeight(Nodes[Index]) + LayoutRowGap;
+			BlockHeight = FMath::Max(BlockHeight, Cursor - LayoutRowGap);
+		}
+	}
+
+	// Place the block after its right-most anchor, or below everything else in the graph.
+	TArray<FBox2D> FixedBounds;
+	int32 MinX = MAX_int32;
+	int32 MaxBottom = MIN_int32;
+	for (const UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (Node && !IndexOf.Contains(Node))
+		{
+			const int32 Bottom = Node->NodePosY + EstimateNodeHeight(Node);
+			FixedBounds.Emplace(FVector2D(Node->NodePosX, Node->NodePosY), FVector2D(Node->NodePosX + LayoutNodeWidth, Bottom));
+			MinX = FMath::Min(MinX, Node->NodePosX);
+			MaxBottom = FMath::Max(MaxBottom, Bottom);
+		}
+	}
+
+	FVector2D Origin(0.0f, 0.0f);
+	if (AnchorNode)
+	{
+		Origin = FVector2D(AnchorNode->NodePosX + LayoutColumnWidth, AnchorNode->NodePosY);
+	}
+	else if (FixedBounds.Num() > 0)
+	{
+		Origin = FVector2D(MinX, MaxBottom + LayoutRowGap * 4);
+	}
+
+	// The anchor's column often already holds the nodes it feeds; slide the block down past any it would cover.
+	const FVector2D BlockSize((LayerCount - 1) * LayoutColumnWidth + LayoutNodeWidth, BlockHeight);
+	for (int32 Pass = 0; Pass <= FixedBounds.Num(); ++Pass)
+	{
+		bool bMoved = false;
+		for (const FBox2D& Fixed : FixedBounds)
+		{
+			if (Fixed.Intersect(FBox2D(Origin, Origin + BlockSize)))
+			{
+				Origin.Y = Fixed.Max.Y + LayoutRowGap;
+				bMoved = true;
+			}
+		}
+		if (!bMoved)
+		{
+			break;
+		}
+	}
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		UEdGraphNode* Node = Nodes[Index];
+		Node->Modify();
+		Node->NodePosX = FMath::GridSnap(FMath::RoundToInt(Origin.X) + Layer[Index] * LayoutColumnWidth, LayoutGridSize);
+		Node->NodePosY = FMath::GridSnap(FMath::RoundToInt(Origin.Y + PosY[Index]), LayoutGridSize);
+	}
 	return true;
 }
 
@@ -758,8 +1768,8 @@ bool FUnrealGPTBlueprintGraph::ConnectPins(
 		return false;
 	}
 
-	UEdGraphPin* FromPin = FromNode->FindPin(FName(*FromPinName));
-	UEdGraphPin* ToPin = ToNode->FindPin(FName(*ToPinName));
+	UEdGraphPin* FromPin = FindPin(FromNode, FromPinName);
+	UEdGraphPin* ToPin = FindPin(ToNode, ToPinName);
 	if (!FromPin || !ToPin)
 	{
 		OutError = FString::Printf(TEXT("Could not find pins '%s' or '%s'"), *FromPinName, *ToPinName);
@@ -809,7 +1819,7 @@ bool FUnrealGPTBlueprintGraph::SetPinDefault(
 		return false;
 	}
 
-	UEdGraphPin* Pin = Node->FindPin(FName(*PinName));
+	UEdGraphPin* Pin = FindPin(Node, PinName);
 	if (!Pin)
 	{
 		OutError = FString::Printf(TEXT("Pin '%s' not found on node"), *PinName);
@@ -839,7 +1849,8 @@ bool FUnrealGPTBlueprintGraph::AddMemberVariable(
 	const FString& DefaultValue,
 	bool bInstanceEditable,
 	bool bExposeOnSpawn,
-	FString& OutError)
+	FString& OutError,
+	bool bMarkStructurallyModified)
 {
 	if (VarName.IsEmpty())
 	{
@@ -869,23 +1880,335 @@ bool FUnrealGPTBlueprintGraph::AddMemberVariable(
 		}
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	if (bMarkStructurallyModified)
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	}
 	return true;
 }
 
-bool FUnrealGPTBlueprintGraph::CompileBlueprint(UBlueprint* Blueprint, TArray<FString>& OutErrors, TArray<FString>& OutWarnings, FString& OutStatus)
+bool FUnrealGPTBlueprintGraph::CompileBlueprint(UBlueprint* Blueprint, FUnrealGPTCompileReport& OutReport)
 {
-	OutErrors.Reset();
-	OutWarnings.Reset();
+	using namespace UnrealGPTBlueprintGraphPrivate;
+
+	OutReport = FUnrealGPTCompileReport();
 
-	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None);
-	OutStatus = UnrealGPTBlueprintGraphPrivate::BlueprintStatusToString(Blueprint->Status);
+	FCompilerResultsLog Results;
+	Results.SetSourcePath(Blueprint->GetPathName());
+	Results.bSilentMode = true;
 
-	if (Blueprint->Status == BS_UpToDate || Blueprint->Status == BS_UpToDateWithWarnings)
+	// Garbage collection is left to the editor's own cadence; a full GC per tool call dominates small compiles.
+	const double StartSeconds = FPlatformTime::Seconds();
+	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection, &Results);
+	OutReport.CompileSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	OutReport.Status = BlueprintStatusToString(Blueprint->Status);
+	OutReport.NumErrors = Results.NumErrors;
+	OutReport.NumWarnings = Results.NumWarnings;
+	for (const TSharedRef<FTokenizedMessage>& Message : Results.Messages)
 	{
-		return true;
+		FUnrealGPTCompileReport::FDiagnostic Diagnostic;
+		if (!MakeCompileDiagnostic(*Message, Diagnostic))
+		{
+			continue;
+		}
+		OutReport.Diagnostics.Add(MoveTemp(Diagnostic));
 	}
 
-	OutErrors.Add(FString::Printf(TEXT("Blueprint compile status: %s"), *OutStatus));
-	return Blueprint->Status != BS_Error;
+	if (Blueprint->Status == BS_Error && OutReport.NumErrors == 0)
+	{
+		FUnrealGPTCompileReport::FDiagnostic Diagnostic;
+		Diagnostic.Severity = TEXT("error");
+		Diagnostic.Message = FString::Printf(TEXT("Blueprint compile status: %s"), *OutReport.Status);
+		OutReport.Diagnostics.Add(MoveTemp(Diagnostic));
+		OutReport.NumErrors = 1;
+	}
+
+	OutReport.bSuccess = Blueprint->Status != BS_Error;
+	return OutReport.bSuccess;
+}
+
+void FUnrealGPTBlueprintGraph::CompileBlueprints(const TArray<UBlueprint*>& Blueprints, TArray<FUnrealGPTCompileReport>& OutReports, double& OutTotalSeconds)
+{
+	using namespace UnrealGPTBlueprintGraphPrivate;
+
+	OutReports.Reset();
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+	}
+	FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+	OutTotalSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		FUnrealGPTCompileReport& Report = OutReports.AddDefaulted_GetRef();
+		Report.Status = BlueprintStatusToString(Blueprint->Status);
+
+		TArray<UEdGraph*> Graphs;
+		CollectGraphs(Blueprint, Graphs);
+		for (UEdGraph* Graph : Graphs)
+		{
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (!Node || !Node->bHasCompilerMessage)
+				{
+					continue;
+				}
+
+				FUnrealGPTCompileReport::FDiagnostic& Diagnostic = Report.Diagnostics.AddDefaulted_GetRef();
+				if (Node->ErrorType <= EMessageSeverity::Error)
+				{
+					Diagnostic.Severity = TEXT("error");
+					++Report.NumErrors;
+				}
+				else if (Node->ErrorType <= EMessageSeverity::Warning)
+				{
+					Diagnostic.Severity = TEXT("warning");
+					++Report.NumWarnings;
+				}
+				else
+				{
+					Diagnostic.Severity = TEXT("note");
+				}
+				Diagnostic.Message = Node->ErrorMsg.TrimStartAndEnd();
+				Diagnostic.NodeGuid = Node->NodeGuid.ToString(EGuidFormats::DigitsWithHyphensInBraces);
+				Diagnostic.NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+				Diagnostic.GraphName = Graph->GetName();
+			}
+		}
+
+		if (Blueprint->Status == BS_Error && Report.NumErrors == 0)
+		{
+			FUnrealGPTCompileReport::FDiagnostic& Diagnostic = Report.Diagnostics.AddDefaulted_GetRef();
+			Diagnostic.Severity = TEXT("error");
+			Diagnostic.Message = FString::Printf(TEXT("Blueprint compile status: %s"), *Report.Status);
+			Report.NumErrors = 1;
+		}
+		Report.bSuccess = Blueprint->Status != BS_Error;
+	}
+}
+
+bool FUnrealGPTBlueprintGraph::CollectDependentBlueprints(const FString& RootAssetPath, int32 MaxBlueprints, TArray<UBlueprint*>& OutBlueprints, bool& bOutTruncated, FString& OutError)
+{
+	OutBlueprints.Reset();
+	bOutTruncated = false;
+
+	const FName RootPackage(*(RootAssetPath.Contains(TEXT(".")) ? FPackageName::ObjectPathToPackageName(RootAssetPath) : RootAssetPath));
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	if (!FPackageName::DoesPackageExist(RootPackage.ToString()) && !FindPackage(nullptr, *RootPackage.ToString()))
+	{
+		OutError = FString::Printf(TEXT("dependency_root '%s' does not exist"), *RootAssetPath);
+		return false;
+	}
+
+	// Breadth-first over referencers. Only Blueprint packages are expanded further: maps and data assets
+	// that reference a Blueprint do not need recompiling and would pull in most of the project.
+	// The walk reads Asset Registry data only; nothing is loaded until the set is known.
+	TSet<FName> Visited;
+	Visited.Add(RootPackage);
+	TArray<FName> Frontier;
+	Frontier.Add(RootPackage);
+	TArray<FAssetData> Found;
+	for (int32 FrontierIndex = 0; FrontierIndex < Frontier.Num() && !bOutTruncated; ++FrontierIndex)
+	{
+		TArray<FName> Referencers;
+		AssetRegistry.GetReferencers(Frontier[FrontierIndex], Referencers);
+		Referencers.Sort(FNameLexicalLess());
+
+		for (const FName& Referencer : Referencers)
+		{
+			if (Visited.Contains(Referencer))
+			{
+				continue;
+			}
+			Visited.Add(Referencer);
+
+			TArray<FAssetData> Assets;
+			AssetRegistry.GetAssetsByPackageName(Referencer, Assets);
+			for (const FAssetData& Asset : Assets)
+			{
+				const UClass* AssetClass = Asset.GetClass();
+				if (!AssetClass || !AssetClass->IsChildOf(UBlueprint::StaticClass()))
+				{
+					continue;
+				}
+				if (Found.Num() >= MaxBlueprints)
+				{
+					bOutTruncated = true;
+					break;
+				}
+				Found.Add(Asset);
+				Frontier.Add(Referencer);
+			}
+		}
+	}
+
+	// Compiling needs the Blueprints in memory, so the caller still waits on the game thread. Requesting
+	// every package before waiting lets the async loader overlap their I/O instead of loading one by one.
+	bool bRequestedLoads = false;
+	for (const FAssetData& Asset : Found)
+	{
+		if (!Asset.IsAssetLoaded())
+		{
+			LoadPackageAsync(Asset.PackageName.ToString());
+			bRequestedLoads = true;
+		}
+	}
+	if (bRequestedLoads)
+	{
+		FlushAsyncLoading();
+	}
+
+	for (const FAssetData& Asset : Found)
+	{
+		if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+		{
+			OutBlueprints.AddUnique(Blueprint);
+		}
+	}
+
+	SortDependenciesFirst(OutBlueprints);
+	return true;
+}
+
+void FUnrealGPTBlueprintGraph::SortDependenciesFirst(TArray<UBlueprint*>& Blueprints)
+{
+	const int32 NumBlueprints = Blueprints.Num();
+	TMap<const UBlueprint*, int32> IndexOf;
+	for (int32 Index = 0; Index < NumBlueprints; ++Index)
+	{
+		IndexOf.Add(Blueprints[Index], Index);
+	}
+
+	// An edge runs from each Blueprint in the set to every Blueprint it needs compiled first: its
+	// Blueprint ancestors, the Blueprint interfaces it implements and the Blueprint components it adds.
+	TArray<TArray<int32>> Dependents;
+	Dependents.SetNum(NumBlueprints);
+	TArray<int32> NumPending;
+	NumPending.SetNumZeroed(NumBlueprints);
+	for (int32 Index = 0; Index < NumBlueprints; ++Index)
+	{
+		const UBlueprint* Blueprint = Blueprints[Index];
+		if (!Blueprint)
+		{
+			continue;
+		}
+
+		TSet<int32> Dependencies;
+		auto AddDependency = [&IndexOf, &Dependencies, Index](const UClass* Class)
+		{
+			const int32* DependencyIndex = Class ? IndexOf.Find(UBlueprint::GetBlueprintFromClass(Class)) : nullptr;
+			if (DependencyIndex && *DependencyIndex != Index)
+			{
+				Dependencies.Add(*DependencyIndex);
+			}
+		};
+		for (const UClass* Class = Blueprint->ParentClass; Class; Class = Class->GetSuperClass())
+		{
+			AddDependency(Class);
+		}
+		for (const FBPInterfaceDescription& Interface : Blueprint->ImplementedInterfaces)
+		{
+			AddDependency(Interface.Interface);
+		}
+		if (Blueprint->SimpleConstructionScript)
+		{
+			for (const USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
+			{
+				AddDependency(Node ? Node->ComponentClass.Get() : nullptr);
+			}
+		}
+
+		for (const int32 DependencyIndex : Dependencies)
+		{
+			Dependents[DependencyIndex].Add(Index);
+			++NumPending[Index];
+		}
+	}
+
+	// Kahn's algorithm; the min-heap of ready indices keeps unrelated Blueprints in their input order.
+	TArray<int32> Ready;
+	for (int32 Index = 0; Index < NumBlueprints; ++Index)
+	{
+		if (NumPending[Index] == 0)
+		{
+			Ready.HeapPush(Index);
+		}
+	}
+
+	TArray<UBlueprint*> Sorted;
+	Sorted.Reserve(NumBlueprints);
+	TBitArray<> bEmitted(false, NumBlueprints);
+	while (Ready.Num() > 0)
+	{
+		int32 Index = INDEX_NONE;
+		Ready.HeapPop(Index);
+		Sorted.Add(Blueprints[Index]);
+		bEmitted[Index] = true;
+		for (const int32 Dependent : Dependents[Index])
+		{
+			if (--NumPending[Dependent] == 0)
+			{
+				Ready.HeapPush(Dependent);
+			}
+		}
+	}
+
+	// Cycles (a component whose class references its owner's class, say) have no valid order; the
+	// compilation manager resolves those itself, so they follow everything else in input order.
+	for (int32 Index = 0; Index < NumBlueprints; ++Index)
+	{
+		if (!bEmitted[Index])
+		{
+			Sorted.Add(Blueprints[Index]);
+		}
+	}
+	Blueprints = MoveTemp(Sorted);
+}
+
+void FUnrealGPTBlueprintGraph::AppendCompileReport(const FUnrealGPTCompileReport& Report, const TSharedPtr<FJsonObject>& Details)
+{
+	Details->SetStringField(TEXT("compile_status"), Report.Status);
+	Details->SetNumberField(TEXT("compile_ms"), FMath::RoundToInt(Report.CompileSeconds * 1000.0));
+	Details->SetNumberField(TEXT("error_count"), Report.NumErrors);
+	Details->SetNumberField(TEXT("warning_count"), Report.NumWarnings);
+
+	// Errors first so truncation only ever drops warnings and notes.
+	TArray<const FUnrealGPTCompileReport::FDiagnostic*> Ordered;
+	for (const FUnrealGPTCompileReport::FDiagnostic& Diagnostic : Report.Diagnostics)
+	{
+		Ordered.Add(&Diagnostic);
+	}
+	Algo::StableSortBy(Ordered, [](const FUnrealGPTCompileReport::FDiagnostic* Diagnostic)
+	{
+		return Diagnostic->Severity == TEXT("error") ? 0 : Diagnostic->Severity == TEXT("warning") ? 1 : 2;
+	});
+
+	TArray<TSharedPtr<FJsonValue>> DiagnosticValues;
+	for (const FUnrealGPTCompileReport::FDiagnostic* Diagnostic : Ordered)
+	{
+		if (DiagnosticValues.Num() >= MaxCompileDiagnostics)
+		{
+			Details->SetNumberField(TEXT("diagnostics_omitted"), Ordered.Num() - DiagnosticValues.Num());
+			break;
+		}
+
+		TSharedPtr<FJsonObject> DiagnosticJson = MakeShared<FJsonObject>();
+		DiagnosticJson->SetStringField(TEXT("severity"), Diagnostic->Severity);
+		DiagnosticJson->SetStringField(TEXT("message"), Diagnostic->Message);
+		if (!Diagnostic->NodeGuid.IsEmpty())
+		{
+			DiagnosticJson->SetStringField(TEXT("node_guid"), Diagnostic->NodeGuid);
+			DiagnosticJson->SetStringField(TEXT("node_title"), Diagnostic->NodeTitle);
+			DiagnosticJson->SetStringField(TEXT("graph_name"), Diagnostic->GraphName);
+		}
+		if (!Diagnostic->PinName.IsEmpty())
+		{
+			DiagnosticJson->SetStringField(TEXT("pin_name"), Diagnostic->PinName);
+		}
+		DiagnosticValues.Add(MakeShared<FJsonValueObject>(DiagnosticJson));
+	}
+	Details->SetArrayField(TEXT("diagnostics"), DiagnosticValues);
 }
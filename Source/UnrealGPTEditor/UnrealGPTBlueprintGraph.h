@@ -9,6 +9,28 @@ class UBlueprint;
 class UEdGraph;
 class UEdGraphNode;
 
+/** Outcome of one Blueprint compile, with compiler messages resolved to the graph nodes they refer to. */
+struct FUnrealGPTCompileReport
+{
+	struct FDiagnostic
+	{
+		/** error, warning or note. */
+		FString Severity;
+		FString Message;
+		FString NodeGuid;
+		FString NodeTitle;
+		FString GraphName;
+		FString PinName;
+	};
+
+	FString Status;
+	bool bSuccess = false;
+	int32 NumErrors = 0;
+	int32 NumWarnings = 0;
+	double CompileSeconds = 0.0;
+	TArray<FDiagnostic> Diagnostics;
+};
+
 /**
  * Internal helpers for blueprint asset loading, graph serialization, and K2 node manipulation.
  */
@@ -23,14 +45,25 @@ public:
 	static UClass* ResolveParentClass(const FString& ParentClassName, FString& OutError);
 
 	static UEdGraph* ResolveGraph(UBlueprint* Blueprint, const FString& GraphName, FString& OutError);
+	/** Indexed lookup; the per-graph index is rebuilt after the graph reports a change. */
 	static UEdGraphNode* FindNodeByGuid(UEdGraph* Graph, const FString& NodeGuidStr, FString& OutError);
+	static UEdGraphPin* FindPin(UEdGraphNode* Node, const FString& PinName);
+	/** Drop the lookup index and unbind it from every graph; called at module shutdown. */
+	static void ResetLookupCache();
 
+	/**
+	 * Every summary carries a revision token. Passing an earlier token as SinceRevision returns only the
+	 * nodes added, changed or removed since then; unknown tokens fall back to the full summary.
+	 * bCompact swaps per-node pin objects for a node table, interned pin types and a flat edge list.
+	 */
 	static TSharedPtr<FJsonObject> SerializeBlueprintSummary(
 		UBlueprint* Blueprint,
 		const FString& AssetPath,
 		const FString& GraphNameFilter,
 		const FString& NodeGuidFilter,
-		bool bIncludePins);
+		bool bIncludePins,
+		const FString& SinceRevision = FString(),
+		bool bCompact = false);
 
 	static bool ParsePinType(const FString& TypeName, const FString& SubTypeObjectPath, FEdGraphPinType& OutPinType, FString& OutError);
 	static FString PinTypeToString(const FEdGraphPinType& PinType);
@@ -42,7 +75,15 @@ public:
 		const FVector2D& Position,
 		const TSharedPtr<FJsonObject>& Params,
 		FString& OutNodeGuid,
-		FString& OutError);
+		FString& OutError,
+		bool bMarkStructurallyModified = true);
+
+	/**
+	 * Layered layout of NodesToPlace: columns follow exec and data flow, rows are ordered by barycenter
+	 * sweeps. Other nodes in the graph stay put; the block starts right of the fixed node feeding it,
+	 * or below the existing graph. Linear in nodes and links.
+	 */
+	static bool LayoutNodes(UEdGraph* Graph, const TArray<UEdGraphNode*>& NodesToPlace);
 
 	static bool ConnectPins(
 		UEdGraph* Graph,
@@ -68,9 +109,34 @@ public:
 		const FString& DefaultValue,
 		bool bInstanceEditable,
 		bool bExposeOnSpawn,
-		FString& OutError);
+		FString& OutError,
+		bool bMarkStructurallyModified = true);
+
+	static bool CompileBlueprint(UBlueprint* Blueprint, FUnrealGPTCompileReport& OutReport);
+
+	/**
+	 * Compile several Blueprints through one compilation-manager flush, so reinstancing and garbage
+	 * collection run once for the whole set. Order the set with SortDependenciesFirst. Per-Blueprint
+	 * diagnostics come from the compiler messages left on graph nodes; CompileSeconds is only set on OutTotal.
+	 */
+	static void CompileBlueprints(const TArray<UBlueprint*>& Blueprints, TArray<FUnrealGPTCompileReport>& OutReports, double& OutTotalSeconds);
+
+	/**
+	 * Blueprints whose packages reference RootAssetPath, directly or through other Blueprints, dependencies
+	 * first. The set is found from Asset Registry data, then loaded in one async batch that this call waits on.
+	 */
+	static bool CollectDependentBlueprints(const FString& RootAssetPath, int32 MaxBlueprints, TArray<UBlueprint*>& OutBlueprints, bool& bOutTruncated, FString& OutError);
+
+	/**
+	 * Topologically sorts so every Blueprint follows the Blueprints in the set it depends on: parents,
+	 * implemented interfaces and component classes. Unrelated Blueprints and cycles keep their input order.
+	 */
+	static void SortDependenciesFirst(TArray<UBlueprint*>& Blueprints);
+
+	/** Writes compile_status, compile_ms, counts and the diagnostics array into Details. */
+	static void AppendCompileReport(const FUnrealGPTCompileReport& Report, const TSharedPtr<FJsonObject>& Details);
 
-	static bool CompileBlueprint(UBlueprint* Blueprint, TArray<FString>& OutErrors, TArray<FString>& OutWarnings, FString& OutStatus);
+	static constexpr int32 MaxCompileDiagnostics = 50;
 
 	static const TArray<FString>& GetSupportedNodeTypes();
 };
@@ -0,0 +1,434 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTCodexAuth.h"
+#include "UnrealGPTSettings.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace UnrealGPTCodexAuthPrivate
+{
+	static const TCHAR* TokenUrl = TEXT("https://auth.openai.com/oauth/token");
+	static const TCHAR* ClientId = TEXT("app_EMoamEEZ73f0CkXaXp7hrann");
+
+	static IDirectoryWatcher* GetDirectoryWatcher(bool bLoadIfNeeded)
+	{
+		FDirectoryWatcherModule* Module = bLoadIfNeeded
+			? &FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"))
+			: FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+		return Module ? Module->Get() : nullptr;
+	}
+}
+
+FUnrealGPTCodexAuth& FUnrealGPTCodexAuth::Get()
+{
+	static FUnrealGPTCodexAuth Instance;
+	return Instance;
+}
+
+void FUnrealGPTCodexAuth::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	RefreshTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FUnrealGPTCodexAuth::HandleRefreshTick),
+		RefreshCheckIntervalSeconds);
+	bInitialized = true;
+}
+
+void FUnrealGPTCodexAuth::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(RefreshTickerHandle);
+	RefreshTickerHandle.Reset();
+
+	// Callers waiting on the refresh may already be gone; drop them without calling back.
+	if (RefreshRequest.IsValid())
+	{
+		RefreshRequest->OnProcessRequestComplete().Unbind();
+		RefreshRequest->CancelRequest();
+		RefreshRequest.Reset();
+	}
+	RefreshCallbacks.Empty();
+
+	UnwatchDirectory();
+	Invalidate();
+	bInitialized = false;
+}
+
+FUnrealGPTCodexAuth::FCredentialsPtr FUnrealGPTCodexAuth::GetCredentials(const FString& AuthPath)
+{
+	uint32 Generation = 0;
+	{
+		FScopeLock Lock(&CacheLock);
+		if (Cached.IsValid() && Cached->Path == AuthPath && !WatchedDirectory.IsEmpty()
+			&& WatchedDirectory == FPaths::GetPath(AuthPath))
+		{
+			return Cached.ToSharedRef();
+		}
+		Generation = CacheGeneration;
+	}
+
+	// Watch before reading so a write landing in between still invalidates the result.
+	if (IsInGameThread() && !AuthPath.IsEmpty())
+	{
+		WatchDirectoryOf(AuthPath);
+	}
+
+	const FCredentialsPtr Loaded = LoadCredentials(AuthPath);
+
+	FScopeLock Lock(&CacheLock);
+	if (Generation == CacheGeneration)
+	{
+		Cached = Loaded;
+	}
+	return Loaded;
+}
+
+void FUnrealGPTCodexAuth::Invalidate()
+{
+	FScopeLock Lock(&CacheLock);
+	Cached.Reset();
+	++CacheGeneration;
+}
+
+bool FUnrealGPTCodexAuth::ExpiresWithin(const FCredentials& Credentials, const FTimespan& Margin)
+{
+	return Credentials.HasChatGPTTokens()
+		&& Credentials.AccessTokenExpiry > FDateTime::MinValue()
+		&& Credentials.AccessTokenExpiry - FDateTime::UtcNow() <= Margin;
+}
+
+void FUnrealGPTCodexAuth::RefreshTokens(FOnRefreshComplete OnComplete)
+{
+	check(IsInGameThread());
+
+	if (OnComplete)
+	{
+		RefreshCallbacks.Add(MoveTemp(OnComplete));
+	}
+	if (RefreshRequest.IsValid())
+	{
+		return;
+	}
+
+	const UUnrealGPTSettings* Settings = GetDefault<UUnrealGPTSettings>();
+	if (!Settings)
+	{
+		CompleteRefresh(false, TEXT("Settings is null and could not be retrieved."));
+		return;
+	}
+
+	const FCredentialsPtr Credentials = GetCredentials(Settings->GetResolvedCodexAuthFilePath());
+	if (!Credentials->IsValid())
+	{
+		CompleteRefresh(false, Credentials->Error);
+		return;
+	}
+	if (Credentials->RefreshToken.IsEmpty())
+	{
+		CompleteRefresh(false, TEXT("Codex auth cache does not contain a refresh token. Use Codex Login again."));
+		return;
+	}
+
+	const FString RequestForm = FString::Printf(
+		TEXT("grant_type=refresh_token&refresh_token=%s&client_id=%s"),
+		*FGenericPlatformHttp::UrlEncode(Credentials->RefreshToken),
+		*FGenericPlatformHttp::UrlEncode(UnrealGPTCodexAuthPrivate::ClientId));
+
+	TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
+	if (Settings->ExecutionTimeoutSeconds > 0.0f)
+	{
+		Request->SetTimeout(Settings->ExecutionTimeoutSeconds);
+	}
+	Request->SetURL(UnrealGPTCodexAuthPrivate::TokenUrl);
+	Request->SetVerb(TEXT("POST"));
+	Request->SetHeader(TEXT("Content-Type"), TEXT("application/x-www-form-urlencoded"));
+	Request->SetContentAsString(RequestForm);
+	Request->OnProcessRequestComplete().BindRaw(this, &FUnrealGPTCodexAuth::HandleRefreshResponse);
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Refreshing Codex auth"));
+	RefreshRequest = Request;
+	Request->ProcessRequest();
+}
+
+TSharedPtr<FJsonObject> FUnrealGPTCodexAuth::DecodeJwtPayload(const FString& Jwt)
+{
+	TArray<FString> Parts;
+	Jwt.ParseIntoArray(Parts, TEXT("."), false);
+	if (Parts.Num() < 2)
+	{
+		return nullptr;
+	}
+
+	FString Payload = Parts[1].Replace(TEXT("-"), TEXT("+")).Replace(TEXT("_"), TEXT("/"));
+	while (Payload.Len() % 4 != 0)
+	{
+		Payload += TEXT("=");
+	}
+
+	FString PayloadJsonText;
+	if (!FBase64::Decode(Payload, PayloadJsonText))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> PayloadJson;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(PayloadJsonText);
+	if (!FJsonSerializer::Deserialize(Reader, PayloadJson) || !PayloadJson.IsValid())
+	{
+		return nullptr;
+	}
+
+	return PayloadJson;
+}
+
+FDateTime FUnrealGPTCodexAuth::GetJwtExpiry(const FString& Jwt)
+{
+	const TSharedPtr<FJsonObject> Payload = DecodeJwtPayload(Jwt);
+	double Expiry = 0.0;
+	if (!Payload.IsValid() || !Payload->TryGetNumberField(TEXT("exp"), Expiry) || Expiry <= 0.0)
+	{
+		return FDateTime::MinValue();
+	}
+
+	return FDateTime::FromUnixTimestamp(static_cast<int64>(Expiry));
+}
+
+FUnrealGPTCodexAuth::FCredentialsPtr FUnrealGPTCodexAuth::LoadCredentials(const FString& AuthPath)
+{
+	const TSharedRef<FCredentials, ESPMode::ThreadSafe> Credentials = MakeShared<FCredentials, ESPMode::ThreadSafe>();
+	Credentials->Path = AuthPath;
+
+	if (AuthPath.IsEmpty())
+	{
+		Credentials->Error = TEXT("Could not resolve Codex auth file path.");
+		return Credentials;
+	}
+
+	FString AuthJsonText;
+	if (!FFileHelper::LoadFileToString(AuthJsonText, *AuthPath))
+	{
+		Credentials->Error = FString::Printf(
+			TEXT("Codex auth file not found or unreadable: %s. Use the UnrealGPT Codex Login button to sign in."),
+			*AuthPath);
+		return Credentials;
+	}
+
+	TSharedPtr<FJsonObject> AuthJson;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(AuthJsonText);
+	if (!FJsonSerializer::Deserialize(Reader, AuthJson) || !AuthJson.IsValid())
+	{
+		Credentials->Error = FString::Printf(TEXT("Codex auth file is not valid JSON: %s"), *AuthPath);
+		return Credentials;
+	}
+
+	AuthJson->TryGetStringField(TEXT("auth_mode"), Credentials->AuthMode);
+	AuthJson->TryGetStringField(TEXT("OPENAI_API_KEY"), Credentials->ApiKey);
+
+	const TSharedPtr<FJsonObject>* TokensObject = nullptr;
+	if (AuthJson->TryGetObjectField(TEXT("tokens"), TokensObject) && TokensObject && TokensObject->IsValid())
+	{
+		(*TokensObject)->TryGetStringField(TEXT("access_token"), Credentials->AccessToken);
+		(*TokensObject)->TryGetStringField(TEXT("account_id"), Credentials->AccountId);
+		(*TokensObject)->TryGetStringField(TEXT("refresh_token"), Credentials->RefreshToken);
+		Credentials->AccessTokenExpiry = GetJwtExpiry(Credentials->AccessToken);
+	}
+
+	return Credentials;
+}
+
+void FUnrealGPTCodexAuth::WatchDirectoryOf(const FString& AuthPath)
+{
+	const FString Directory = FPaths::GetPath(AuthPath);
+	{
+		FScopeLock Lock(&CacheLock);
+		if (!WatchedDirectory.IsEmpty() && WatchedDirectory == Directory)
+		{
+			return;
+		}
+	}
+
+	UnwatchDirectory();
+
+	IDirectoryWatcher* DirectoryWatcher = UnrealGPTCodexAuthPrivate::GetDirectoryWatcher(true);
+	if (!DirectoryWatcher || Directory.IsEmpty() || !FPaths::DirectoryExists(Directory))
+	{
+		return;
+	}
+
+	// The Codex home also holds session logs in subdirectories; only auth.json itself matters here.
+	FDelegateHandle Handle;
+	if (!DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+		Directory,
+		IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FUnrealGPTCodexAuth::HandleDirectoryChanged),
+		Handle,
+		IDirectoryWatcher::WatchOptions::IgnoreChangesInSubtree))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: Could not watch %s; Codex auth will be re-read for every request"), *Directory);
+		return;
+	}
+
+	FScopeLock Lock(&CacheLock);
+	WatchedDirectory = Directory;
+	WatcherHandle = Handle;
+}
+
+void FUnrealGPTCodexAuth::UnwatchDirectory()
+{
+	FString Directory;
+	FDelegateHandle Handle;
+	{
+		FScopeLock Lock(&CacheLock);
+		Directory = MoveTemp(WatchedDirectory);
+		WatchedDirectory.Reset();
+		Handle = WatcherHandle;
+		WatcherHandle.Reset();
+	}
+
+	if (Handle.IsValid())
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = UnrealGPTCodexAuthPrivate::GetDirectoryWatcher(false))
+		{
+			DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Directory, Handle);
+		}
+	}
+}
+
+void FUnrealGPTCodexAuth::HandleDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+	FString CachedFileName;
+	{
+		FScopeLock Lock(&CacheLock);
+		if (Cached.IsValid())
+		{
+			CachedFileName = FPaths::GetCleanFilename(Cached->Path);
+		}
+	}
+
+	for (const FFileChangeData& Change : Changes)
+	{
+		// Editors and the Codex CLI may replace the file through a temporary, so any entry with the
+		// auth file's name counts.
+		if (CachedFileName.IsEmpty() || FPaths::GetCleanFilename(Change.Filename).Equals(CachedFileName, ESearchCase::IgnoreCase))
+		{
+			Invalidate();
+			return;
+		}
+	}
+}
+
+bool FUnrealGPTCodexAuth::HandleRefreshTick(float DeltaTime)
+{
+	const UUnrealGPTSettings* Settings = GetDefault<UUnrealGPTSettings>();
+	if (!Settings || !Settings->bUseCodexAuth || IsRefreshInProgress())
+	{
+		return true;
+	}
+
+	const FCredentialsPtr Credentials = GetCredentials(Settings->GetResolvedCodexAuthFilePath());
+	if (!Credentials->ApiKey.IsEmpty() || Credentials->RefreshToken.IsEmpty()
+		|| Credentials->RefreshToken == LastFailedRefreshToken
+		|| !ExpiresWithin(*Credentials, FTimespan::FromSeconds(ProactiveRefreshSeconds)))
+	{
+		return true;
+	}
+
+	const FString RefreshToken = Credentials->RefreshToken;
+	RefreshTokens([this, RefreshToken](bool bSuccess, const FString& Error)
+	{
+		if (!bSuccess)
+		{
+			// Not retried until the auth file changes; a request will report the failure to the user.
+			UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: Proactive Codex auth refresh failed: %s"), *Error);
+			LastFailedRefreshToken = RefreshToken;
+		}
+	});
+	return true;
+}
+
+void FUnrealGPTCodexAuth::HandleRefreshResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+{
+	if (Request != RefreshRequest)
+	{
+		return;
+	}
+
+	if (!bWasSuccessful || !Response.IsValid())
+	{
+		CompleteRefresh(false, TEXT("Codex auth refresh failed. Please use Codex Login again."));
+		return;
+	}
+
+	const int32 ResponseCode = Response->GetResponseCode();
+	const FString ResponseBody = Response->GetContentAsString();
+	if (ResponseCode < 200 || ResponseCode >= 300)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UnrealGPT: Codex auth refresh failed %d: %s"), ResponseCode, *ResponseBody);
+		CompleteRefresh(false, FString::Printf(TEXT("Codex auth refresh failed. Please use Codex Login again. HTTP %d"), ResponseCode));
+		return;
+	}
+
+	TSharedPtr<FJsonObject> ResponseJson;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseBody);
+	if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
+	{
+		CompleteRefresh(false, TEXT("Codex auth refresh returned invalid JSON. Please use Codex Login again."));
+		return;
+	}
+
+	const UUnrealGPTSettings* Settings = GetDefault<UUnrealGPTSettings>();
+	if (!Settings)
+	{
+		CompleteRefresh(false, TEXT("Settings is null and could not be retrieved."));
+		return;
+	}
+
+	FString IdToken;
+	FString AccessToken;
+	FString RefreshToken;
+	ResponseJson->TryGetStringField(TEXT("id_token"), IdToken);
+	ResponseJson->TryGetStringField(TEXT("access_token"), AccessToken);
+	ResponseJson->TryGetStringField(TEXT("refresh_token"), RefreshToken);
+	if (RefreshToken.IsEmpty())
+	{
+		RefreshToken = GetCredentials(Settings->GetResolvedCodexAuthFilePath())->RefreshToken;
+	}
+
+	FString SaveError;
+	if (IdToken.IsEmpty() || AccessToken.IsEmpty() || RefreshToken.IsEmpty() || !Settings->SaveCodexChatGPTAuth(IdToken, AccessToken, RefreshToken, SaveError))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UnrealGPT: Codex auth refresh could not be saved: %s"), *SaveError);
+		CompleteRefresh(false, TEXT("Codex auth refresh could not be saved. Please use Codex Login again."));
+		return;
+	}
+
+	CompleteRefresh(true, FString());
+}
+
+void FUnrealGPTCodexAuth::CompleteRefresh(bool bSuccess, const FString& Error)
+{
+	RefreshRequest.Reset();
+
+	TArray<FOnRefreshComplete> Callbacks = MoveTemp(RefreshCallbacks);
+	RefreshCallbacks.Reset();
+	for (const FOnRefreshComplete& Callback : Callbacks)
+	{
+		Callback(bSuccess, Error);
+	}
+}
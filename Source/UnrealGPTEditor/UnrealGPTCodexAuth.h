@@ -0,0 +1,104 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Misc/Timespan.h"
+
+class FJsonObject;
+struct FFileChangeData;
+
+/**
+ * In-memory copy of the Codex auth.json used by UUnrealGPTSettings::ResolveAuthHeaders and friends.
+ * The file is parsed once and re-read only after a directory watcher on the Codex home reports a change
+ * to it (or after UnrealGPT writes it), so requests do not touch the disk. While the directory cannot be
+ * watched the file is re-read on every lookup, as before.
+ *
+ * Also owns the ChatGPT token refresh: a ticker renews the access token shortly before its JWT expiry,
+ * and callers that find an expired token share one in-flight refresh request.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTCodexAuth
+{
+public:
+	/** The ticker refreshes the access token once it expires within this window. */
+	static constexpr double ProactiveRefreshSeconds = 300.0;
+	static constexpr float RefreshCheckIntervalSeconds = 60.0f;
+
+	struct FCredentials
+	{
+		FString Path;
+		/** Empty when the file was read and parsed. */
+		FString Error;
+		FString AuthMode;
+		FString ApiKey;
+		FString AccessToken;
+		FString AccountId;
+		FString RefreshToken;
+		/** "exp" claim of the access token; FDateTime::MinValue() when the token is not a JWT or has none. */
+		FDateTime AccessTokenExpiry = FDateTime::MinValue();
+
+		bool IsValid() const { return Error.IsEmpty(); }
+		bool HasChatGPTTokens() const { return IsValid() && !AccessToken.IsEmpty(); }
+	};
+
+	using FCredentialsPtr = TSharedRef<const FCredentials, ESPMode::ThreadSafe>;
+	using FOnRefreshComplete = TFunction<void(bool bSuccess, const FString& Error)>;
+
+	static FUnrealGPTCodexAuth& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** Parsed contents of the auth file at AuthPath. Served from memory while the file is unchanged. */
+	FCredentialsPtr GetCredentials(const FString& AuthPath);
+
+	/** Drop the cached credentials; the next lookup re-reads the file. */
+	void Invalidate();
+
+	/** True when ChatGPT tokens are in use and the access token expires within Margin. */
+	static bool ExpiresWithin(const FCredentials& Credentials, const FTimespan& Margin);
+
+	/**
+	 * Exchange the refresh token in the configured auth file for new tokens and save them.
+	 * Calls made while a refresh is running wait for that one. Game thread only.
+	 */
+	void RefreshTokens(FOnRefreshComplete OnComplete);
+
+	bool IsRefreshInProgress() const { return RefreshRequest.IsValid(); }
+
+	/** Decoded payload of a JWT, or null if Jwt is not one. */
+	static TSharedPtr<FJsonObject> DecodeJwtPayload(const FString& Jwt);
+
+	/** "exp" claim of a JWT, or FDateTime::MinValue(). */
+	static FDateTime GetJwtExpiry(const FString& Jwt);
+
+private:
+	FUnrealGPTCodexAuth() = default;
+
+	static FCredentialsPtr LoadCredentials(const FString& AuthPath);
+
+	void WatchDirectoryOf(const FString& AuthPath);
+	void UnwatchDirectory();
+	void HandleDirectoryChanged(const TArray<FFileChangeData>& Changes);
+	bool HandleRefreshTick(float DeltaTime);
+	void HandleRefreshResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+	void CompleteRefresh(bool bSuccess, const FString& Error);
+
+	mutable FCriticalSection CacheLock;
+	TSharedPtr<const FCredentials, ESPMode::ThreadSafe> Cached;
+	/** Bumped by Invalidate so a load that raced with a file change is not cached. */
+	uint32 CacheGeneration = 0;
+
+	/** Directory holding the auth file; credentials are only cached while it is watched. */
+	FString WatchedDirectory;
+	FDelegateHandle WatcherHandle;
+
+	FHttpRequestPtr RefreshRequest;
+	TArray<FOnRefreshComplete> RefreshCallbacks;
+	/** Refresh token the ticker last failed with; it is not retried until the file provides another. */
+	FString LastFailedRefreshToken;
+	FTSTicker::FDelegateHandle RefreshTickerHandle;
+	bool bInitialized = false;
+};
@@ -0,0 +1,627 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTDownloadManager.h"
+#include "UnrealGPTSettings.h"
+#include "Mcp/McpResultNormalizer.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+namespace UnrealGPTDownloadManagerPrivate
+{
+	static constexpr int64 CopyChunkSize = 1024 * 1024;
+	static constexpr float TickIntervalSeconds = 0.25f;
+
+	static bool IsRetryable(FHttpResponsePtr Response, bool bConnectedSuccessfully)
+	{
+		if (!bConnectedSuccessfully || !Response.IsValid())
+		{
+			return true;
+		}
+		// 416: the partial file no longer matches what the server has; it is dropped and fetched again
+		const int32 ResponseCode = Response->GetResponseCode();
+		return ResponseCode == 408 || ResponseCode == 416 || ResponseCode == 429 || ResponseCode >= 500;
+	}
+
+	/** Append Source to Dest in bounded chunks. */
+	static bool AppendFile(const FString& DestPath, const FString& SourcePath)
+	{
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*SourcePath));
+		TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*DestPath, FILEWRITE_Append));
+		if (!Reader || !Writer)
+		{
+			return false;
+		}
+
+		TArray<uint8> Buffer;
+		Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(CopyChunkSize, FMath::Max<int64>(Reader->TotalSize(), 1))));
+		int64 Remaining = Reader->TotalSize();
+		while (Remaining > 0)
+		{
+			const int64 ChunkSize = FMath::Min<int64>(Remaining, Buffer.Num());
+			Reader->Serialize(Buffer.GetData(), ChunkSize);
+			Writer->Serialize(Buffer.GetData(), ChunkSize);
+			Remaining -= ChunkSize;
+		}
+
+		return !Reader->IsError() && Writer->Close();
+	}
+
+	static bool HashFile(const FString& Path, FString& OutHash)
+	{
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+		if (!Reader)
+		{
+			return false;
+		}
+
+		FSHA1 Sha;
+		TArray<uint8> Buffer;
+		Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(CopyChunkSize, FMath::Max<int64>(Reader->TotalSize(), 1))));
+		int64 Remaining = Reader->TotalSize();
+		while (Remaining > 0)
+		{
+			const int64 ChunkSize = FMath::Min<int64>(Remaining, Buffer.Num());
+			Reader->Serialize(Buffer.GetData(), ChunkSize);
+			Sha.Update(Buffer.GetData(), static_cast<uint64>(ChunkSize));
+			Remaining -= ChunkSize;
+		}
+		Sha.Final();
+
+		uint8 Digest[FSHA1::DigestSize];
+		Sha.GetHash(Digest);
+		OutHash = BytesToHex(Digest, FSHA1::DigestSize).ToLower();
+		return !Reader->IsError();
+	}
+}
+
+FUnrealGPTDownloadManager& FUnrealGPTDownloadManager::Get()
+{
+	static FUnrealGPTDownloadManager Instance;
+	return Instance;
+}
+
+void FUnrealGPTDownloadManager::Initialize()
+{
+	if (TickerHandle.IsValid())
+	{
+		return;
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FUnrealGPTDownloadManager::HandleTick),
+		UnrealGPTDownloadManagerPrivate::TickIntervalSeconds);
+}
+
+void FUnrealGPTDownloadManager::Shutdown()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	TArray<FJobRef> Jobs;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Jobs = MoveTemp(Queued);
+		Jobs.Append(MoveTemp(Active));
+		Queued.Reset();
+		Active.Reset();
+	}
+
+	for (const FJobRef& Job : Jobs)
+	{
+		if (Job->HttpRequest.IsValid())
+		{
+			Job->HttpRequest->OnProcessRequestComplete().Unbind();
+			Job->HttpRequest->CancelRequest();
+			Job->HttpRequest.Reset();
+		}
+		if (Job->Writer.IsValid())
+		{
+			Job->Writer->Close();
+			Job->Writer.Reset();
+		}
+		if (!Job->AttemptPath.IsEmpty())
+		{
+			IFileManager::Get().Delete(*Job->AttemptPath);
+			IFileManager::Get().Delete(*Job->PartialPath);
+		}
+
+		FUnrealGPTDownloadResult Result;
+		Result.Url = Job->Request.Url;
+		Result.Error = TEXT("Download canceled: editor shutting down");
+		CompleteJob(Job, MoveTemp(Result));
+	}
+}
+
+void FUnrealGPTDownloadManager::Download(TArray<FUnrealGPTDownloadRequest> Requests, FOnComplete OnComplete)
+{
+	if (Requests.Num() == 0)
+	{
+		if (OnComplete)
+		{
+			OnComplete(TArray<FUnrealGPTDownloadResult>());
+		}
+		return;
+	}
+
+	TSharedPtr<FBatch> Batch = MakeShared<FBatch>();
+	Batch->Results.SetNum(Requests.Num());
+	Batch->NumPending = Requests.Num();
+	Batch->OnComplete = MoveTemp(OnComplete);
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (int32 Index = 0; Index < Requests.Num(); ++Index)
+		{
+			FJobRef Job = MakeShared<FJob, ESPMode::ThreadSafe>();
+			Job->Batch = Batch;
+			Job->Index = Index;
+			Job->PartialPath = GetPartialPath(Requests[Index].StagingFolder, Requests[Index].Url);
+			Job->Request = MoveTemp(Requests[Index]);
+			Queued.Add(Job);
+		}
+	}
+
+	Pump();
+}
+
+TArray<FUnrealGPTDownloadResult> FUnrealGPTDownloadManager::DownloadAndWait(TArray<FUnrealGPTDownloadRequest> Requests)
+{
+	TArray<FUnrealGPTDownloadResult> Results;
+	FEvent* DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
+
+	Download(MoveTemp(Requests), [&Results, DoneEvent](TArray<FUnrealGPTDownloadResult>&& BatchResults)
+	{
+		Results = MoveTemp(BatchResults);
+		DoneEvent->Trigger();
+	});
+
+	// The stall watchdog runs on the core ticker, which cannot tick while the game thread waits here
+	const uint32 TickIntervalMs = static_cast<uint32>(UnrealGPTDownloadManagerPrivate::TickIntervalSeconds * 1000.0f);
+	while (!DoneEvent->Wait(TickIntervalMs))
+	{
+		if (IsInGameThread())
+		{
+			HandleTick(UnrealGPTDownloadManagerPrivate::TickIntervalSeconds);
+		}
+	}
+	FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+	return Results;
+}
+
+FUnrealGPTDownloadProgress FUnrealGPTDownloadManager::GetProgress() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return PublishedProgress;
+}
+
+FString FUnrealGPTDownloadManager::GetPartialPath(const FString& StagingFolder, const FString& Url)
+{
+	return StagingFolder / FString::Printf(TEXT(".download-%s.part"), *FMD5::HashAnsiString(*Url));
+}
+
+int64 FUnrealGPTDownloadManager::GetContentRangeStart(const FString& ContentRange)
+{
+	FString Range = ContentRange.TrimStartAndEnd();
+	if (!Range.RemoveFromStart(TEXT("bytes "), ESearchCase::IgnoreCase))
+	{
+		return -1;
+	}
+
+	FString First;
+	if (!Range.TrimStart().Split(TEXT("-"), &First, nullptr) || First.IsEmpty() || !First.IsNumeric())
+	{
+		return -1;
+	}
+	return FCString::Atoi64(*First);
+}
+
+FString FUnrealGPTDownloadManager::GetExtension(const FString& Url, const FString& MimeType)
+{
+	FString UrlPath = Url;
+	int32 QueryIndex = INDEX_NONE;
+	if (UrlPath.FindChar(TEXT('?'), QueryIndex))
+	{
+		UrlPath.LeftInline(QueryIndex);
+	}
+
+	// Content types are often generic (application/octet-stream) where the URL still names the format
+	const FString UrlExtension = FPaths::GetExtension(UrlPath).ToLower();
+	if (!UrlExtension.IsEmpty() && FMcpResultNormalizer::NormalizeMimeType(UrlExtension).Contains(TEXT("/")))
+	{
+		return UrlExtension;
+	}
+
+	const FString MimeExtension = FMcpResultNormalizer::ExtensionFromMime(FMcpResultNormalizer::NormalizeMimeType(MimeType));
+	if (MimeExtension == TEXT("bin") && !UrlExtension.IsEmpty() && UrlExtension.Len() <= 5)
+	{
+		return UrlExtension;
+	}
+	return MimeExtension;
+}
+
+bool FUnrealGPTDownloadManager::StageFile(const FString& SourcePath, const FString& StagingFolder, const FString& Extension,
+	FString& OutLocalPath, bool& bOutDeduplicated, FString& OutError)
+{
+	using namespace UnrealGPTDownloadManagerPrivate;
+
+	bOutDeduplicated = false;
+
+	FString Hash;
+	if (!HashFile(SourcePath, Hash))
+	{
+		OutError = FString::Printf(TEXT("Failed to read downloaded file: %s"), *SourcePath);
+		return false;
+	}
+
+	IFileManager& FileManager = IFileManager::Get();
+	OutLocalPath = StagingFolder / (Hash + TEXT(".") + Extension);
+
+	if (FileManager.FileSize(*OutLocalPath) == FileManager.FileSize(*SourcePath))
+	{
+		FileManager.Delete(*SourcePath);
+		bOutDeduplicated = true;
+		return true;
+	}
+
+	if (!FileManager.Move(*OutLocalPath, *SourcePath))
+	{
+		OutError = FString::Printf(TEXT("Failed to move downloaded file to %s"), *OutLocalPath);
+		return false;
+	}
+	return true;
+}
+
+void FUnrealGPTDownloadManager::Pump()
+{
+	const UUnrealGPTSettings* Settings = GetDefault<UUnrealGPTSettings>();
+	const int32 MaxConcurrent = FMath::Max(1, Settings ? Settings->MaxConcurrentDownloads : 4);
+
+	TArray<FJobRef> ToStart;
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (int32 Index = 0; Index < Queued.Num() && Active.Num() < MaxConcurrent; )
+		{
+			// Two downloads of the same URL into the same folder would share a partial file
+			const FJobRef Job = Queued[Index];
+			if (Active.ContainsByPredicate([&Job](const FJobRef& Other) { return Other->PartialPath == Job->PartialPath; }))
+			{
+				++Index;
+				continue;
+			}
+
+			Queued.RemoveAt(Index);
+			Job->LastActivityTime = FPlatformTime::Seconds();
+			Active.Add(Job);
+			ToStart.Add(Job);
+		}
+	}
+
+	// Outside the lock: a request that fails immediately may complete inside ProcessRequest
+	for (const FJobRef& Job : ToStart)
+	{
+		FString Error;
+		if (!StartAttempt(Job, Error))
+		{
+			{
+				FScopeLock ScopeLock(&Lock);
+				Active.Remove(Job);
+			}
+
+			FUnrealGPTDownloadResult Result;
+			Result.Url = Job->Request.Url;
+			Result.Error = Error;
+			CompleteJob(Job, MoveTemp(Result));
+			Pump();
+		}
+	}
+}
+
+bool FUnrealGPTDownloadManager::StartAttempt(const FJobRef& Job, FString& OutError)
+{
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.MakeDirectory(*Job->Request.StagingFolder, true);
+
+	// A partial file this job did not write (an earlier session, another batch) may be from a different
+	// version of the resource, and one without a validator cannot be resumed safely either.
+	if (Job->Attempt == 0 || Job->Validator.IsEmpty())
+	{
+		FileManager.Delete(*Job->PartialPath);
+		Job->Validator.Reset();
+	}
+
+	// Bytes left by an earlier attempt are kept and only the rest is requested. The rest goes to its own
+	// segment because the server may ignore the Range header and send the whole file again.
+	const int64 ResumeOffset = FMath::Max<int64>(FileManager.FileSize(*Job->PartialPath), 0);
+	const FString AttemptPath = ResumeOffset > 0 ? Job->PartialPath + TEXT(".resume") : Job->PartialPath;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Job->ResumeOffset = ResumeOffset;
+		Job->AttemptPath = AttemptPath;
+		Job->AttemptValidator.Reset();
+		Job->BytesReceived = 0;
+		Job->BytesExpected = 0;
+	}
+
+	FArchive* Writer = FileManager.CreateFileWriter(*Job->AttemptPath);
+	if (!Writer)
+	{
+		OutError = FString::Printf(TEXT("Failed to create download file: %s"), *Job->AttemptPath);
+		return false;
+	}
+	Job->Writer = MakeShareable(Writer);
+
+	TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Job->Request.Url);
+	Request->SetVerb(TEXT("GET"));
+	for (const TPair<FString, FString>& Header : Job->Request.Headers)
+	{
+		Request->SetHeader(Header.Key, Header.Value);
+	}
+	if (Job->ResumeOffset > 0)
+	{
+		// If-Range makes a server whose copy changed send the whole new file (200) instead of the rest of it
+		Request->SetHeader(TEXT("Range"), FString::Printf(TEXT("bytes=%lld-"), Job->ResumeOffset));
+		Request->SetHeader(TEXT("If-Range"), Job->Validator);
+	}
+	Request->SetTimeout(AttemptTimeoutSeconds);
+	Request->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+	Request->SetResponseBodyReceiveStream(Job->Writer.ToSharedRef());
+
+	TWeakPtr<FJob, ESPMode::ThreadSafe> WeakJob = Job;
+	Request->OnHeaderReceived().BindLambda(
+		[this, WeakJob](FHttpRequestPtr, const FString& HeaderName, const FString& HeaderValue)
+		{
+			const TSharedPtr<FJob, ESPMode::ThreadSafe> PinnedJob = WeakJob.Pin();
+			if (!PinnedJob.IsValid())
+			{
+				return;
+			}
+
+			FScopeLock ScopeLock(&Lock);
+			if (HeaderName.Equals(TEXT("Content-Length"), ESearchCase::IgnoreCase))
+			{
+				PinnedJob->BytesExpected = FCString::Atoi64(*HeaderValue);
+			}
+			else if (HeaderName.Equals(TEXT("ETag"), ESearchCase::IgnoreCase))
+			{
+				// Weak tags are not allowed in If-Range; an ETag takes precedence over Last-Modified
+				PinnedJob->AttemptValidator = HeaderValue.StartsWith(TEXT("W/")) ? FString() : HeaderValue;
+			}
+			else if (HeaderName.Equals(TEXT("Last-Modified"), ESearchCase::IgnoreCase) && PinnedJob->AttemptValidator.IsEmpty())
+			{
+				PinnedJob->AttemptValidator = HeaderValue;
+			}
+		});
+	Request->OnRequestProgress64().BindLambda(
+		[this, WeakJob](FHttpRequestPtr, uint64, uint64 BytesReceived)
+		{
+			if (const TSharedPtr<FJob, ESPMode::ThreadSafe> PinnedJob = WeakJob.Pin())
+			{
+				FScopeLock ScopeLock(&Lock);
+				PinnedJob->BytesReceived = static_cast<int64>(BytesReceived);
+				PinnedJob->LastActivityTime = FPlatformTime::Seconds();
+			}
+		});
+	Request->OnProcessRequestComplete().BindLambda(
+		[this, WeakJob](FHttpRequestPtr, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			if (const TSharedPtr<FJob, ESPMode::ThreadSafe> PinnedJob = WeakJob.Pin())
+			{
+				HandleAttemptComplete(PinnedJob.ToSharedRef(), Response, bConnectedSuccessfully);
+			}
+		});
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		Job->HttpRequest = Request;
+	}
+	Request->ProcessRequest();
+	return true;
+}
+
+void FUnrealGPTDownloadManager::HandleAttemptComplete(const FJobRef& Job, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+{
+	using namespace UnrealGPTDownloadManagerPrivate;
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!Active.Contains(Job))
+		{
+			return;
+		}
+		Active.Remove(Job);
+		Job->HttpRequest.Reset();
+	}
+
+	if (Job->Writer.IsValid())
+	{
+		Job->Writer->Close();
+		Job->Writer.Reset();
+	}
+
+	IFileManager& FileManager = IFileManager::Get();
+	const int32 ResponseCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+	const bool bResumed = Job->AttemptPath != Job->PartialPath;
+
+	// A 206 must continue exactly where the partial file ends; anything else would corrupt it
+	bool bRangeMismatch = false;
+	if (bConnectedSuccessfully && ResponseCode == 206 && bResumed)
+	{
+		bRangeMismatch = GetContentRangeStart(Response->GetHeader(TEXT("Content-Range"))) != Job->ResumeOffset;
+		if (bRangeMismatch)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: Download of %s resumed at the wrong offset (Content-Range: %s); restarting"),
+				*Job->Request.Url, *Response->GetHeader(TEXT("Content-Range")));
+		}
+	}
+
+	if (bConnectedSuccessfully && !bRangeMismatch && (ResponseCode == 200 || (ResponseCode == 206 && bResumed)))
+	{
+		const FString ContentType = Response->GetContentType();
+		Async(EAsyncExecution::ThreadPool, [this, Job, ResponseCode, ContentType]()
+		{
+			FinishJob(Job, ResponseCode, ContentType);
+		});
+		Pump();
+		return;
+	}
+
+	// Only a first attempt that was receiving the file itself leaves bytes worth resuming from;
+	// error bodies and broken resume segments are dropped.
+	if (bResumed || (ResponseCode != 200 && ResponseCode != 0))
+	{
+		FileManager.Delete(*Job->AttemptPath);
+	}
+	else
+	{
+		// The kept bytes can only be resumed against the response they came from
+		FScopeLock ScopeLock(&Lock);
+		Job->Validator = Job->AttemptValidator;
+	}
+	if (bRangeMismatch || (ResponseCode >= 400 && ResponseCode < 500 && ResponseCode != 408 && ResponseCode != 429))
+	{
+		FileManager.Delete(*Job->PartialPath);
+	}
+
+	if ((bRangeMismatch || IsRetryable(Response, bConnectedSuccessfully)) && ++Job->Attempt < MaxAttempts)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: Download of %s failed (HTTP %d); retrying (attempt %d of %d)"),
+			*Job->Request.Url, ResponseCode, Job->Attempt + 1, MaxAttempts);
+		{
+			FScopeLock ScopeLock(&Lock);
+			Queued.Insert(Job, 0);
+		}
+		Pump();
+		return;
+	}
+
+	// Nothing will resume from the bytes of a job that gave up
+	FileManager.Delete(*Job->PartialPath);
+
+	FUnrealGPTDownloadResult Result;
+	Result.Url = Job->Request.Url;
+	Result.Error = ResponseCode > 0
+		? FString::Printf(TEXT("Download failed HTTP %d"), ResponseCode)
+		: TEXT("Download request failed");
+	CompleteJob(Job, MoveTemp(Result));
+	Pump();
+}
+
+void FUnrealGPTDownloadManager::FinishJob(const FJobRef& Job, int32 ResponseCode, const FString& ContentType)
+{
+	using namespace UnrealGPTDownloadManagerPrivate;
+
+	IFileManager& FileManager = IFileManager::Get();
+
+	FUnrealGPTDownloadResult Result;
+	Result.Url = Job->Request.Url;
+	Result.MimeType = ContentType;
+
+	if (Job->AttemptPath != Job->PartialPath)
+	{
+		// 206 continues the partial file; a 200 means the server sent everything again
+		const bool bMerged = ResponseCode == 206
+			? AppendFile(Job->PartialPath, Job->AttemptPath)
+			: FileManager.Move(*Job->PartialPath, *Job->AttemptPath);
+		FileManager.Delete(*Job->AttemptPath);
+
+		if (!bMerged)
+		{
+			FileManager.Delete(*Job->PartialPath);
+			Result.Error = FString::Printf(TEXT("Failed to assemble resumed download: %s"), *Job->PartialPath);
+			CompleteJob(Job, MoveTemp(Result));
+			return;
+		}
+	}
+
+	Result.NumBytes = FileManager.FileSize(*Job->PartialPath);
+	if (Result.NumBytes <= 0)
+	{
+		FileManager.Delete(*Job->PartialPath);
+		Result.Error = TEXT("Download returned no content");
+		CompleteJob(Job, MoveTemp(Result));
+		return;
+	}
+
+	Result.bSuccess = StageFile(Job->PartialPath, Job->Request.StagingFolder, GetExtension(Job->Request.Url, ContentType),
+		Result.LocalPath, Result.bDeduplicated, Result.Error);
+	CompleteJob(Job, MoveTemp(Result));
+}
+
+void FUnrealGPTDownloadManager::CompleteJob(const FJobRef& Job, FUnrealGPTDownloadResult&& Result)
+{
+	TSharedPtr<FBatch> Batch;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!Job->Batch.IsValid())
+		{
+			return;
+		}
+		Job->Batch->Results[Job->Index] = MoveTemp(Result);
+		if (--Job->Batch->NumPending == 0)
+		{
+			Batch = Job->Batch;
+		}
+		Job->Batch.Reset();
+	}
+
+	if (Batch.IsValid() && Batch->OnComplete)
+	{
+		Batch->OnComplete(MoveTemp(Batch->Results));
+	}
+}
+
+bool FUnrealGPTDownloadManager::HandleTick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FUnrealGPTDownloadProgress Progress;
+	TArray<FHttpRequestPtr> Stalled;
+	bool bChanged = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Progress.NumActive = Active.Num();
+		Progress.NumQueued = Queued.Num();
+		for (const FJobRef& Job : Active)
+		{
+			Progress.BytesReceived += Job->ResumeOffset + Job->BytesReceived;
+			Progress.BytesExpected += Job->BytesExpected > 0 ? Job->ResumeOffset + Job->BytesExpected : 0;
+
+			if (Job->HttpRequest.IsValid() && Now - Job->LastActivityTime > StallTimeoutSeconds)
+			{
+				Stalled.Add(Job->HttpRequest);
+				Job->LastActivityTime = Now;
+			}
+		}
+
+		bChanged = Progress.NumActive != PublishedProgress.NumActive
+			|| Progress.NumQueued != PublishedProgress.NumQueued
+			|| Progress.BytesReceived != PublishedProgress.BytesReceived
+			|| Progress.BytesExpected != PublishedProgress.BytesExpected;
+		if (bChanged)
+		{
+			Progress.Generation = PublishedProgress.Generation + 1;
+			PublishedProgress = Progress;
+		}
+	}
+
+	// Canceling completes the attempt as a connection failure, which retries with a Range request
+	for (const FHttpRequestPtr& Request : Stalled)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: Download of %s stalled; restarting"), *Request->GetURL());
+		Request->CancelRequest();
+	}
+
+	if (bChanged)
+	{
+		ProgressChanged.Broadcast(Progress);
+	}
+	return true;
+}
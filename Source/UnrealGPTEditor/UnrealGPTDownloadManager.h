@@ -0,0 +1,148 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+
+/** One file to fetch into a staging folder. */
+struct FUnrealGPTDownloadRequest
+{
+	FString Url;
+	TMap<FString, FString> Headers;
+	/** Folder the finished file is moved into. */
+	FString StagingFolder;
+};
+
+struct FUnrealGPTDownloadResult
+{
+	bool bSuccess = false;
+	FString Url;
+	FString LocalPath;
+	/** Content-Type of the response, if the server sent one. */
+	FString MimeType;
+	FString Error;
+	int64 NumBytes = 0;
+	/** Identical content was already staged at LocalPath, so nothing new was written. */
+	bool bDeduplicated = false;
+};
+
+/** Aggregate state of the download queue, published to the UI while it changes. */
+struct FUnrealGPTDownloadProgress
+{
+	int32 NumActive = 0;
+	int32 NumQueued = 0;
+	int64 BytesReceived = 0;
+	/** Sum of the sizes announced by active downloads; 0 when no server sent a length. */
+	int64 BytesExpected = 0;
+	/** Incremented on every published change. */
+	uint32 Generation = 0;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnUnrealGPTDownloadProgress, const FUnrealGPTDownloadProgress&);
+
+/**
+ * Shared download queue for generated outputs (Replicate files, MCP resource URLs). Runs at most
+ * MaxConcurrentDownloads requests at once and streams each response body straight into a partial file
+ * next to its destination, so large models and videos are never held in memory. Interrupted downloads
+ * are retried and resumed with a Range request; finished files are named by their SHA-1, so content that
+ * is already staged is reused instead of written twice.
+ *
+ * HTTP callbacks complete on the HTTP thread and finishing work runs on the thread pool, so batches make
+ * progress even while the caller blocks in DownloadAndWait. Requests may be queued from any thread.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTDownloadManager
+{
+public:
+	using FOnComplete = TFunction<void(TArray<FUnrealGPTDownloadResult>&& Results)>;
+
+	static constexpr int32 MaxAttempts = 3;
+	/** Upper bound for one attempt, however much data is still arriving. */
+	static constexpr float AttemptTimeoutSeconds = 600.0f;
+	/** An attempt that receives nothing for this long is canceled and retried. */
+	static constexpr double StallTimeoutSeconds = 45.0;
+
+	static FUnrealGPTDownloadManager& Get();
+
+	void Initialize();
+
+	/** Fail everything still queued or running so no caller is left waiting. */
+	void Shutdown();
+
+	/** Queue a batch. OnComplete runs once, on any thread, with results in request order. */
+	void Download(TArray<FUnrealGPTDownloadRequest> Requests, FOnComplete OnComplete);
+
+	/** Queue a batch and block until it finishes, for callers that must return a result synchronously. */
+	TArray<FUnrealGPTDownloadResult> DownloadAndWait(TArray<FUnrealGPTDownloadRequest> Requests);
+
+	FUnrealGPTDownloadProgress GetProgress() const;
+
+	/** Broadcast on the game thread when the published progress changes. */
+	FOnUnrealGPTDownloadProgress& OnProgressChanged() { return ProgressChanged; }
+
+	/** Partial file a download of Url into StagingFolder writes to, stable across attempts. */
+	static FString GetPartialPath(const FString& StagingFolder, const FString& Url);
+
+	/** First byte offset named by a "bytes <first>-<last>/<total>" Content-Range header, or -1 if it names none. */
+	static int64 GetContentRangeStart(const FString& ContentRange);
+
+	/** File extension for a download: the URL's when it names a known type, otherwise the Content-Type's. */
+	static FString GetExtension(const FString& Url, const FString& MimeType);
+
+	/**
+	 * Move a finished download to StagingFolder/<sha1>.<Extension>. If that file already exists the
+	 * source is deleted and the existing path returned with bOutDeduplicated set.
+	 */
+	static bool StageFile(const FString& SourcePath, const FString& StagingFolder, const FString& Extension,
+		FString& OutLocalPath, bool& bOutDeduplicated, FString& OutError);
+
+private:
+	struct FBatch
+	{
+		TArray<FUnrealGPTDownloadResult> Results;
+		int32 NumPending = 0;
+		FOnComplete OnComplete;
+	};
+
+	struct FJob
+	{
+		TSharedPtr<FBatch> Batch;
+		int32 Index = 0;
+		FUnrealGPTDownloadRequest Request;
+		FString PartialPath;
+		/** File this attempt streams into: PartialPath, or a separate segment when resuming. */
+		FString AttemptPath;
+		int64 ResumeOffset = 0;
+		/** Strong ETag or Last-Modified of the response PartialPath holds; sent as If-Range when resuming. */
+		FString Validator;
+		/** Validator seen in this attempt's headers; adopted once its bytes are kept as PartialPath. */
+		FString AttemptValidator;
+		int32 Attempt = 0;
+		int64 BytesReceived = 0;
+		int64 BytesExpected = 0;
+		double LastActivityTime = 0.0;
+		TSharedPtr<FArchive> Writer;
+		FHttpRequestPtr HttpRequest;
+	};
+
+	using FJobRef = TSharedRef<FJob, ESPMode::ThreadSafe>;
+
+	FUnrealGPTDownloadManager() = default;
+
+	/** Start queued jobs up to the concurrency limit. */
+	void Pump();
+	bool StartAttempt(const FJobRef& Job, FString& OutError);
+	void HandleAttemptComplete(const FJobRef& Job, FHttpResponsePtr Response, bool bConnectedSuccessfully);
+	void FinishJob(const FJobRef& Job, int32 ResponseCode, const FString& ContentType);
+	void CompleteJob(const FJobRef& Job, FUnrealGPTDownloadResult&& Result);
+	bool HandleTick(float DeltaTime);
+
+	mutable FCriticalSection Lock;
+	TArray<FJobRef> Queued;
+	TArray<FJobRef> Active;
+	FUnrealGPTDownloadProgress PublishedProgress;
+
+	FOnUnrealGPTDownloadProgress ProgressChanged;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -64,7 +64,8 @@ public class UnrealGPTEditor : ModuleRules
 				"BlueprintGraph",
 				"Kismet",
 				"KismetCompiler",
-				"AssetTools"
+				"AssetTools",
+				"DirectoryWatcher"
 			}
 		);
 	}
@@ -2,7 +2,13 @@
 
 #include "UnrealGPTEditor.h"
 #include "ISettingsModule.h"
+#include "UnrealGPTBlueprintActionIndex.h"
+#include "UnrealGPTBlueprintGraph.h"
+#include "UnrealGPTCodexAuth.h"
+#include "UnrealGPTDownloadManager.h"
 #include "UnrealGPTLogCapture.h"
+#include "UnrealGPTReflectionIndex.h"
+#include "UnrealGPTReplicateClient.h"
 #include "UnrealGPTSettings.h"
 #include "LevelEditor.h"
 #include "ToolMenus.h"
@@ -17,11 +23,20 @@ static const FName UnrealGPTTabName("UnrealGPT");
 void FUnrealGPTEditorModule::StartupModule()
 {
 	FUnrealGPTLogCapture::Get().Initialize();
+	FUnrealGPTReflectionIndex::Get().Initialize();
+	FUnrealGPTCodexAuth::Get().Initialize();
+	FUnrealGPTDownloadManager::Get().Initialize();
 	RegisterMenus();
 }
 
 void FUnrealGPTEditorModule::ShutdownModule()
 {
+	FUnrealGPTReplicateClient::Get().Shutdown();
+	FUnrealGPTDownloadManager::Get().Shutdown();
+	FUnrealGPTCodexAuth::Get().Shutdown();
+	FUnrealGPTBlueprintActionIndex::Get().Shutdown();
+	FUnrealGPTBlueprintGraph::ResetLookupCache();
+	FUnrealGPTReflectionIndex::Get().Shutdown();
 	FUnrealGPTLogCapture::Get().Shutdown();
 }
 
@@ -0,0 +1,357 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTFlacEncoder.h"
+#include "Misc/SecureHash.h"
+
+namespace UnrealGPTFlacEncoderPrivate
+{
+	static constexpr int32 BitsPerSample = 16;
+	static constexpr int32 MinStreamBlockSize = 16;
+	static constexpr int32 MaxFixedOrder = 4;
+	static constexpr int32 MaxPartitionOrder = 8;
+	static constexpr int32 MaxRiceParameter = 14;
+
+	/** MSB-first bit packer. */
+	class FBitWriter
+	{
+	public:
+		explicit FBitWriter(TArray<uint8>& InOut) : Out(InOut) {}
+
+		void Write(uint32 Value, int32 NumBits)
+		{
+			const uint64 Mask = NumBits == 32 ? 0xFFFFFFFFull : ((1ull << NumBits) - 1);
+			Accumulator = (Accumulator << NumBits) | (Value & Mask);
+			PendingBits += NumBits;
+			while (PendingBits >= 8)
+			{
+				PendingBits -= 8;
+				Out.Add(static_cast<uint8>(Accumulator >> PendingBits));
+			}
+		}
+
+		void WriteSigned(int32 Value, int32 NumBits)
+		{
+			Write(static_cast<uint32>(Value), NumBits);
+		}
+
+		void WriteRice(int32 Residual, int32 Parameter)
+		{
+			const uint32 Folded = (static_cast<uint32>(Residual) << 1) ^ static_cast<uint32>(Residual >> 31);
+			uint32 Quotient = Folded >> Parameter;
+			while (Quotient >= 31)
+			{
+				Write(0, 31);
+				Quotient -= 31;
+			}
+			Write(1, Quotient + 1);
+			if (Parameter > 0)
+			{
+				Write(Folded, Parameter);
+			}
+		}
+
+		void AlignToByte()
+		{
+			if (PendingBits > 0)
+			{
+				Write(0, 8 - PendingBits);
+			}
+		}
+
+	private:
+		TArray<uint8>& Out;
+		uint64 Accumulator = 0;
+		int32 PendingBits = 0;
+	};
+
+	static uint8 Crc8(const uint8* Data, int32 Num)
+	{
+		uint8 Crc = 0;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Crc ^= Data[Index];
+			for (int32 Bit = 0; Bit < 8; ++Bit)
+			{
+				Crc = (Crc & 0x80) ? static_cast<uint8>((Crc << 1) ^ 0x07) : static_cast<uint8>(Crc << 1);
+			}
+		}
+		return Crc;
+	}
+
+	static uint16 Crc16(const uint8* Data, int32 Num)
+	{
+		uint16 Crc = 0;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Crc ^= static_cast<uint16>(Data[Index]) << 8;
+			for (int32 Bit = 0; Bit < 8; ++Bit)
+			{
+				Crc = (Crc & 0x8000) ? static_cast<uint16>((Crc << 1) ^ 0x8005) : static_cast<uint16>(Crc << 1);
+			}
+		}
+		return Crc;
+	}
+
+	static uint32 GetSampleRateCode(int32 SampleRate)
+	{
+		switch (SampleRate)
+		{
+		case 8000: return 4;
+		case 16000: return 5;
+		case 22050: return 6;
+		case 24000: return 7;
+		case 32000: return 8;
+		case 44100: return 9;
+		case 48000: return 10;
+		case 96000: return 11;
+		default: return 0; // Taken from STREAMINFO
+		}
+	}
+
+	static void WriteUtf8Number(FBitWriter& Writer, uint32 Value)
+	{
+		if (Value < 0x80)
+		{
+			Writer.Write(Value, 8);
+			return;
+		}
+
+		int32 NumBytes = 2;
+		while (NumBytes < 6 && Value >= (1u << (5 * NumBytes + 1)))
+		{
+			++NumBytes;
+		}
+
+		const uint32 Prefix = (0xFFu << (8 - NumBytes)) & 0xFF;
+		Writer.Write(Prefix | (Value >> (6 * (NumBytes - 1))), 8);
+		for (int32 Index = NumBytes - 2; Index >= 0; --Index)
+		{
+			Writer.Write(0x80 | ((Value >> (6 * Index)) & 0x3F), 8);
+		}
+	}
+
+	static void ComputeFixedResidual(const int16* Samples, int32 Num, int32 Order, TArray<int32>& OutResidual)
+	{
+		OutResidual.SetNumUninitialized(Num - Order);
+		int32* Residual = OutResidual.GetData();
+		for (int32 Index = Order; Index < Num; ++Index)
+		{
+			const int32 X0 = Samples[Index];
+			int32 Value = X0;
+			switch (Order)
+			{
+			case 1: Value = X0 - Samples[Index - 1]; break;
+			case 2: Value = X0 - 2 * Samples[Index - 1] + Samples[Index - 2]; break;
+			case 3: Value = X0 - 3 * Samples[Index - 1] + 3 * Samples[Index - 2] - Samples[Index - 3]; break;
+			case 4: Value = X0 - 4 * Samples[Index - 1] + 6 * Samples[Index - 2] - 4 * Samples[Index - 3] + Samples[Index - 4]; break;
+			default: break;
+			}
+			Residual[Index - Order] = Value;
+		}
+	}
+
+	/** Rice parameter with the fewest bits for a partition; returns those bits. */
+	static int64 ChooseRiceParameter(const int32* Residual, int32 Num, int32& OutParameter)
+	{
+		int64 SumFolded = 0;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			SumFolded += (static_cast<uint32>(Residual[Index]) << 1) ^ static_cast<uint32>(Residual[Index] >> 31);
+		}
+
+		int64 BestBits = MAX_int64;
+		OutParameter = 0;
+		for (int32 Parameter = 0; Parameter <= MaxRiceParameter; ++Parameter)
+		{
+			// Summing (u >> k) over the partition is approximated by (sum u) >> k; the error is below one bit per sample.
+			const int64 Bits = static_cast<int64>(Num) * (Parameter + 1) + (SumFolded >> Parameter);
+			if (Bits < BestBits)
+			{
+				BestBits = Bits;
+				OutParameter = Parameter;
+			}
+		}
+		return BestBits;
+	}
+
+	struct FResidualCoding
+	{
+		int32 PartitionOrder = 0;
+		TArray<int32, TInlineAllocator<1 << MaxPartitionOrder>> Parameters;
+		int64 Bits = MAX_int64;
+	};
+
+	static FResidualCoding ChooseResidualCoding(const TArray<int32>& Residual, int32 BlockSamples, int32 Order)
+	{
+		FResidualCoding Best;
+		for (int32 PartitionOrder = 0; PartitionOrder <= MaxPartitionOrder; ++PartitionOrder)
+		{
+			const int32 PartitionSamples = BlockSamples >> PartitionOrder;
+			if ((BlockSamples & ((1 << PartitionOrder) - 1)) != 0 || PartitionSamples <= Order)
+			{
+				break;
+			}
+
+			FResidualCoding Candidate;
+			Candidate.PartitionOrder = PartitionOrder;
+			Candidate.Bits = 2 + 4;
+			int32 Offset = 0;
+			for (int32 Partition = 0; Partition < (1 << PartitionOrder); ++Partition)
+			{
+				const int32 Count = Partition == 0 ? PartitionSamples - Order : PartitionSamples;
+				int32 Parameter = 0;
+				Candidate.Bits += 4 + ChooseRiceParameter(Residual.GetData() + Offset, Count, Parameter);
+				Candidate.Parameters.Add(Parameter);
+				Offset += Count;
+			}
+
+			if (Candidate.Bits < Best.Bits)
+			{
+				Best = MoveTemp(Candidate);
+			}
+		}
+		return Best;
+	}
+
+	static void WriteSubframe(FBitWriter& Writer, const int16* Samples, int32 Num)
+	{
+		bool bConstant = true;
+		for (int32 Index = 1; Index < Num && bConstant; ++Index)
+		{
+			bConstant = Samples[Index] == Samples[0];
+		}
+		if (bConstant)
+		{
+			Writer.Write(0x00, 8);
+			Writer.WriteSigned(Samples[0], BitsPerSample);
+			return;
+		}
+
+		int32 BestOrder = INDEX_NONE;
+		int64 BestBits = static_cast<int64>(Num) * BitsPerSample;
+		FResidualCoding BestCoding;
+		TArray<int32> BestResidual;
+		TArray<int32> Residual;
+		for (int32 Order = 0; Order <= FMath::Min(MaxFixedOrder, Num - 1); ++Order)
+		{
+			ComputeFixedResidual(Samples, Num, Order, Residual);
+			FResidualCoding Coding = ChooseResidualCoding(Residual, Num, Order);
+			const int64 Bits = static_cast<int64>(Order) * BitsPerSample + Coding.Bits;
+			if (Bits < BestBits)
+			{
+				BestBits = Bits;
+				BestOrder = Order;
+				BestCoding = MoveTemp(Coding);
+				Swap(BestResidual, Residual);
+			}
+		}
+
+		if (BestOrder == INDEX_NONE)
+		{
+			Writer.Write(0x02, 8); // Verbatim
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				Writer.WriteSigned(Samples[Index], BitsPerSample);
+			}
+			return;
+		}
+
+		Writer.Write((0x08 | BestOrder) << 1, 8); // Fixed predictor, no wasted bits
+		for (int32 Index = 0; Index < BestOrder; ++Index)
+		{
+			Writer.WriteSigned(Samples[Index], BitsPerSample);
+		}
+
+		Writer.Write(0, 2); // 4-bit Rice parameters
+		Writer.Write(BestCoding.PartitionOrder, 4);
+		const int32 PartitionSamples = Num >> BestCoding.PartitionOrder;
+		int32 Offset = 0;
+		for (int32 Partition = 0; Partition < BestCoding.Parameters.Num(); ++Partition)
+		{
+			const int32 Count = Partition == 0 ? PartitionSamples - BestOrder : PartitionSamples;
+			const int32 Parameter = BestCoding.Parameters[Partition];
+			Writer.Write(Parameter, 4);
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				Writer.WriteRice(BestResidual[Offset + Index], Parameter);
+			}
+			Offset += Count;
+		}
+	}
+}
+
+TArray<uint8> FUnrealGPTFlacEncoder::EncodeMono16(const TArray<int16>& Samples, int32 SampleRate)
+{
+	using namespace UnrealGPTFlacEncoderPrivate;
+
+	TArray<uint8> Out;
+	if (Samples.Num() == 0 || SampleRate <= 0)
+	{
+		return Out;
+	}
+
+	// Speech compresses to roughly half of the PCM size
+	Out.Reserve(42 + Samples.Num());
+
+	FBitWriter Header(Out);
+	Header.Write(0x664C6143, 32); // "fLaC"
+	Header.Write(0x80, 8); // Last metadata block, STREAMINFO
+	Header.Write(34, 24);
+	// The format's minimum is 16 even when the only (last) frame is shorter
+	const int32 StreamBlockSize = FMath::Clamp(Samples.Num(), MinStreamBlockSize, BlockSize);
+	Header.Write(StreamBlockSize, 16);
+	Header.Write(StreamBlockSize, 16);
+	Header.Write(0, 24); // Frame sizes unknown
+	Header.Write(0, 24);
+	Header.Write(SampleRate, 20);
+	Header.Write(0, 3); // One channel
+	Header.Write(BitsPerSample - 1, 5);
+	const uint64 TotalSamples = Samples.Num();
+	Header.Write(static_cast<uint32>(TotalSamples >> 32), 4);
+	Header.Write(static_cast<uint32>(TotalSamples), 32);
+
+	// MD5 of the PCM as little-endian 16-bit samples, which is also their in-memory layout here
+	static_assert(PLATFORM_LITTLE_ENDIAN, "STREAMINFO MD5 hashes the samples in place");
+	FMD5 Md5;
+	Md5.Update(reinterpret_cast<const uint8*>(Samples.GetData()), Samples.Num() * sizeof(int16));
+	uint8 Digest[16];
+	Md5.Final(Digest);
+	for (const uint8 Byte : Digest)
+	{
+		Header.Write(Byte, 8);
+	}
+
+	TArray<uint8> Frame;
+	for (int32 Start = 0, FrameNumber = 0; Start < Samples.Num(); Start += BlockSize, ++FrameNumber)
+	{
+		const int32 Num = FMath::Min(BlockSize, Samples.Num() - Start);
+		Frame.Reset();
+		FBitWriter Writer(Frame);
+
+		const uint32 BlockSizeCode = Num == BlockSize ? 12 : (Num <= 256 ? 6 : 7);
+		Writer.Write(0xFFF8, 16); // Sync code, fixed block size
+		Writer.Write(BlockSizeCode, 4);
+		Writer.Write(GetSampleRateCode(SampleRate), 4);
+		Writer.Write(0, 4); // Mono
+		Writer.Write(4, 3); // 16 bits per sample
+		Writer.Write(0, 1);
+		WriteUtf8Number(Writer, FrameNumber);
+		if (BlockSizeCode == 6)
+		{
+			Writer.Write(Num - 1, 8);
+		}
+		else if (BlockSizeCode == 7)
+		{
+			Writer.Write(Num - 1, 16);
+		}
+		Writer.Write(Crc8(Frame.GetData(), Frame.Num()), 8);
+
+		WriteSubframe(Writer, Samples.GetData() + Start, Num);
+		Writer.AlignToByte();
+		Writer.Write(Crc16(Frame.GetData(), Frame.Num()), 16);
+
+		Out.Append(Frame);
+	}
+
+	return Out;
+}
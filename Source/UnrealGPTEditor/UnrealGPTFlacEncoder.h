@@ -0,0 +1,19 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Minimal lossless FLAC writer for voice uploads: 16-bit mono, fixed-size blocks, fixed predictors of
+ * order 0-4 with partitioned Rice residuals and a verbatim fallback. Speech typically shrinks to about
+ * half of the PCM size. Pure function of its input; safe on any thread.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTFlacEncoder
+{
+public:
+	static constexpr int32 BlockSize = 4096;
+
+	/** A complete .flac file (marker, STREAMINFO with the PCM MD5, and frames); empty if Samples is empty. */
+	static TArray<uint8> EncodeMono16(const TArray<int16>& Samples, int32 SampleRate);
+};
@@ -2,6 +2,7 @@
 
 #include "UnrealGPTLogCapture.h"
 #include "Misc/DateTime.h"
+#include "Internationalization/Regex.h"
 
 FUnrealGPTLogCapture& FUnrealGPTLogCapture::Get()
 {
@@ -55,6 +56,11 @@ void FUnrealGPTLogCapture::AppendLine(ELogVerbosity::Type Verbosity, const FStri
 	Line.Category = Category;
 	Line.Message = Message;
 
+	if (Subscriptions.Num() > 0)
+	{
+		DispatchToSubscriptions(Line);
+	}
+
 	Lines.Add(MoveTemp(Line));
 	if (Lines.Num() > MaxBufferLines)
 	{
@@ -157,3 +163,79 @@ void FUnrealGPTLogCapture::ResetReadCursor()
 	FScopeLock Lock(&BufferLock);
 	ReadCursor = Lines.Num();
 }
+
+int32 FUnrealGPTLogCapture::Subscribe(const FUnrealGPTLogSubscriptionFilter& Filter)
+{
+	FSubscription Subscription;
+	Subscription.Filter = Filter;
+	Subscription.Filter.MaxBufferedLines = FMath::Max(1, Filter.MaxBufferedLines);
+	if (!Filter.MessageRegex.IsEmpty())
+	{
+		Subscription.MessagePattern = MakeShared<FRegexPattern>(Filter.MessageRegex, ERegexPatternFlags::CaseInsensitive);
+	}
+
+	FScopeLock Lock(&BufferLock);
+	const int32 SubscriptionId = NextSubscriptionId++;
+	Subscriptions.Add(SubscriptionId, MoveTemp(Subscription));
+	return SubscriptionId;
+}
+
+FUnrealGPTLogSubscriptionResult FUnrealGPTLogCapture::Drain(int32 SubscriptionId)
+{
+	FScopeLock Lock(&BufferLock);
+	FUnrealGPTLogSubscriptionResult Result;
+	if (FSubscription* Subscription = Subscriptions.Find(SubscriptionId))
+	{
+		Result = MoveTemp(Subscription->Pending);
+		Subscription->Pending = FUnrealGPTLogSubscriptionResult();
+	}
+	return Result;
+}
+
+FUnrealGPTLogSubscriptionResult FUnrealGPTLogCapture::Unsubscribe(int32 SubscriptionId)
+{
+	FScopeLock Lock(&BufferLock);
+	FUnrealGPTLogSubscriptionResult Result;
+	FSubscription Removed;
+	if (Subscriptions.RemoveAndCopyValue(SubscriptionId, Removed))
+	{
+		Result = MoveTemp(Removed.Pending);
+	}
+	return Result;
+}
+
+void FUnrealGPTLogCapture::DispatchToSubscriptions(const FUnrealGPTLogLine& Line)
+{
+	// Called with BufferLock held.
+	for (TPair<int32, FSubscription>& Pair : Subscriptions)
+	{
+		FSubscription& Subscription = Pair.Value;
+		const FUnrealGPTLogSubscriptionFilter& Filter = Subscription.Filter;
+
+		if (Line.Verbosity > Filter.MinVerbosity)
+		{
+			continue;
+		}
+
+		if (!Filter.CategoryContains.IsEmpty()
+			&& !Line.Category.Contains(Filter.CategoryContains, ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+
+		if (Subscription.MessagePattern.IsValid())
+		{
+			FRegexMatcher Matcher(*Subscription.MessagePattern, Line.Message);
+			if (!Matcher.FindNext())
+			{
+				continue;
+			}
+		}
+
+		++Subscription.Pending.TotalMatched;
+		if (Subscription.Pending.Lines.Num() < Filter.MaxBufferedLines)
+		{
+			Subscription.Pending.Lines.Add(Line);
+		}
+	}
+}
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Misc/OutputDevice.h"
 
+class FRegexPattern;
+
 /** Single captured log line from the UE logging system. */
 struct FUnrealGPTLogLine
 {
@@ -33,6 +35,23 @@ struct FUnrealGPTLogQueryResult
 	int32 NextReadIndex = 0;
 };
 
+/** Filters for a push-based subscription; matching lines are buffered until drained. */
+struct FUnrealGPTLogSubscriptionFilter
+{
+	ELogVerbosity::Type MinVerbosity = ELogVerbosity::Error;
+	FString CategoryContains;
+	/** Optional ICU regex matched against the message. Empty matches everything. */
+	FString MessageRegex;
+	int32 MaxBufferedLines = 20;
+};
+
+/** Lines captured by a subscription since it was opened or last drained. */
+struct FUnrealGPTLogSubscriptionResult
+{
+	TArray<FUnrealGPTLogLine> Lines;
+	int32 TotalMatched = 0;
+};
+
 /**
  * Thread-safe ring buffer that captures UE log output via FOutputDevice.
  * Registered on GLog at module startup.
@@ -55,14 +74,34 @@ public:
 	int32 GetReadCursor() const { return ReadCursor; }
 	void SetReadCursor(int32 NewCursor) { ReadCursor = NewCursor; }
 
+	/** Start buffering lines that match Filter. Returns a handle for Drain/Unsubscribe. */
+	int32 Subscribe(const FUnrealGPTLogSubscriptionFilter& Filter);
+
+	/** Return and clear the lines buffered for a subscription. */
+	FUnrealGPTLogSubscriptionResult Drain(int32 SubscriptionId);
+
+	/** Close a subscription, returning anything still buffered. */
+	FUnrealGPTLogSubscriptionResult Unsubscribe(int32 SubscriptionId);
+
 private:
 	FUnrealGPTLogCapture() = default;
 
 	void AppendLine(ELogVerbosity::Type Verbosity, const FString& Category, const FString& Message);
 	bool PassesFilters(const FUnrealGPTLogLine& Line, const FUnrealGPTLogQueryFilters& Filters) const;
 
+	struct FSubscription
+	{
+		FUnrealGPTLogSubscriptionFilter Filter;
+		TSharedPtr<FRegexPattern> MessagePattern;
+		FUnrealGPTLogSubscriptionResult Pending;
+	};
+
+	void DispatchToSubscriptions(const FUnrealGPTLogLine& Line);
+
 	mutable FCriticalSection BufferLock;
 	TArray<FUnrealGPTLogLine> Lines;
+	TMap<int32, FSubscription> Subscriptions;
+	int32 NextSubscriptionId = 1;
 	int32 ReadCursor = 0;
 	bool bRegistered = false;
 };
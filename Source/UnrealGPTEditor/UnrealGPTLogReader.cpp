@@ -16,6 +16,7 @@ namespace UnrealGPTLogReaderPrivate
 	static constexpr int32 DefaultMaxLines = 40;
 	static constexpr int32 DefaultMaxChars = 8000;
 	static constexpr int64 FileTailChunkBytes = 256 * 1024;
+	static constexpr int32 DigestMaxMessageChars = 400;
 
 	static FString SerializeJson(const TSharedPtr<FJsonObject>& Root)
 	{
@@ -440,6 +441,27 @@ FString FUnrealGPTLogReader::BuildResponseJson(
 	return UnrealGPTLogReaderPrivate::SerializeJson(Root);
 }
 
+TSharedPtr<FJsonObject> FUnrealGPTLogReader::BuildDigest(const FUnrealGPTLogSubscriptionResult& Matches)
+{
+	TSharedPtr<FJsonObject> Digest = MakeShareable(new FJsonObject);
+	Digest->SetNumberField(TEXT("total_matched"), Matches.TotalMatched);
+	Digest->SetBoolField(TEXT("truncated"), Matches.TotalMatched > Matches.Lines.Num());
+
+	TArray<TSharedPtr<FJsonValue>> LineValues;
+	LineValues.Reserve(Matches.Lines.Num());
+	for (const FUnrealGPTLogLine& Line : Matches.Lines)
+	{
+		TSharedPtr<FJsonObject> LineObj = MakeShareable(new FJsonObject);
+		LineObj->SetStringField(TEXT("v"), VerbosityToString(Line.Verbosity));
+		LineObj->SetStringField(TEXT("cat"), Line.Category);
+		LineObj->SetStringField(TEXT("msg"), Line.Message.Left(UnrealGPTLogReaderPrivate::DigestMaxMessageChars));
+		LineValues.Add(MakeShareable(new FJsonValueObject(LineObj)));
+	}
+	Digest->SetArrayField(TEXT("lines"), LineValues);
+
+	return Digest;
+}
+
 FString FUnrealGPTLogReader::Query(const FString& ArgumentsJson)
 {
 	FOptions Options;
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "UnrealGPTLogCapture.h"
 
+class FJsonObject;
+
 /**
  * read_log agent tool implementation.
  * Hybrid in-memory capture + efficient file-tail fallback.
@@ -40,6 +42,9 @@ public:
 	/** Execute read_log from a JSON arguments object. */
 	static FString Query(const FString& ArgumentsJson);
 
+	/** Compact digest of subscription matches, shaped like read_log lines. */
+	static TSharedPtr<FJsonObject> BuildDigest(const FUnrealGPTLogSubscriptionResult& Matches);
+
 #if WITH_DEV_AUTOMATION_TESTS
 	/** Test hook: tail a specific log file path. */
 	static FString TailLogFileForTest(
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTMarkdown.h"
+
+void FUnrealGPTMarkdownDocument::SetText(const FString& Text)
+{
+	if (Text.Len() >= Source.Len() && Text.StartsWith(Source, ESearchCase::CaseSensitive))
+	{
+		Append(Text.Mid(Source.Len()));
+		return;
+	}
+
+	Reset();
+	Append(Text);
+}
+
+void FUnrealGPTMarkdownDocument::Append(const FString& Delta)
+{
+	if (Delta.IsEmpty())
+	{
+		return;
+	}
+
+	RevertProvisionalTail();
+	Source += Delta;
+
+	// Parse every newly completed line; the committed prefix contains no unparsed newline.
+	int32 LineStart = CommittedLength;
+	for (int32 Index = CommittedLength; Index < Source.Len(); ++Index)
+	{
+		if (Source[Index] == TEXT('\n'))
+		{
+			ParseLine(FStringView(*Source + LineStart, Index - LineStart));
+			LineStart = Index + 1;
+		}
+	}
+
+	CommittedLength = LineStart;
+	CommittedBlockCount = Blocks.Num();
+	bCommittedInCode = bInCode;
+	CommittedCodeLineCount = (bInCode && Blocks.Num() > 0) ? Blocks.Last().Lines.Num() : 0;
+
+	// The partial last line is parsed provisionally and undone by the next append.
+	if (LineStart < Source.Len())
+	{
+		ParseLine(FStringView(*Source + LineStart, Source.Len() - LineStart));
+	}
+}
+
+void FUnrealGPTMarkdownDocument::Reset()
+{
+	if (Blocks.Num() > 0)
+	{
+		MarkChanged(0);
+	}
+
+	Source.Reset();
+	Blocks.Reset();
+	CommittedLength = 0;
+	CommittedBlockCount = 0;
+	CommittedCodeLineCount = 0;
+	bCommittedInCode = false;
+	bInCode = false;
+}
+
+void FUnrealGPTMarkdownDocument::RevertProvisionalTail()
+{
+	if (Blocks.Num() > CommittedBlockCount)
+	{
+		MarkChanged(CommittedBlockCount);
+		Blocks.SetNum(CommittedBlockCount);
+	}
+
+	if (bCommittedInCode && Blocks.Num() > 0)
+	{
+		FUnrealGPTMarkdownBlock& OpenCode = Blocks.Last();
+		if (OpenCode.Lines.Num() != CommittedCodeLineCount || OpenCode.bClosed)
+		{
+			MarkChanged(Blocks.Num() - 1);
+			OpenCode.Lines.SetNum(CommittedCodeLineCount);
+			OpenCode.bClosed = false;
+		}
+	}
+
+	bInCode = bCommittedInCode;
+}
+
+void FUnrealGPTMarkdownDocument::ParseLine(FStringView Line)
+{
+	if (Line.EndsWith(TEXT("\r")))
+	{
+		Line.LeftChopInline(1);
+	}
+
+	auto AddBlock = [this](EUnrealGPTMarkdownBlockType Type) -> FUnrealGPTMarkdownBlock&
+	{
+		MarkChanged(Blocks.Num());
+		FUnrealGPTMarkdownBlock& Block = Blocks.AddDefaulted_GetRef();
+		Block.Type = Type;
+		return Block;
+	};
+
+	// Fence lines open or close a code block and are not rendered (the language tag is ignored)
+	if (Line.StartsWith(TEXT("```")))
+	{
+		if (bInCode && Blocks.Num() > 0)
+		{
+			MarkChanged(Blocks.Num() - 1);
+			Blocks.Last().bClosed = true;
+			bInCode = false;
+		}
+		else
+		{
+			AddBlock(EUnrealGPTMarkdownBlockType::Code).bClosed = false;
+			bInCode = true;
+		}
+		return;
+	}
+
+	if (bInCode && Blocks.Num() > 0)
+	{
+		MarkChanged(Blocks.Num() - 1);
+		Blocks.Last().Lines.Emplace(Line);
+		return;
+	}
+
+	if (Line.TrimStartAndEnd().IsEmpty())
+	{
+		AddBlock(EUnrealGPTMarkdownBlockType::Blank);
+		return;
+	}
+
+	for (int32 Level = 3; Level >= 1; --Level)
+	{
+		const FString Prefix = FString::ChrN(Level, TEXT('#')) + TEXT(" ");
+		if (Line.StartsWith(Prefix))
+		{
+			FUnrealGPTMarkdownBlock& Heading = AddBlock(EUnrealGPTMarkdownBlockType::Heading);
+			Heading.HeadingLevel = Level;
+			Heading.Lines.Emplace(Line.RightChop(Prefix.Len()));
+			return;
+		}
+	}
+
+	if (Line.StartsWith(TEXT("- ")) || Line.StartsWith(TEXT("* ")))
+	{
+		AddBlock(EUnrealGPTMarkdownBlockType::Bullet).Lines.Emplace(Line.RightChop(2));
+		return;
+	}
+
+	AddBlock(EUnrealGPTMarkdownBlockType::Paragraph).Lines.Emplace(Line);
+}
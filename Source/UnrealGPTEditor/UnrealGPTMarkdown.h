@@ -0,0 +1,72 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EUnrealGPTMarkdownBlockType : uint8
+{
+	Blank,
+	Paragraph,
+	Heading,
+	Bullet,
+	Code,
+};
+
+/** One rendered unit of chat markdown: a single line, or a whole fenced code block. */
+struct FUnrealGPTMarkdownBlock
+{
+	EUnrealGPTMarkdownBlockType Type = EUnrealGPTMarkdownBlockType::Paragraph;
+
+	/** 1-3 for headings, 0 otherwise. */
+	int32 HeadingLevel = 0;
+
+	/** Line text without the markdown prefix; code blocks hold one entry per code line. */
+	TArray<FString> Lines;
+
+	/** False while a code block is still waiting for its closing fence. */
+	bool bClosed = true;
+};
+
+/**
+ * Block-level markdown parse of a chat message that can grow by appending. Lines that end in a newline are
+ * parsed once and never revisited; only the trailing partial line is re-parsed on each append, so a long
+ * streamed answer costs the same per delta regardless of its length.
+ *
+ * Supported: "#"/"##"/"###" headings, "- "/"* " bullets, ``` fenced code blocks and blank-line spacing.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTMarkdownDocument
+{
+public:
+	/** Replace the content; when Text extends the current source only the new suffix is parsed. */
+	void SetText(const FString& Text);
+
+	void Append(const FString& Delta);
+
+	void Reset();
+
+	const FString& GetSource() const { return Source; }
+	const TArray<FUnrealGPTMarkdownBlock>& GetBlocks() const { return Blocks; }
+
+	/** Index of the first block added, removed or modified since the last ClearChanges(); Blocks.Num() when none. */
+	int32 GetFirstChangedBlock() const { return FMath::Min(FirstChangedBlock, Blocks.Num()); }
+	void ClearChanges() { FirstChangedBlock = MAX_int32; }
+
+private:
+	void ParseLine(FStringView Line);
+	void RevertProvisionalTail();
+	void MarkChanged(int32 BlockIndex) { FirstChangedBlock = FMath::Min(FirstChangedBlock, BlockIndex); }
+
+	FString Source;
+	TArray<FUnrealGPTMarkdownBlock> Blocks;
+
+	/** Offset just past the last newline; everything before it is final. */
+	int32 CommittedLength = 0;
+	int32 CommittedBlockCount = 0;
+	/** Line count of the last committed block when it is an open code block. */
+	int32 CommittedCodeLineCount = 0;
+	bool bCommittedInCode = false;
+
+	bool bInCode = false;
+	int32 FirstChangedBlock = 0;
+};
@@ -0,0 +1,219 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTPythonRunner.h"
+#include "IPythonScriptPlugin.h"
+#include "Misc/Base64.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace UnrealGPTPythonRunnerPrivate
+{
+	static FString MakeErrorJson(const FString& Message)
+	{
+		TSharedPtr<FJsonObject> ErrorObj = MakeShareable(new FJsonObject);
+		ErrorObj->SetStringField(TEXT("status"), TEXT("error"));
+		ErrorObj->SetStringField(TEXT("message"), Message);
+
+		FString Out;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
+		FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+		return Out;
+	}
+
+	static FUnrealGPTPythonRunner::FSessionStats SessionStats;
+
+	/** Counts UObjects created and modified between construction and destruction. */
+	class FObjectAccounting : public FUObjectArray::FUObjectCreateListener
+	{
+	public:
+		FObjectAccounting()
+		{
+			GUObjectArray.AddUObjectCreateListener(this);
+			ModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FObjectAccounting::HandleObjectModified);
+		}
+
+		~FObjectAccounting()
+		{
+			Stop();
+		}
+
+		void Stop()
+		{
+			if (bListening)
+			{
+				GUObjectArray.RemoveUObjectCreateListener(this);
+				FCoreUObjectDelegates::OnObjectModified.Remove(ModifiedHandle);
+				bListening = false;
+			}
+		}
+
+		virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override
+		{
+			// Snippets run on the game thread; objects created concurrently by async loading are not theirs.
+			if (!IsInGameThread())
+			{
+				return;
+			}
+			++NumCreated;
+			if (const UClass* Class = Object ? Object->GetClass() : nullptr)
+			{
+				++CreatedByClass.FindOrAdd(Class->GetFName());
+			}
+		}
+
+		virtual void OnUObjectArrayShutdown() override
+		{
+			bListening = false;
+		}
+
+		void WriteTo(const TSharedPtr<FJsonObject>& Accounting) const
+		{
+			Accounting->SetNumberField(TEXT("objects_created"), NumCreated);
+			if (CreatedByClass.Num() > 0)
+			{
+				TArray<TPair<FName, int32>> Classes = CreatedByClass.Array();
+				Classes.Sort([](const TPair<FName, int32>& A, const TPair<FName, int32>& B) { return A.Value > B.Value; });
+
+				TSharedPtr<FJsonObject> ClassesJson = MakeShareable(new FJsonObject);
+				for (int32 Index = 0; Index < FMath::Min(Classes.Num(), FUnrealGPTPythonRunner::MaxCreatedClassSamples); ++Index)
+				{
+					ClassesJson->SetNumberField(Classes[Index].Key.ToString(), Classes[Index].Value);
+				}
+				Accounting->SetObjectField(TEXT("created_by_class"), ClassesJson);
+			}
+
+			Accounting->SetNumberField(TEXT("objects_modified"), Modified.Num());
+			if (ModifiedSamples.Num() > 0)
+			{
+				TArray<TSharedPtr<FJsonValue>> SamplesJson;
+				for (const FString& Sample : ModifiedSamples)
+				{
+					SamplesJson.Add(MakeShareable(new FJsonValueString(Sample)));
+				}
+				Accounting->SetArrayField(TEXT("modified_objects"), SamplesJson);
+			}
+		}
+
+		int32 NumCreated = 0;
+		TSet<FObjectKey> Modified;
+
+	private:
+		void HandleObjectModified(UObject* Object)
+		{
+			bool bAlreadyModified = false;
+			Modified.Add(FObjectKey(Object), &bAlreadyModified);
+			if (!bAlreadyModified && ModifiedSamples.Num() < FUnrealGPTPythonRunner::MaxModifiedObjectSamples
+				&& Object && !Object->HasAnyFlags(RF_Transient) && !Object->GetOutermost()->HasAnyFlags(RF_Transient))
+			{
+				ModifiedSamples.Add(Object->GetPathName());
+			}
+		}
+
+		TMap<FName, int32> CreatedByClass;
+		TArray<FString> ModifiedSamples;
+		FDelegateHandle ModifiedHandle;
+		bool bListening = true;
+	};
+
+	static bool EvaluateStatement(const FString& Statement, FString& OutResult)
+	{
+		FPythonCommandEx Command;
+		Command.Command = Statement;
+		Command.ExecutionMode = EPythonCommandExecutionMode::EvaluateStatement;
+		Command.FileExecutionScope = EPythonFileExecutionScope::Public;
+		Command.Flags |= EPythonCommandFlags::Unattended;
+
+		const bool bSuccess = IPythonScriptPlugin::Get()->ExecPythonCommandEx(Command);
+		OutResult = MoveTemp(Command.CommandResult);
+		return bSuccess;
+	}
+}
+
+FString FUnrealGPTPythonRunner::Execute(const FString& Code, const FOptions& Options)
+{
+	using namespace UnrealGPTPythonRunnerPrivate;
+
+	if (!IPythonScriptPlugin::Get() || !IPythonScriptPlugin::Get()->IsPythonAvailable())
+	{
+		return MakeErrorJson(TEXT("Python is not available in this Unreal Engine installation"));
+	}
+
+	// Base64 keeps arbitrary source (quotes, backslashes, non-ASCII) out of the statement's string literal.
+	const FTCHARToUTF8 CodeUtf8(*Code);
+	const FString Encoded = FBase64::Encode(reinterpret_cast<const uint8*>(CodeUtf8.Get()), CodeUtf8.Length());
+
+	const FString Statement = FString::Printf(
+		TEXT("__import__('unrealgpt_exec').run_b64('%s', %s, %d, %s)"),
+		*Encoded,
+		Options.bProfile ? TEXT("True") : TEXT("False"),
+		FMath::Max(1, Options.ProfileTopN),
+		Options.bCountUnrealCalls ? TEXT("True") : TEXT("False"));
+
+	FString ResultJson;
+	FObjectAccounting ObjectAccounting;
+	const double StartSeconds = FPlatformTime::Seconds();
+	const bool bRan = EvaluateStatement(Statement, ResultJson);
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+	ObjectAccounting.Stop();
+
+	if (!bRan)
+	{
+		// Only reached when the runner itself fails (e.g. unrealgpt_exec is not on sys.path); snippet errors are caught in Python.
+		return MakeErrorJson(FString::Printf(TEXT("Python runner failed: %s"), *ResultJson.TrimStartAndEnd()));
+	}
+
+	TSharedPtr<FJsonObject> ResultObj;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResultJson);
+	if (!FJsonSerializer::Deserialize(Reader, ResultObj) || !ResultObj.IsValid())
+	{
+		return ResultJson;
+	}
+
+	const TSharedPtr<FJsonObject>* AccountingPtr = nullptr;
+	const TSharedPtr<FJsonObject> Accounting = ResultObj->TryGetObjectField(TEXT("accounting"), AccountingPtr) ? *AccountingPtr : MakeShareable(new FJsonObject);
+	ObjectAccounting.WriteTo(Accounting);
+	ResultObj->SetObjectField(TEXT("accounting"), Accounting);
+
+	double ApiCalls = 0.0;
+	Accounting->TryGetNumberField(TEXT("unreal_api_calls"), ApiCalls);
+	const bool bFlagged = Accounting->HasField(TEXT("warnings"));
+	FString Status;
+	ResultObj->TryGetStringField(TEXT("status"), Status);
+
+	SessionStats.NumRuns++;
+	SessionStats.NumFailedRuns += Status == TEXT("ok") ? 0 : 1;
+	SessionStats.NumFlaggedRuns += bFlagged ? 1 : 0;
+	SessionStats.TotalSeconds += ElapsedSeconds;
+	SessionStats.SlowestSeconds = FMath::Max(SessionStats.SlowestSeconds, ElapsedSeconds);
+	SessionStats.TotalApiCalls += static_cast<int64>(ApiCalls);
+	SessionStats.TotalObjectsCreated += ObjectAccounting.NumCreated;
+	SessionStats.TotalObjectsModified += ObjectAccounting.Modified.Num();
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: python_execute %s in %.1f ms, %d unreal calls, %d objects created, %d modified%s (session: %d runs, %.1f s)"),
+		*Status, ElapsedSeconds * 1000.0, static_cast<int32>(ApiCalls), ObjectAccounting.NumCreated, ObjectAccounting.Modified.Num(),
+		bFlagged ? TEXT(", flagged") : TEXT(""), SessionStats.NumRuns, SessionStats.TotalSeconds);
+
+	FString Out;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
+	FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
+	return Out;
+}
+
+void FUnrealGPTPythonRunner::ResetNamespace()
+{
+	using namespace UnrealGPTPythonRunnerPrivate;
+
+	if (IPythonScriptPlugin::Get() && IPythonScriptPlugin::Get()->IsPythonAvailable())
+	{
+		FString Ignored;
+		EvaluateStatement(TEXT("__import__('unrealgpt_exec').reset()"), Ignored);
+	}
+}
+
+const FUnrealGPTPythonRunner::FSessionStats& FUnrealGPTPythonRunner::GetSessionStats()
+{
+	return UnrealGPTPythonRunnerPrivate::SessionStats;
+}
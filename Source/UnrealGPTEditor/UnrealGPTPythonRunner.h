@@ -0,0 +1,49 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * python_execute backend. Snippets run in the persistent namespace of Content/Python/unrealgpt_exec.py,
+ * so imports and variables carry over between calls. The result envelope comes back as the value of an
+ * evaluated statement instead of a file, with captured stdout/stderr and elapsed_ms added.
+ * Each run also reports an "accounting" object: pattern warnings from Python (and unreal.* call counts
+ * when requested), plus the UObjects created on the game thread and modified while the snippet ran.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTPythonRunner
+{
+public:
+	static constexpr int32 MaxModifiedObjectSamples = 10;
+	static constexpr int32 MaxCreatedClassSamples = 5;
+
+	struct FOptions
+	{
+		/** Run under cProfile and return the hottest functions. */
+		bool bProfile = false;
+		int32 ProfileTopN = 15;
+		/** Count unreal.* calls through a sys.setprofile hook; implied by bProfile. */
+		bool bCountUnrealCalls = false;
+	};
+
+	/** Totals across every run in this editor session. */
+	struct FSessionStats
+	{
+		int32 NumRuns = 0;
+		int32 NumFailedRuns = 0;
+		int32 NumFlaggedRuns = 0;
+		double TotalSeconds = 0.0;
+		double SlowestSeconds = 0.0;
+		int64 TotalApiCalls = 0;
+		int64 TotalObjectsCreated = 0;
+		int64 TotalObjectsModified = 0;
+	};
+
+	/** Run Code and return the JSON result envelope. Game thread only. */
+	static FString Execute(const FString& Code, const FOptions& Options = FOptions());
+
+	/** Forget names defined by earlier snippets. Game thread only. */
+	static void ResetNamespace();
+
+	static const FSessionStats& GetSessionStats();
+};
@@ -0,0 +1,468 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTReflectionIndex.h"
+#include "UnrealGPTReflectionSearch.h"
+#include "UnrealGPTReflectionSnapshot.h"
+#include "Async/Async.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/GarbageCollection.h"
+#include "Editor.h"
+#include "HAL/FileManager.h"
+#include "Engine/Blueprint.h"
+#include "UObject/Class.h"
+#include "UObject/UObjectIterator.h"
+
+FUnrealGPTReflectionIndex& FUnrealGPTReflectionIndex::Get()
+{
+	static FUnrealGPTReflectionIndex Instance;
+	return Instance;
+}
+
+void FUnrealGPTReflectionIndex::Initialize()
+{
+	FScopeLock Lock(&IndexLock);
+	if (bRegistered)
+	{
+		return;
+	}
+
+	ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUnrealGPTReflectionIndex::HandleModulesChanged);
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FUnrealGPTReflectionIndex::HandleReloadComplete);
+	AssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddRaw(this, &FUnrealGPTReflectionIndex::HandleAssetLoaded);
+	// Capturing before every startup module has loaded would leave their classes out of the snapshot.
+	PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FUnrealGPTReflectionIndex::EnsureSnapshot);
+	bRegistered = true;
+
+	bSnapshotLoadPending = true;
+	Async(EAsyncExecution::ThreadPool, [this]()
+	{
+		TSharedPtr<FUnrealGPTReflectionSnapshot> Loaded = FUnrealGPTReflectionSnapshot::LoadFromFile(FUnrealGPTReflectionSnapshot::GetDefaultFilePath());
+		if (Loaded.IsValid() && !Loaded->IsCurrent())
+		{
+			UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Reflection snapshot is out of date; it will be recaptured in the background"));
+			Loaded.Reset();
+		}
+
+		FScopeLock Lock(&IndexLock);
+		bSnapshotLoadPending = false;
+		if (bRegistered && bPersistSnapshot && !Snapshot.IsValid())
+		{
+			Snapshot = Loaded;
+		}
+		if (bRegistered && !Snapshot.IsValid() && bSnapshotCaptureRequested)
+		{
+			StartSnapshotCapture();
+		}
+	});
+}
+
+void FUnrealGPTReflectionIndex::Shutdown()
+{
+	TFuture<void> PendingCapture;
+	{
+		FScopeLock Lock(&IndexLock);
+		++SnapshotCaptureId;
+		PendingCapture = MoveTemp(SnapshotCapture);
+	}
+	// Outside the lock, which the capture takes to publish its result.
+	if (PendingCapture.IsValid())
+	{
+		PendingCapture.Wait();
+	}
+
+	FScopeLock Lock(&IndexLock);
+	if (!bRegistered)
+	{
+		return;
+	}
+
+	FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FCoreUObjectDelegates::OnAssetLoaded.Remove(AssetLoadedHandle);
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	if (GEditor && BlueprintCompiledHandle.IsValid())
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	BlueprintCompiledHandle.Reset();
+
+	Entries.Empty();
+	EntriesByLowerName.Empty();
+	EntriesByTrigram.Empty();
+	SchemaCache.Empty();
+	Snapshot.Reset();
+	SearchIndex.Reset();
+	bDirty = true;
+	bRegistered = false;
+}
+
+void FUnrealGPTReflectionIndex::Invalidate()
+{
+	FScopeLock Lock(&IndexLock);
+	bDirty = true;
+	SchemaCache.Reset();
+}
+
+void FUnrealGPTReflectionIndex::HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	if (Reason == EModuleChangeReason::ModuleLoaded || Reason == EModuleChangeReason::ModuleUnloaded)
+	{
+		Invalidate();
+	}
+}
+
+void FUnrealGPTReflectionIndex::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+	Invalidate();
+
+	// Reloaded classes no longer match the snapshot or the module binaries on disk.
+	FScopeLock Lock(&IndexLock);
+	Snapshot.Reset();
+	SearchIndex.Reset();
+	bPersistSnapshot = false;
+	++SnapshotCaptureId;
+	IFileManager::Get().Delete(*FUnrealGPTReflectionSnapshot::GetDefaultFilePath(), false, false, true);
+	IFileManager::Get().Delete(*FUnrealGPTReflectionSearchIndex::GetDefaultFilePath(), false, false, true);
+}
+
+void FUnrealGPTReflectionIndex::HandleAssetLoaded(UObject* Asset)
+{
+	// Loading a Blueprint adds a generated class but does not change existing classes or schemas,
+	// so only that class is queued; opening many assets costs one patch at the next lookup.
+	const UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
+	if (Blueprint && Blueprint->GeneratedClass)
+	{
+		FScopeLock Lock(&IndexLock);
+		if (!bDirty)
+		{
+			PendingClasses.AddUnique(Blueprint->GeneratedClass.Get());
+		}
+	}
+}
+
+void FUnrealGPTReflectionIndex::HandleBlueprintCompiled()
+{
+	Invalidate();
+}
+
+void FUnrealGPTReflectionIndex::GatherTrigrams(const FString& LowerText, TArray<uint64>& OutTrigrams)
+{
+	OutTrigrams.Reset();
+	for (int32 Index = 0; Index + 2 < LowerText.Len(); ++Index)
+	{
+		const uint64 Trigram = (static_cast<uint64>(static_cast<uint16>(LowerText[Index])) << 32)
+			| (static_cast<uint64>(static_cast<uint16>(LowerText[Index + 1])) << 16)
+			| static_cast<uint64>(static_cast<uint16>(LowerText[Index + 2]));
+		OutTrigrams.AddUnique(Trigram);
+	}
+}
+
+void FUnrealGPTReflectionIndex::EnsureBuilt()
+{
+	// Called with IndexLock held.
+	if (GEditor && !BlueprintCompiledHandle.IsValid())
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FUnrealGPTReflectionIndex::HandleBlueprintCompiled);
+	}
+
+	if (bDirty)
+	{
+		Rebuild();
+		bDirty = false;
+		return;
+	}
+
+	if (PendingClasses.Num() > 0)
+	{
+		TArray<uint64> Trigrams;
+		for (const TWeakObjectPtr<UClass>& Pending : PendingClasses)
+		{
+			UClass* Class = Pending.Get();
+			if (!Class || Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+			{
+				continue;
+			}
+
+			const FString LowerName = Class->GetName().ToLower();
+			const TArray<int32>* Existing = EntriesByLowerName.Find(LowerName);
+			const bool bIndexed = Existing && Existing->ContainsByPredicate([this, Class](int32 EntryIndex)
+			{
+				return Entries[EntryIndex].Class.Get() == Class;
+			});
+			if (!bIndexed)
+			{
+				AddEntry(Class, Trigrams);
+			}
+		}
+		PendingClasses.Reset();
+	}
+}
+
+void FUnrealGPTReflectionIndex::Rebuild()
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	Entries.Reset();
+	EntriesByLowerName.Reset();
+	EntriesByTrigram.Reset();
+	PendingClasses.Reset();
+
+	TArray<uint64> Trigrams;
+	for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		UClass* Class = *ClassIt;
+		if (!Class || Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		AddEntry(Class, Trigrams);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Built reflection index with %d classes in %.1f ms"),
+		Entries.Num(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+}
+
+void FUnrealGPTReflectionIndex::AddEntry(UClass* Class, TArray<uint64>& Trigrams)
+{
+	const int32 EntryIndex = Entries.AddDefaulted();
+	FClassEntry& Entry = Entries[EntryIndex];
+	Entry.Class = Class;
+	Entry.LowerName = Class->GetName().ToLower();
+	Entry.PathName = Class->GetPathName();
+
+	EntriesByLowerName.FindOrAdd(Entry.LowerName).Add(EntryIndex);
+
+	GatherTrigrams(Entry.LowerName, Trigrams);
+	for (const uint64 Trigram : Trigrams)
+	{
+		EntriesByTrigram.FindOrAdd(Trigram).Add(EntryIndex);
+	}
+}
+
+void FUnrealGPTReflectionIndex::FindExactMatches(const FString& ClassName, TArray<UClass*>& OutMatches)
+{
+	FScopeLock Lock(&IndexLock);
+	EnsureBuilt();
+
+	const TArray<int32>* EntryIndices = EntriesByLowerName.Find(ClassName.ToLower());
+	if (!EntryIndices)
+	{
+		return;
+	}
+
+	for (const int32 EntryIndex : *EntryIndices)
+	{
+		UClass* Class = Entries[EntryIndex].Class.Get();
+		if (Class && !Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			OutMatches.AddUnique(Class);
+		}
+	}
+}
+
+void FUnrealGPTReflectionIndex::FindCandidates(const FString& ClassName, TArray<FString>& OutCandidates, int32 MaxCandidates)
+{
+	FScopeLock Lock(&IndexLock);
+	EnsureBuilt();
+
+	const FString LowerQuery = ClassName.ToLower();
+
+	struct FScoredEntry
+	{
+		int32 EntryIndex = INDEX_NONE;
+		int32 Score = 0;
+		bool bContainsQuery = false;
+	};
+	TArray<FScoredEntry> Scored;
+
+	TArray<uint64> QueryTrigrams;
+	GatherTrigrams(LowerQuery, QueryTrigrams);
+
+	if (QueryTrigrams.Num() == 0)
+	{
+		// Too short for trigrams; a substring scan over the cached names is still cheap.
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+		{
+			if (Entries[EntryIndex].LowerName.Contains(LowerQuery, ESearchCase::CaseSensitive))
+			{
+				Scored.Add({ EntryIndex, 0, true });
+			}
+		}
+	}
+	else
+	{
+		TMap<int32, int32> ScoreByEntry;
+		for (const uint64 Trigram : QueryTrigrams)
+		{
+			if (const TArray<int32>* Posting = EntriesByTrigram.Find(Trigram))
+			{
+				for (const int32 EntryIndex : *Posting)
+				{
+					++ScoreByEntry.FindOrAdd(EntryIndex);
+				}
+			}
+		}
+
+		// Require at least half the query trigrams unless the name contains the query outright.
+		const int32 MinScore = FMath::Max(1, (QueryTrigrams.Num() + 1) / 2);
+		for (const TPair<int32, int32>& Pair : ScoreByEntry)
+		{
+			const bool bContains = Entries[Pair.Key].LowerName.Contains(LowerQuery, ESearchCase::CaseSensitive);
+			if (bContains || Pair.Value >= MinScore)
+			{
+				Scored.Add({ Pair.Key, Pair.Value, bContains });
+			}
+		}
+	}
+
+	Scored.Sort([this](const FScoredEntry& A, const FScoredEntry& B)
+	{
+		if (A.bContainsQuery != B.bContainsQuery)
+		{
+			return A.bContainsQuery;
+		}
+		if (A.Score != B.Score)
+		{
+			return A.Score > B.Score;
+		}
+		return Entries[A.EntryIndex].LowerName.Len() < Entries[B.EntryIndex].LowerName.Len();
+	});
+
+	for (const FScoredEntry& Entry : Scored)
+	{
+		if (!Entries[Entry.EntryIndex].Class.IsValid())
+		{
+			continue;
+		}
+
+		OutCandidates.AddUnique(Entries[Entry.EntryIndex].PathName);
+		if (OutCandidates.Num() >= MaxCandidates)
+		{
+			break;
+		}
+	}
+}
+
+bool FUnrealGPTReflectionIndex::FindCachedSchema(const FString& Key, FString& OutJson) const
+{
+	FScopeLock Lock(&IndexLock);
+	if (const FString* Cached = SchemaCache.Find(Key))
+	{
+		OutJson = *Cached;
+		return true;
+	}
+	return false;
+}
+
+void FUnrealGPTReflectionIndex::CacheSchema(const FString& Key, const FString& Json)
+{
+	FScopeLock Lock(&IndexLock);
+	if (SchemaCache.Num() >= MaxCachedSchemas)
+	{
+		SchemaCache.Reset();
+	}
+	SchemaCache.Add(Key, Json);
+}
+
+TSharedPtr<const FUnrealGPTReflectionSnapshot> FUnrealGPTReflectionIndex::GetSnapshot() const
+{
+	FScopeLock Lock(&IndexLock);
+	return Snapshot;
+}
+
+void FUnrealGPTReflectionIndex::EnsureSnapshot()
+{
+	FScopeLock Lock(&IndexLock);
+	if (!bRegistered || Snapshot.IsValid())
+	{
+		return;
+	}
+
+	if (bSnapshotLoadPending)
+	{
+		bSnapshotCaptureRequested = true;
+		return;
+	}
+
+	StartSnapshotCapture();
+}
+
+void FUnrealGPTReflectionIndex::StartSnapshotCapture()
+{
+	// Called with IndexLock held.
+	if (SnapshotCapture.IsValid() && !SnapshotCapture.IsReady())
+	{
+		return;
+	}
+
+	bSnapshotCaptureRequested = false;
+	const uint32 CaptureId = ++SnapshotCaptureId;
+	const bool bPersist = bPersistSnapshot;
+	SnapshotCapture = Async(EAsyncExecution::ThreadPool, [this, CaptureId, bPersist]()
+	{
+		TSharedPtr<FUnrealGPTReflectionSnapshot> Captured;
+		{
+			// Native classes are never collected, but the object array must not change under the iterator.
+			FGCScopeGuard GCGuard;
+			Captured = FUnrealGPTReflectionSnapshot::CaptureNativeClasses();
+		}
+
+		{
+			FScopeLock Lock(&IndexLock);
+			if (!bRegistered || CaptureId != SnapshotCaptureId || Snapshot.IsValid())
+			{
+				return;
+			}
+			Snapshot = Captured;
+			SearchIndex.Reset();
+		}
+
+		if (bPersist && !Captured->SaveToFile(FUnrealGPTReflectionSnapshot::GetDefaultFilePath()))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: Failed to write reflection snapshot"));
+		}
+	});
+}
+
+TSharedPtr<const FUnrealGPTReflectionSearchIndex> FUnrealGPTReflectionIndex::GetSearchIndex()
+{
+	TSharedPtr<FUnrealGPTReflectionSnapshot> CurrentSnapshot;
+	bool bPersist = false;
+	{
+		FScopeLock Lock(&IndexLock);
+		if (SearchIndex.IsValid() || !Snapshot.IsValid())
+		{
+			return SearchIndex;
+		}
+		CurrentSnapshot = Snapshot;
+		bPersist = bPersistSnapshot;
+	}
+
+	// Built outside the lock so snapshot lookups are not blocked meanwhile.
+	const FString SearchIndexPath = FUnrealGPTReflectionSearchIndex::GetDefaultFilePath();
+	TSharedPtr<FUnrealGPTReflectionSearchIndex> NewIndex = FUnrealGPTReflectionSearchIndex::LoadFromFile(SearchIndexPath, CurrentSnapshot.ToSharedRef());
+	if (!NewIndex.IsValid())
+	{
+		TSharedRef<FUnrealGPTReflectionSearchIndex> BuiltIndex = FUnrealGPTReflectionSearchIndex::Build(CurrentSnapshot.ToSharedRef());
+		NewIndex = BuiltIndex;
+
+		if (bPersist)
+		{
+			Async(EAsyncExecution::ThreadPool, [BuiltIndex, SearchIndexPath]()
+			{
+				if (!BuiltIndex->SaveToFile(SearchIndexPath))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: Failed to write reflection search index"));
+				}
+			});
+		}
+	}
+
+	FScopeLock Lock(&IndexLock);
+	if (Snapshot == CurrentSnapshot && !SearchIndex.IsValid())
+	{
+		SearchIndex = NewIndex;
+	}
+	return NewIndex;
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Async/Future.h"
+
+class FUnrealGPTReflectionSearchIndex;
+class FUnrealGPTReflectionSnapshot;
+
+/**
+ * Name and trigram lookup tables over loaded UClasses for reflection_query,
+ * plus a cache of serialized schemas keyed by (class, options).
+ * Built lazily on first lookup and marked stale on module loads, hot reload / Live Coding and
+ * Blueprint compiles. A loaded Blueprint only queues its generated class, which is added on the next lookup.
+ * Also owns the persisted native-class snapshot, which is loaded on a worker thread at startup and,
+ * when missing or out of date, captured on a worker thread once the engine has initialized.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTReflectionIndex
+{
+public:
+	static constexpr int32 MaxCachedSchemas = 256;
+
+	static FUnrealGPTReflectionIndex& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** Classes whose name equals ClassName, case-insensitive. */
+	void FindExactMatches(const FString& ClassName, TArray<UClass*>& OutMatches);
+
+	/** Path names of classes whose name resembles ClassName, best match first. */
+	void FindCandidates(const FString& ClassName, TArray<FString>& OutCandidates, int32 MaxCandidates = 8);
+
+	bool FindCachedSchema(const FString& Key, FString& OutJson) const;
+	void CacheSchema(const FString& Key, const FString& Json);
+
+	/** Mark the class tables stale and drop cached schemas. */
+	void Invalidate();
+
+	/** Current reflection snapshot, or null while it is loading or after it was discarded. Any thread. */
+	TSharedPtr<const FUnrealGPTReflectionSnapshot> GetSnapshot() const;
+
+	/** Start capturing the snapshot in the background if none is loaded, loading or being captured. Any thread. */
+	void EnsureSnapshot();
+
+	/**
+	 * Search index over the current snapshot, loaded from disk or built on first use.
+	 * Null while no snapshot is available. Any thread.
+	 */
+	TSharedPtr<const FUnrealGPTReflectionSearchIndex> GetSearchIndex();
+
+private:
+	FUnrealGPTReflectionIndex() = default;
+
+	struct FClassEntry
+	{
+		TWeakObjectPtr<UClass> Class;
+		FString LowerName;
+		FString PathName;
+	};
+
+	void EnsureBuilt();
+	void Rebuild();
+	void AddEntry(UClass* Class, TArray<uint64>& Trigrams);
+	/** Called with IndexLock held. */
+	void StartSnapshotCapture();
+	static void GatherTrigrams(const FString& LowerText, TArray<uint64>& OutTrigrams);
+
+	void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+	void HandleReloadComplete(EReloadCompleteReason Reason);
+	void HandleAssetLoaded(UObject* Asset);
+	void HandleBlueprintCompiled();
+
+	mutable FCriticalSection IndexLock;
+	TArray<FClassEntry> Entries;
+	TMap<FString, TArray<int32>> EntriesByLowerName;
+	TMap<uint64, TArray<int32>> EntriesByTrigram;
+	/** Generated classes of Blueprints loaded since the last lookup. */
+	TArray<TWeakObjectPtr<UClass>> PendingClasses;
+	TMap<FString, FString> SchemaCache;
+	TSharedPtr<FUnrealGPTReflectionSnapshot> Snapshot;
+	TSharedPtr<FUnrealGPTReflectionSearchIndex> SearchIndex;
+	bool bDirty = true;
+	bool bRegistered = false;
+	bool bSnapshotLoadPending = false;
+	/** EnsureSnapshot ran while the load was pending; capture if the load finds nothing usable. */
+	bool bSnapshotCaptureRequested = false;
+	/** Bumped when loaded classes change, so a capture started before that is discarded. */
+	uint32 SnapshotCaptureId = 0;
+	TFuture<void> SnapshotCapture;
+	/** Cleared after hot reload / Live Coding; patched classes are not written back to disk. */
+	bool bPersistSnapshot = true;
+
+	FDelegateHandle ModulesChangedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle AssetLoadedHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle PostEngineInitHandle;
+};
@@ -1,13 +1,13 @@
 // Copyright (c) 2025 TREE Industries.
 
 #include "UnrealGPTReflectionQuery.h"
+#include "UnrealGPTReflectionIndex.h"
+#include "UnrealGPTReflectionSnapshot.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "UObject/Class.h"
-#include "UObject/UnrealType.h"
 #include "UObject/UObjectGlobals.h"
-#include "UObject/UObjectIterator.h"
 
 namespace UnrealGPTReflectionQueryPrivate
 {
@@ -56,123 +56,63 @@ namespace UnrealGPTReflectionQueryPrivate
 			|| MemberName.Contains(MemberContains, ESearchCase::IgnoreCase);
 	}
 
-	static bool IsScriptableProperty(const FProperty* Property, bool bIncludeDeprecated)
+	static void AppendPropertyFlags(const FUnrealGPTReflectedProperty& Property, TArray<FString>& Flags)
 	{
-		if (!Property)
-		{
-			return false;
-		}
-
-		if (!bIncludeDeprecated && Property->HasAnyPropertyFlags(CPF_Deprecated))
-		{
-			return false;
-		}
-
-		if (Property->HasAnyPropertyFlags(CPF_DuplicateTransient))
-		{
-			return false;
-		}
-
-		return Property->HasAnyPropertyFlags(
-			CPF_Edit | CPF_BlueprintVisible | CPF_BlueprintReadOnly | CPF_BlueprintAssignable);
-	}
-
-	static bool IsScriptableFunction(const UFunction* Function, bool bIncludeDeprecated)
-	{
-		if (!Function)
-		{
-			return false;
-		}
-
-		if (!bIncludeDeprecated && Function->HasMetaData(TEXT("DeprecatedFunction")))
-		{
-			return false;
-		}
-
-		if (Function->HasAnyFunctionFlags(FUNC_Delegate | FUNC_Private | FUNC_Protected))
-		{
-			return false;
-		}
-
-		return Function->HasAnyFunctionFlags(
-			FUNC_BlueprintCallable | FUNC_BlueprintPure | FUNC_BlueprintEvent | FUNC_BlueprintAuthorityOnly);
-	}
-
-	static FString GetClassCppType(UClass* Class)
-	{
-		if (!Class)
-		{
-			return FString();
-		}
-
-		const FString Prefix = Class->GetPrefixCPP();
-		const FString Name = Class->GetName();
-		return Prefix.IsEmpty() ? Name : Prefix + Name;
-	}
-
-	static void AppendPropertyFlags(const FProperty* Property, TArray<FString>& Flags)
-	{
-		if (Property->HasAnyPropertyFlags(CPF_Edit))
+		if (Property.Flags & EUnrealGPTReflectedPropertyFlags::Edit)
 		{
 			Flags.Add(TEXT("Edit"));
 		}
-		if (Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+		if (Property.Flags & EUnrealGPTReflectedPropertyFlags::BlueprintVisible)
 		{
 			Flags.Add(TEXT("BlueprintVisible"));
 		}
-		if (Property->HasAnyPropertyFlags(CPF_BlueprintReadOnly))
+		if (Property.Flags & EUnrealGPTReflectedPropertyFlags::BlueprintReadOnly)
 		{
 			Flags.Add(TEXT("BlueprintReadOnly"));
 		}
-		if (Property->HasAnyPropertyFlags(CPF_BlueprintAssignable))
+		if (Property.Flags & EUnrealGPTReflectedPropertyFlags::BlueprintAssignable)
 		{
 			Flags.Add(TEXT("BlueprintAssignable"));
 		}
-		if (Property->HasAnyPropertyFlags(CPF_Config))
+		if (Property.Flags & EUnrealGPTReflectedPropertyFlags::Config)
 		{
 			Flags.Add(TEXT("Config"));
 		}
 	}
 
-	static void AppendFunctionFlags(const UFunction* Function, TArray<FString>& Flags)
+	static void AppendFunctionFlags(const FUnrealGPTReflectedFunction& Function, TArray<FString>& Flags)
 	{
-		if (Function->HasAnyFunctionFlags(FUNC_BlueprintCallable))
+		if (Function.Flags & EUnrealGPTReflectedFunctionFlags::BlueprintCallable)
 		{
 			Flags.Add(TEXT("BlueprintCallable"));
 		}
-		if (Function->HasAnyFunctionFlags(FUNC_BlueprintPure))
+		if (Function.Flags & EUnrealGPTReflectedFunctionFlags::BlueprintPure)
 		{
 			Flags.Add(TEXT("BlueprintPure"));
 		}
-		if (Function->HasAnyFunctionFlags(FUNC_BlueprintEvent))
+		if (Function.Flags & EUnrealGPTReflectedFunctionFlags::BlueprintEvent)
 		{
 			Flags.Add(TEXT("BlueprintEvent"));
 		}
-		if (Function->HasAnyFunctionFlags(FUNC_Static))
+		if (Function.Flags & EUnrealGPTReflectedFunctionFlags::Static)
 		{
 			Flags.Add(TEXT("Static"));
 		}
-		if (Function->HasAnyFunctionFlags(FUNC_Net))
+		if (Function.Flags & EUnrealGPTReflectedFunctionFlags::Net)
 		{
 			Flags.Add(TEXT("Net"));
 		}
 	}
 
-	static TSharedPtr<FJsonObject> BuildPropertyJson(FProperty* Property, bool bIncludeDeclaredOn, UClass* OwnerClass)
+	static TSharedPtr<FJsonObject> BuildPropertyJson(const FUnrealGPTReflectedProperty& Property, bool bIncludeDeclaredOn, const FUnrealGPTReflectedClass& OwnerClass)
 	{
-		if (!Property)
-		{
-			return nullptr;
-		}
-
 		TSharedPtr<FJsonObject> PropJson = MakeShareable(new FJsonObject);
-		PropJson->SetStringField(TEXT("name"), Property->GetName());
-		PropJson->SetStringField(TEXT("cpp_type"), Property->GetCPPType(nullptr, 0));
+		PropJson->SetStringField(TEXT("name"), Property.Name);
+		PropJson->SetStringField(TEXT("cpp_type"), Property.CppType);
 
-		const FString UeType = Property->GetClass() ? Property->GetClass()->GetName() : TEXT("Unknown");
-		if (!UeType.Equals(TEXT("ObjectProperty")) && !UeType.Equals(TEXT("StructProperty")))
+		if (!Property.UeType.IsEmpty())
 		{
-			PropJson->SetStringField(TEXT("ue_type"), UeType);
+			PropJson->SetStringField(TEXT("ue_type"), Property.UeType);
 		}
 
 		TArray<FString> Flags;
@@ -187,23 +127,18 @@ namespace UnrealGPTReflectionQueryPrivate
 			PropJson->SetArrayField(TEXT("flags"), FlagValues);
 		}
 
-		if (bIncludeDeclaredOn && OwnerClass)
+		if (bIncludeDeclaredOn)
 		{
-			PropJson->SetStringField(TEXT("declared_on"), OwnerClass->GetName());
+			PropJson->SetStringField(TEXT("declared_on"), OwnerClass.Name);
 		}
 
 		return PropJson;
 	}
 
-	static TSharedPtr<FJsonObject> BuildFunctionJson(UFunction* Function, bool bIncludeDeclaredOn, UClass* OwnerClass)
+	static TSharedPtr<FJsonObject> BuildFunctionJson(const FUnrealGPTReflectedFunction& Function, bool bIncludeDeclaredOn, const FUnrealGPTReflectedClass& OwnerClass)
 	{
-		if (!Function)
-		{
-			return nullptr;
-		}
-
 		TSharedPtr<FJsonObject> FuncJson = MakeShareable(new FJsonObject);
-		FuncJson->SetStringField(TEXT("name"), Function->GetName());
+		FuncJson->SetStringField(TEXT("name"), Function.Name);
 
 		TArray<FString> Flags;
 		AppendFunctionFlags(Function, Flags);
@@ -218,33 +153,12 @@ namespace UnrealGPTReflectionQueryPrivate
 		}
 
 		TArray<TSharedPtr<FJsonValue>> ParamsJson;
-		TSharedPtr<FJsonObject> ReturnJson;
-
-		for (TFieldIterator<FProperty> ParamIt(Function); ParamIt; ++ParamIt)
+		for (const FUnrealGPTReflectedParam& Param : Function.Params)
 		{
-			FProperty* ParamProp = *ParamIt;
-			if (!ParamProp)
-			{
-				continue;
-			}
-
-			if (ParamProp->HasAnyPropertyFlags(CPF_ReturnParm))
-			{
-				ReturnJson = MakeShareable(new FJsonObject);
-				ReturnJson->SetStringField(TEXT("name"), ParamProp->GetName());
-				ReturnJson->SetStringField(TEXT("cpp_type"), ParamProp->GetCPPType(nullptr, 0));
-				continue;
-			}
-
-			if (!ParamProp->HasAnyPropertyFlags(CPF_Parm))
-			{
-				continue;
-			}
-
 			TSharedPtr<FJsonObject> ParamJson = MakeShareable(new FJsonObject);
-			ParamJson->SetStringField(TEXT("name"), ParamProp->GetName());
-			ParamJson->SetStringField(TEXT("cpp_type"), ParamProp->GetCPPType(nullptr, 0));
-			if (ParamProp->HasAnyPropertyFlags(CPF_OutParm | CPF_ReferenceParm))
+			ParamJson->SetStringField(TEXT("name"), Param.Name);
+			ParamJson->SetStringField(TEXT("cpp_type"), Param.CppType);
+			if (Param.bIsOut)
 			{
 				ParamJson->SetBoolField(TEXT("is_out"), true);
 			}
@@ -256,14 +170,17 @@ namespace UnrealGPTReflectionQueryPrivate
 		{
 			FuncJson->SetArrayField(TEXT("parameters"), ParamsJson);
 		}
-		if (ReturnJson.IsValid())
+		if (Function.bHasReturn)
 		{
+			TSharedPtr<FJsonObject> ReturnJson = MakeShareable(new FJsonObject);
+			ReturnJson->SetStringField(TEXT("name"), Function.Return.Name);
+			ReturnJson->SetStringField(TEXT("cpp_type"), Function.Return.CppType);
 			FuncJson->SetObjectField(TEXT("return"), ReturnJson);
 		}
 
-		if (bIncludeDeclaredOn && OwnerClass)
+		if (bIncludeDeclaredOn)
 		{
-			FuncJson->SetStringField(TEXT("declared_on"), OwnerClass->GetName());
+			FuncJson->SetStringField(TEXT("declared_on"), OwnerClass.Name);
 		}
 
 		return FuncJson;
@@ -291,73 +208,41 @@ namespace UnrealGPTReflectionQueryPrivate
 
 	static void CollectExactNameMatches(const FString& ClassName, TArray<UClass*>& OutMatches)
 	{
-		for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
-		{
-			UClass* Candidate = *ClassIt;
-			if (!Candidate || Candidate->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
-			{
-				continue;
-			}
-
-			if (Candidate->GetName().Equals(ClassName, ESearchCase::IgnoreCase))
-			{
-				OutMatches.AddUnique(Candidate);
-			}
-		}
+		FUnrealGPTReflectionIndex::Get().FindExactMatches(ClassName, OutMatches);
 	}
 
-	static bool ParseOptions(const FString& ArgumentsJson, FOptions& OutOptions, FString& OutError)
+	static bool ParseArguments(const FString& ArgumentsJson, TSharedPtr<FJsonObject>& OutArgs, FString& OutError)
 	{
-		TSharedPtr<FJsonObject> ArgsObj;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
-		if (!(FJsonSerializer::Deserialize(Reader, ArgsObj) && ArgsObj.IsValid()))
+		if (!(FJsonSerializer::Deserialize(Reader, OutArgs) && OutArgs.IsValid()))
 		{
 			OutError = TEXT("Failed to parse reflection_query arguments");
 			return false;
 		}
+		return true;
+	}
 
-		if (!ArgsObj->TryGetStringField(TEXT("class_name"), OutOptions.ClassName) || OutOptions.ClassName.IsEmpty())
-		{
-			OutError = TEXT("Missing required field: class_name");
-			return false;
-		}
-
-		ArgsObj->TryGetStringField(TEXT("member_contains"), OutOptions.MemberContains);
-		ArgsObj->TryGetBoolField(TEXT("include_super"), OutOptions.bIncludeSuper);
-		ArgsObj->TryGetBoolField(TEXT("include_properties"), OutOptions.bIncludeProperties);
-		ArgsObj->TryGetBoolField(TEXT("include_functions"), OutOptions.bIncludeFunctions);
-		ArgsObj->TryGetBoolField(TEXT("scriptable_only"), OutOptions.bScriptableOnly);
-		ArgsObj->TryGetBoolField(TEXT("include_deprecated"), OutOptions.bIncludeDeprecated);
+	/** Read the filter fields present on ArgsObj; absent fields keep their current value. */
+	static void ReadOptionFields(const FJsonObject& ArgsObj, FOptions& InOutOptions)
+	{
+		ArgsObj.TryGetStringField(TEXT("class_name"), InOutOptions.ClassName);
+		ArgsObj.TryGetStringField(TEXT("member_contains"), InOutOptions.MemberContains);
+		ArgsObj.TryGetBoolField(TEXT("include_super"), InOutOptions.bIncludeSuper);
+		ArgsObj.TryGetBoolField(TEXT("include_properties"), InOutOptions.bIncludeProperties);
+		ArgsObj.TryGetBoolField(TEXT("include_functions"), InOutOptions.bIncludeFunctions);
+		ArgsObj.TryGetBoolField(TEXT("scriptable_only"), InOutOptions.bScriptableOnly);
+		ArgsObj.TryGetBoolField(TEXT("include_deprecated"), InOutOptions.bIncludeDeprecated);
 
-		double MaxResultsValue = OutOptions.MaxResults;
-		if (ArgsObj->TryGetNumberField(TEXT("max_results"), MaxResultsValue))
+		double MaxResultsValue = InOutOptions.MaxResults;
+		if (ArgsObj.TryGetNumberField(TEXT("max_results"), MaxResultsValue))
 		{
-			OutOptions.MaxResults = FMath::Clamp(static_cast<int32>(MaxResultsValue), 1, 200);
+			InOutOptions.MaxResults = FMath::Clamp(static_cast<int32>(MaxResultsValue), 1, 200);
 		}
-
-		return true;
 	}
 
 	static void CollectNameCandidates(const FString& ClassName, TArray<FString>& OutCandidates, int32 MaxCandidates = 8)
 	{
-		for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
-		{
-			UClass* Candidate = *ClassIt;
-			if (!Candidate || Candidate->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
-			{
-				continue;
-			}
-
-			const FString CandidateName = Candidate->GetName();
-			if (CandidateName.Contains(ClassName, ESearchCase::IgnoreCase))
-			{
-				OutCandidates.AddUnique(Candidate->GetPathName());
-				if (OutCandidates.Num() >= MaxCandidates)
-				{
-					break;
-				}
-			}
-		}
+		FUnrealGPTReflectionIndex::Get().FindCandidates(ClassName, OutCandidates, MaxCandidates);
 	}
 
 	static UClass* ResolveClass(const FString& ClassName, TArray<FString>& OutAmbiguousCandidates)
@@ -427,114 +312,146 @@ namespace UnrealGPTReflectionQueryPrivate
 		return nullptr;
 	}
 
+	/** Target class first, followed by its super classes. */
+	using FClassChain = TArray<const FUnrealGPTReflectedClass*>;
+
+	/** Inherited members already written for an earlier class of a batch query. */
+	struct FSharedInherited
+	{
+		TSet<const void*> EmittedMembers;
+		int32 OmittedCount = 0;
+	};
+
 	static void GatherClassMembers(
 		const FOptions& Options,
-		UClass* TargetClass,
-		EFieldIteratorFlags::SuperClassFlags IteratorFlags,
+		const FClassChain& Chain,
 		TArray<TSharedPtr<FJsonValue>>& OutProperties,
 		TArray<TSharedPtr<FJsonValue>>& OutFunctions,
 		int32& OutMatchedPropertyCount,
 		int32& OutMatchedFunctionCount,
 		bool& bOutPropertiesTruncated,
-		bool& bOutFunctionsTruncated)
+		bool& bOutFunctionsTruncated,
+		FSharedInherited* SharedInherited = nullptr)
 	{
 		OutMatchedPropertyCount = 0;
 		OutMatchedFunctionCount = 0;
 		bOutPropertiesTruncated = false;
 		bOutFunctionsTruncated = false;
 
+		const int32 ChainLength = Options.bIncludeSuper ? Chain.Num() : FMath::Min(1, Chain.Num());
+
 		if (Options.bIncludeProperties)
 		{
-			for (TFieldIterator<FProperty> PropIt(TargetClass, IteratorFlags); PropIt; ++PropIt)
+			for (int32 ChainIndex = 0; ChainIndex < ChainLength; ++ChainIndex)
 			{
-				FProperty* Property = *PropIt;
-				if (!Property)
-				{
-					continue;
-				}
-
-				if (!MatchesMemberFilter(Property->GetName(), Options.MemberContains))
-				{
-					continue;
-				}
-
-				if (Options.bScriptableOnly && !IsScriptableProperty(Property, Options.bIncludeDeprecated))
-				{
-					continue;
-				}
-
-				++OutMatchedPropertyCount;
-
-				if (OutProperties.Num() >= Options.MaxResults)
-				{
-					bOutPropertiesTruncated = true;
-					continue;
-				}
-
-				UClass* DeclaringClass = Property->GetOwnerClass();
-				TSharedPtr<FJsonObject> PropJson = BuildPropertyJson(Property, Options.bIncludeSuper, DeclaringClass);
-				if (PropJson.IsValid())
+				const FUnrealGPTReflectedClass& DeclaringClass = *Chain[ChainIndex];
+				for (const FUnrealGPTReflectedProperty& Property : DeclaringClass.Properties)
 				{
-					OutProperties.Add(MakeShareable(new FJsonValueObject(PropJson)));
+					if (!MatchesMemberFilter(Property.Name, Options.MemberContains))
+					{
+						continue;
+					}
+
+					if (Options.bScriptableOnly && !Property.IsScriptable(Options.bIncludeDeprecated))
+					{
+						continue;
+					}
+
+					if (SharedInherited && ChainIndex > 0 && SharedInherited->EmittedMembers.Contains(&Property))
+					{
+						++SharedInherited->OmittedCount;
+						continue;
+					}
+
+					++OutMatchedPropertyCount;
+
+					if (OutProperties.Num() >= Options.MaxResults)
+					{
+						bOutPropertiesTruncated = true;
+						continue;
+					}
+
+					OutProperties.Add(MakeShareable(new FJsonValueObject(BuildPropertyJson(Property, Options.bIncludeSuper, DeclaringClass))));
+					if (SharedInherited)
+					{
+						SharedInherited->EmittedMembers.Add(&Property);
+					}
 				}
 			}
 		}
 
 		if (Options.bIncludeFunctions)
 		{
-			for (TFieldIterator<UFunction> FuncIt(TargetClass, IteratorFlags); FuncIt; ++FuncIt)
+			for (int32 ChainIndex = 0; ChainIndex < ChainLength; ++ChainIndex)
 			{
-				UFunction* Function = *FuncIt;
-				if (!Function)
+				const FUnrealGPTReflectedClass& DeclaringClass = *Chain[ChainIndex];
+				for (const FUnrealGPTReflectedFunction& Function : DeclaringClass.Functions)
 				{
-					continue;
-				}
-
-				if (!MatchesMemberFilter(Function->GetName(), Options.MemberContains))
-				{
-					continue;
-				}
-
-				if (Options.bScriptableOnly && !IsScriptableFunction(Function, Options.bIncludeDeprecated))
-				{
-					continue;
-				}
-
-				++OutMatchedFunctionCount;
-
-				if (OutFunctions.Num() >= Options.MaxResults)
-				{
-					bOutFunctionsTruncated = true;
-					continue;
-				}
-
-				UClass* DeclaringClass = Function->GetOwnerClass();
-				TSharedPtr<FJsonObject> FuncJson = BuildFunctionJson(Function, Options.bIncludeSuper, DeclaringClass);
-				if (FuncJson.IsValid())
-				{
-					OutFunctions.Add(MakeShareable(new FJsonValueObject(FuncJson)));
+					if (!MatchesMemberFilter(Function.Name, Options.MemberContains))
+					{
+						continue;
+					}
+
+					if (Options.bScriptableOnly && !Function.IsScriptable(Options.bIncludeDeprecated))
+					{
+						continue;
+					}
+
+					if (SharedInherited && ChainIndex > 0 && SharedInherited->EmittedMembers.Contains(&Function))
+					{
+						++SharedInherited->OmittedCount;
+						continue;
+					}
+
+					++OutMatchedFunctionCount;
+
+					if (OutFunctions.Num() >= Options.MaxResults)
+					{
+						bOutFunctionsTruncated = true;
+						continue;
+					}
+
+					OutFunctions.Add(MakeShareable(new FJsonValueObject(BuildFunctionJson(Function, Options.bIncludeSuper, DeclaringClass))));
+					if (SharedInherited)
+					{
+						SharedInherited->EmittedMembers.Add(&Function);
+					}
 				}
 			}
 		}
 	}
 
-	static FString BuildSchemaJson(UClass* TargetClass, const FOptions& Options)
+	static FString BuildSchemaCacheKey(const FString& ClassPath, const FOptions& Options)
+	{
+		return FString::Printf(
+			TEXT("%s|%s|%d%d%d%d%d|%d"),
+			*ClassPath,
+			*Options.MemberContains.ToLower(),
+			Options.bIncludeSuper ? 1 : 0,
+			Options.bIncludeProperties ? 1 : 0,
+			Options.bIncludeFunctions ? 1 : 0,
+			Options.bScriptableOnly ? 1 : 0,
+			Options.bIncludeDeprecated ? 1 : 0,
+			Options.MaxResults);
+	}
+
+	static TSharedPtr<FJsonObject> BuildSchemaObject(const FClassChain& Chain, const FOptions& Options, FSharedInherited* SharedInherited = nullptr)
 	{
+		const FUnrealGPTReflectedClass& TargetClass = *Chain[0];
+		const int32 OmittedBefore = SharedInherited ? SharedInherited->OmittedCount : 0;
+
 		TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject);
 		Root->SetStringField(TEXT("status"), TEXT("ok"));
-		Root->SetStringField(TEXT("class_name"), TargetClass->GetName());
-		Root->SetStringField(TEXT("path_name"), TargetClass->GetPathName());
-		Root->SetStringField(TEXT("cpp_type"), GetClassCppType(TargetClass));
+		Root->SetStringField(TEXT("class_name"), TargetClass.Name);
+		Root->SetStringField(TEXT("path_name"), TargetClass.PathName);
+		Root->SetStringField(TEXT("cpp_type"), TargetClass.CppType);
 
-		if (UClass* SuperClass = TargetClass->GetSuperClass())
+		if (Chain.Num() > 1)
 		{
-			Root->SetStringField(TEXT("super_class"), SuperClass->GetName());
+			Root->SetStringField(TEXT("super_class"), Chain[1]->Name);
 		}
 
 		FOptions EffectiveOptions = Options;
-		EFieldIteratorFlags::SuperClassFlags IteratorFlags = Options.bIncludeSuper
-			? EFieldIteratorFlags::IncludeSuper
-			: EFieldIteratorFlags::ExcludeSuper;
 
 		TArray<TSharedPtr<FJsonValue>> PropertiesJson;
 		TArray<TSharedPtr<FJsonValue>> FunctionsJson;
@@ -545,14 +462,14 @@ namespace UnrealGPTReflectionQueryPrivate
 
 		GatherClassMembers(
 			EffectiveOptions,
-			TargetClass,
-			IteratorFlags,
+			Chain,
 			PropertiesJson,
 			FunctionsJson,
 			MatchedPropertyCount,
 			MatchedFunctionCount,
 			bPropertiesTruncated,
-			bFunctionsTruncated);
+			bFunctionsTruncated,
+			SharedInherited);
 
 		if (!EffectiveOptions.bIncludeSuper
 			&& !EffectiveOptions.MemberContains.IsEmpty()
@@ -562,22 +479,17 @@ namespace UnrealGPTReflectionQueryPrivate
 			EffectiveOptions.bIncludeSuper = true;
 			PropertiesJson.Reset();
 			FunctionsJson.Reset();
-			MatchedPropertyCount = 0;
-			MatchedFunctionCount = 0;
-			bPropertiesTruncated = false;
-			bFunctionsTruncated = false;
 
-			IteratorFlags = EFieldIteratorFlags::IncludeSuper;
 			GatherClassMembers(
 				EffectiveOptions,
-				TargetClass,
-				IteratorFlags,
+				Chain,
 				PropertiesJson,
 				FunctionsJson,
 				MatchedPropertyCount,
 				MatchedFunctionCount,
 				bPropertiesTruncated,
-				bFunctionsTruncated);
+				bFunctionsTruncated,
+				SharedInherited);
 
 			Root->SetBoolField(TEXT("searched_super"), true);
 		}
@@ -602,45 +514,316 @@ namespace UnrealGPTReflectionQueryPrivate
 			}
 		}
 
-		if (MatchedPropertyCount == 0 && MatchedFunctionCount == 0)
+		const int32 InheritedOmitted = SharedInherited ? SharedInherited->OmittedCount - OmittedBefore : 0;
+		if (InheritedOmitted > 0)
+		{
+			Root->SetNumberField(TEXT("inherited_omitted"), InheritedOmitted);
+		}
+
+		if (MatchedPropertyCount == 0 && MatchedFunctionCount == 0 && InheritedOmitted == 0)
 		{
 			Root->SetStringField(
 				TEXT("hint"),
 				TEXT("No members matched. Try a broader member_contains filter, set scriptable_only=false, or include_super=true."));
 		}
 
+		return Root;
+	}
+
+	static FString BuildSchemaJson(const FClassChain& Chain, const FOptions& Options)
+	{
+		return SerializeJson(BuildSchemaObject(Chain, Options));
+	}
+
+	/** Super classes are only read when inherited members are requested or a member filter may fall back to them. */
+	static bool NeedsSuperChain(const FOptions& Options)
+	{
+		return Options.bIncludeSuper || !Options.MemberContains.IsEmpty();
+	}
+
+	static void AppendSnapshotChain(const FUnrealGPTReflectionSnapshot& Snapshot, const FUnrealGPTReflectedClass& TargetClass, bool bWithSupers, FClassChain& OutChain)
+	{
+		OutChain.Add(&TargetClass);
+		if (bWithSupers)
+		{
+			for (const FUnrealGPTReflectedClass* Super = Snapshot.FindSuper(TargetClass); Super; Super = Snapshot.FindSuper(*Super))
+			{
+				OutChain.Add(Super);
+			}
+		}
+	}
+
+	/**
+	 * Builds class chains from the snapshot where possible and captures the rest live.
+	 * Live captures are kept for the resolver's lifetime so a batch walks each shared super class once.
+	 */
+	struct FChainResolver
+	{
+		TSharedPtr<const FUnrealGPTReflectionSnapshot> Snapshot;
+		TMap<FString, TUniquePtr<FUnrealGPTReflectedClass>> LiveClasses;
+
+		void Resolve(UClass* TargetClass, bool bWithSupers, FClassChain& OutChain)
+		{
+			for (UClass* Class = TargetClass; Class; Class = bWithSupers ? Class->GetSuperClass() : nullptr)
+			{
+				const FString PathName = Class->GetPathName();
+
+				// Blueprint chains usually end in native parents the snapshot already holds.
+				if (Snapshot.IsValid())
+				{
+					if (const FUnrealGPTReflectedClass* SnapshotClass = Snapshot->FindByPath(PathName))
+					{
+						AppendSnapshotChain(*Snapshot, *SnapshotClass, bWithSupers, OutChain);
+						return;
+					}
+				}
+
+				TUniquePtr<FUnrealGPTReflectedClass>& Captured = LiveClasses.FindOrAdd(PathName);
+				if (!Captured.IsValid())
+				{
+					Captured = MakeUnique<FUnrealGPTReflectedClass>();
+					FUnrealGPTReflectionSnapshot::CaptureClass(Class, *Captured);
+				}
+				OutChain.Add(Captured.Get());
+			}
+		}
+	};
+
+	static const FUnrealGPTReflectedClass* FindSnapshotClass(const FUnrealGPTReflectionSnapshot& Snapshot, const FString& ClassName)
+	{
+		if (const FUnrealGPTReflectedClass* ByPath = Snapshot.FindByPath(ClassName))
+		{
+			return ByPath;
+		}
+
+		// Ambiguous short names fall through to the live resolver, which reports the candidates.
+		TArray<const FUnrealGPTReflectedClass*> Matches;
+		Snapshot.FindByName(ClassName, Matches);
+		return Matches.Num() == 1 ? Matches[0] : nullptr;
+	}
+
+	static bool TryBuildFromSnapshot(const FOptions& Options, FString& OutJson)
+	{
+		const TSharedPtr<const FUnrealGPTReflectionSnapshot> Snapshot = FUnrealGPTReflectionIndex::Get().GetSnapshot();
+		if (!Snapshot.IsValid())
+		{
+			return false;
+		}
+
+		const FUnrealGPTReflectedClass* TargetClass = FindSnapshotClass(*Snapshot, Options.ClassName);
+		if (!TargetClass)
+		{
+			return false;
+		}
+
+		const FString CacheKey = BuildSchemaCacheKey(TargetClass->PathName, Options);
+		if (FUnrealGPTReflectionIndex::Get().FindCachedSchema(CacheKey, OutJson))
+		{
+			return true;
+		}
+
+		FClassChain Chain;
+		AppendSnapshotChain(*Snapshot, *TargetClass, NeedsSuperChain(Options), Chain);
+
+		OutJson = BuildSchemaJson(Chain, Options);
+		FUnrealGPTReflectionIndex::Get().CacheSchema(CacheKey, OutJson);
+		return true;
+	}
+
+	static TSharedPtr<FJsonObject> MakeUnresolvedClassError(const FString& ClassName, const TArray<FString>& AmbiguousCandidates)
+	{
+		if (AmbiguousCandidates.Num() > 0)
+		{
+			return MakeReflectionError(
+				FString::Printf(TEXT("Ambiguous class name '%s'. Use a fully qualified path."), *ClassName),
+				AmbiguousCandidates);
+		}
+
+		TArray<FString> NearbyCandidates;
+		CollectNameCandidates(ClassName, NearbyCandidates);
+		return MakeReflectionError(
+			FString::Printf(TEXT("Class not found: %s"), *ClassName),
+			NearbyCandidates);
+	}
+
+	/** Resolve Options.ClassName to a chain. Returns an error object when the class cannot be resolved. */
+	static TSharedPtr<FJsonObject> ResolveChain(const FOptions& Options, FChainResolver& Resolver, FClassChain& OutChain)
+	{
+		if (Resolver.Snapshot.IsValid())
+		{
+			if (const FUnrealGPTReflectedClass* SnapshotClass = FindSnapshotClass(*Resolver.Snapshot, Options.ClassName))
+			{
+				AppendSnapshotChain(*Resolver.Snapshot, *SnapshotClass, NeedsSuperChain(Options), OutChain);
+				return nullptr;
+			}
+		}
+
+		TArray<FString> AmbiguousCandidates;
+		UClass* TargetClass = ResolveClass(Options.ClassName, AmbiguousCandidates);
+		if (!TargetClass)
+		{
+			return MakeUnresolvedClassError(Options.ClassName, AmbiguousCandidates);
+		}
+
+		Resolver.Resolve(TargetClass, NeedsSuperChain(Options), OutChain);
+		return nullptr;
+	}
+
+	static FString QueryBatch(const FJsonObject& ArgsObj, const TArray<TSharedPtr<FJsonValue>>& ClassEntries)
+	{
+		if (ClassEntries.Num() == 0)
+		{
+			return SerializeJson(MakeReflectionError(TEXT("classes must contain at least one entry")));
+		}
+		if (ClassEntries.Num() > FUnrealGPTReflectionQuery::MaxBatchClasses)
+		{
+			return SerializeJson(MakeReflectionError(FString::Printf(
+				TEXT("classes accepts at most %d entries per call"), FUnrealGPTReflectionQuery::MaxBatchClasses)));
+		}
+
+		FOptions SharedOptions;
+		ReadOptionFields(ArgsObj, SharedOptions);
+		SharedOptions.ClassName.Reset();
+
+		FChainResolver Resolver;
+		Resolver.Snapshot = FUnrealGPTReflectionIndex::Get().GetSnapshot();
+		FSharedInherited SharedInherited;
+
+		TArray<TSharedPtr<FJsonValue>> Results;
+		int32 FailedCount = 0;
+		for (const TSharedPtr<FJsonValue>& Entry : ClassEntries)
+		{
+			FOptions EntryOptions = SharedOptions;
+			const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+			if (Entry.IsValid() && Entry->TryGetObject(EntryObj) && EntryObj && EntryObj->IsValid())
+			{
+				ReadOptionFields(**EntryObj, EntryOptions);
+			}
+			else if (Entry.IsValid())
+			{
+				Entry->TryGetString(EntryOptions.ClassName);
+			}
+
+			TSharedPtr<FJsonObject> EntryResult;
+			FClassChain Chain;
+			if (EntryOptions.ClassName.IsEmpty())
+			{
+				EntryResult = MakeReflectionError(TEXT("Missing class_name in classes entry"));
+			}
+			else
+			{
+				EntryResult = ResolveChain(EntryOptions, Resolver, Chain);
+				if (EntryResult.IsValid())
+				{
+					EntryResult->SetStringField(TEXT("class_name"), EntryOptions.ClassName);
+				}
+			}
+
+			if (EntryResult.IsValid())
+			{
+				++FailedCount;
+			}
+			else
+			{
+				EntryResult = BuildSchemaObject(Chain, EntryOptions, &SharedInherited);
+			}
+
+			Results.Add(MakeShareable(new FJsonValueObject(EntryResult)));
+		}
+
+		TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject);
+		Root->SetStringField(TEXT("status"), FailedCount == Results.Num() ? TEXT("error") : TEXT("ok"));
+		Root->SetArrayField(TEXT("results"), Results);
+		if (FailedCount > 0)
+		{
+			Root->SetNumberField(TEXT("failed"), FailedCount);
+		}
+		if (SharedInherited.OmittedCount > 0)
+		{
+			Root->SetStringField(
+				TEXT("note"),
+				TEXT("Inherited members already listed for an earlier class in this batch are omitted (inherited_omitted); match them by declared_on."));
+		}
+
 		return SerializeJson(Root);
 	}
 }
 
-FString FUnrealGPTReflectionQuery::Query(const FString& ArgumentsJson)
+bool FUnrealGPTReflectionQuery::TryQuerySnapshot(const FString& ArgumentsJson, FString& OutResult)
 {
 	using namespace UnrealGPTReflectionQueryPrivate;
 
+	TSharedPtr<FJsonObject> ArgsObj;
+	FString ParseError;
+	if (!ParseArguments(ArgumentsJson, ArgsObj, ParseError))
+	{
+		OutResult = SerializeJson(MakeReflectionError(ParseError));
+		return true;
+	}
+
+	// Batches may need live captures; leave them to Query.
 	FOptions Options;
+	ReadOptionFields(*ArgsObj, Options);
+	if (Options.ClassName.IsEmpty() || ArgsObj->HasField(TEXT("classes")))
+	{
+		return false;
+	}
+
+	return TryBuildFromSnapshot(Options, OutResult);
+}
+
+FString FUnrealGPTReflectionQuery::Query(const FString& ArgumentsJson)
+{
+	using namespace UnrealGPTReflectionQueryPrivate;
+
+	TSharedPtr<FJsonObject> ArgsObj;
 	FString ParseError;
-	if (!ParseOptions(ArgumentsJson, Options, ParseError))
+	if (!ParseArguments(ArgumentsJson, ArgsObj, ParseError))
 	{
 		return SerializeJson(MakeReflectionError(ParseError));
 	}
 
+	FUnrealGPTReflectionIndex::Get().EnsureSnapshot();
+
+	const TArray<TSharedPtr<FJsonValue>>* ClassEntries = nullptr;
+	if (ArgsObj->TryGetArrayField(TEXT("classes"), ClassEntries) && ClassEntries)
+	{
+		return QueryBatch(*ArgsObj, *ClassEntries);
+	}
+
+	FOptions Options;
+	ReadOptionFields(*ArgsObj, Options);
+	if (Options.ClassName.IsEmpty())
+	{
+		return SerializeJson(MakeReflectionError(TEXT("Missing required field: class_name (or classes for a batch query)")));
+	}
+
+	FString SchemaJson;
+	if (TryBuildFromSnapshot(Options, SchemaJson))
+	{
+		return SchemaJson;
+	}
+
 	TArray<FString> AmbiguousCandidates;
 	UClass* TargetClass = ResolveClass(Options.ClassName, AmbiguousCandidates);
 	if (!TargetClass)
 	{
-		if (AmbiguousCandidates.Num() > 0)
-		{
-			return SerializeJson(MakeReflectionError(
-				FString::Printf(TEXT("Ambiguous class name '%s'. Use a fully qualified path."), *Options.ClassName),
-				AmbiguousCandidates));
-		}
+		return SerializeJson(MakeUnresolvedClassError(Options.ClassName, AmbiguousCandidates));
+	}
 
-		TArray<FString> NearbyCandidates;
-		CollectNameCandidates(Options.ClassName, NearbyCandidates);
-		return SerializeJson(MakeReflectionError(
-			FString::Printf(TEXT("Class not found: %s"), *Options.ClassName),
-			NearbyCandidates));
+	const FString CacheKey = BuildSchemaCacheKey(TargetClass->GetPathName(), Options);
+	if (FUnrealGPTReflectionIndex::Get().FindCachedSchema(CacheKey, SchemaJson))
+	{
+		return SchemaJson;
 	}
 
-	return BuildSchemaJson(TargetClass, Options);
+	// Blueprint classes and anything loaded after the snapshot was taken are captured live.
+	FChainResolver Resolver;
+	Resolver.Snapshot = FUnrealGPTReflectionIndex::Get().GetSnapshot();
+	FClassChain Chain;
+	Resolver.Resolve(TargetClass, NeedsSuperChain(Options), Chain);
+
+	SchemaJson = BuildSchemaJson(Chain, Options);
+	FUnrealGPTReflectionIndex::Get().CacheSchema(CacheKey, SchemaJson);
+	return SchemaJson;
 }
@@ -11,6 +11,15 @@
 class UNREALGPTEDITOR_API FUnrealGPTReflectionQuery
 {
 public:
-	/** Execute reflection_query from a JSON arguments object. */
+	/** Upper bound on entries in a batched reflection_query 'classes' list. */
+	static constexpr int32 MaxBatchClasses = 16;
+
+	/** Execute reflection_query from a JSON arguments object; a 'classes' array runs a batch query. */
 	static FString Query(const FString& ArgumentsJson);
+
+	/**
+	 * Answer reflection_query from the loaded reflection snapshot only. Safe off the game thread.
+	 * Returns false when no snapshot is loaded or the class is not in it; callers then fall back to Query.
+	 */
+	static bool TryQuerySnapshot(const FString& ArgumentsJson, FString& OutResult);
 };
@@ -0,0 +1,485 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTReflectionSearch.h"
+#include "UnrealGPTReflectionIndex.h"
+#include "UnrealGPTReflectionSnapshot.h"
+#include "Algo/BinarySearch.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace UnrealGPTReflectionSearchPrivate
+{
+	// Standard BM25 parameters.
+	constexpr float Bm25K1 = 1.2f;
+	constexpr float Bm25B = 0.75f;
+
+	// Field weights: a term in the member name counts three times a term in its tooltip.
+	constexpr float NameWeight = 3.0f;
+	constexpr float CategoryWeight = 2.0f;
+	constexpr float ClassWeight = 1.0f;
+	constexpr float TooltipWeight = 1.0f;
+
+	constexpr int32 MinPrefixLength = 3;
+	constexpr int32 MaxPrefixExpansions = 8;
+	constexpr float PrefixExpansionWeight = 0.5f;
+	constexpr int32 MaxResultTooltipChars = 160;
+
+	static bool IsStopWord(const FString& Term)
+	{
+		static const TSet<FString> StopWords = {
+			TEXT("the"), TEXT("an"), TEXT("of"), TEXT("to"), TEXT("in"), TEXT("is"), TEXT("for"), TEXT("and"),
+			TEXT("or"), TEXT("this"), TEXT("that"), TEXT("be"), TEXT("it"), TEXT("on"), TEXT("with"), TEXT("as"),
+			TEXT("by"), TEXT("if"), TEXT("are"), TEXT("from"), TEXT("will"), TEXT("at"), TEXT("not"), TEXT("its")
+		};
+		return StopWords.Contains(Term);
+	}
+
+	static void AddTerm(FString& Term, TArray<FString>& OutTerms)
+	{
+		Term.ToLowerInline();
+		if (Term.Len() >= 2 && !IsStopWord(Term))
+		{
+			// Fold simple plurals so "materials" finds "Material".
+			if (Term.Len() > 4 && Term.EndsWith(TEXT("s")) && !Term.EndsWith(TEXT("ss")))
+			{
+				Term.LeftChopInline(1);
+			}
+			OutTerms.Add(Term);
+		}
+		Term.Reset();
+	}
+
+	static FString SerializeJson(const TSharedPtr<FJsonObject>& Root)
+	{
+		FString OutJson;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
+		FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+		return OutJson;
+	}
+
+	static FString MakeErrorJson(const FString& Message)
+	{
+		TSharedPtr<FJsonObject> ErrorObj = MakeShareable(new FJsonObject);
+		ErrorObj->SetStringField(TEXT("status"), TEXT("error"));
+		ErrorObj->SetStringField(TEXT("message"), Message);
+		return SerializeJson(ErrorObj);
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FUnrealGPTReflectionSearchIndex::FDocument& Document)
+{
+	Ar << Document.ClassIndex << Document.MemberIndex << Document.bIsFunction << Document.Length;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FUnrealGPTReflectionSearchIndex::FPosting& Posting)
+{
+	Ar << Posting.Document << Posting.TermWeight;
+	return Ar;
+}
+
+FString FUnrealGPTReflectionSearchIndex::GetDefaultFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("UnrealGPT") / TEXT("ReflectionSearch.bin");
+}
+
+void FUnrealGPTReflectionSearchIndex::Tokenize(const FString& Text, TArray<FString>& OutTerms)
+{
+	using namespace UnrealGPTReflectionSearchPrivate;
+
+	FString Current;
+	for (int32 Index = 0; Index < Text.Len(); ++Index)
+	{
+		const TCHAR Char = Text[Index];
+		if (!FChar::IsAlnum(Char))
+		{
+			AddTerm(Current, OutTerms);
+			continue;
+		}
+
+		// Split "SetStaticMesh" before each capital and "HTTPRequest" before the last capital of a run.
+		if (FChar::IsUpper(Char) && Current.Len() > 0)
+		{
+			const TCHAR Previous = Text[Index - 1];
+			const bool bNextIsLower = Index + 1 < Text.Len() && FChar::IsLower(Text[Index + 1]);
+			if (FChar::IsLower(Previous) || FChar::IsDigit(Previous) || (FChar::IsUpper(Previous) && bNextIsLower))
+			{
+				AddTerm(Current, OutTerms);
+			}
+		}
+
+		Current.AppendChar(Char);
+	}
+	AddTerm(Current, OutTerms);
+}
+
+void FUnrealGPTReflectionSearchIndex::AddDocument(
+	int32 ClassIndex,
+	int32 MemberIndex,
+	bool bIsFunction,
+	const FString& Name,
+	const FString& Category,
+	const FString& Tooltip,
+	const FString& ClassName)
+{
+	using namespace UnrealGPTReflectionSearchPrivate;
+
+	const int32 DocumentIndex = Documents.AddDefaulted();
+	FDocument& Document = Documents[DocumentIndex];
+	Document.ClassIndex = ClassIndex;
+	Document.MemberIndex = MemberIndex;
+	Document.bIsFunction = bIsFunction;
+
+	TMap<FString, float> TermWeights;
+	TArray<FString> Terms;
+	auto AddField = [&TermWeights, &Terms, &Document](const FString& FieldText, float Weight)
+	{
+		Terms.Reset();
+		Tokenize(FieldText, Terms);
+		for (const FString& Term : Terms)
+		{
+			TermWeights.FindOrAdd(Term) += Weight;
+			Document.Length += Weight;
+		}
+	};
+
+	AddField(Name, NameWeight);
+	AddField(Category, CategoryWeight);
+	AddField(ClassName, ClassWeight);
+	AddField(Tooltip, TooltipWeight);
+
+	for (const TPair<FString, float>& Pair : TermWeights)
+	{
+		Postings.FindOrAdd(Pair.Key).Add({ DocumentIndex, Pair.Value });
+	}
+}
+
+void FUnrealGPTReflectionSearchIndex::FinishBuild()
+{
+	float TotalLength = 0.0f;
+	for (const FDocument& Document : Documents)
+	{
+		TotalLength += Document.Length;
+	}
+	AverageLength = Documents.Num() > 0 ? FMath::Max(1.0f, TotalLength / Documents.Num()) : 1.0f;
+
+	Postings.GetKeys(SortedTerms);
+	SortedTerms.Sort();
+}
+
+TSharedRef<FUnrealGPTReflectionSearchIndex> FUnrealGPTReflectionSearchIndex::Build(const TSharedRef<const FUnrealGPTReflectionSnapshot>& Snapshot)
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	TSharedRef<FUnrealGPTReflectionSearchIndex> Index = MakeShared<FUnrealGPTReflectionSearchIndex>();
+	Index->Snapshot = Snapshot;
+
+	const TArray<FUnrealGPTReflectedClass>& Classes = Snapshot->GetClasses();
+	for (int32 ClassIndex = 0; ClassIndex < Classes.Num(); ++ClassIndex)
+	{
+		const FUnrealGPTReflectedClass& Class = Classes[ClassIndex];
+		for (int32 MemberIndex = 0; MemberIndex < Class.Functions.Num(); ++MemberIndex)
+		{
+			const FUnrealGPTReflectedFunction& Function = Class.Functions[MemberIndex];
+			if (Function.IsScriptable(false))
+			{
+				Index->AddDocument(ClassIndex, MemberIndex, true, Function.Name, Function.Category, Function.Tooltip, Class.Name);
+			}
+		}
+		for (int32 MemberIndex = 0; MemberIndex < Class.Properties.Num(); ++MemberIndex)
+		{
+			const FUnrealGPTReflectedProperty& Property = Class.Properties[MemberIndex];
+			if (Property.IsScriptable(false))
+			{
+				Index->AddDocument(ClassIndex, MemberIndex, false, Property.Name, Property.Category, Property.Tooltip, Class.Name);
+			}
+		}
+	}
+
+	Index->FinishBuild();
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Built reflection search index with %d members and %d terms in %.1f ms"),
+		Index->Documents.Num(), Index->SortedTerms.Num(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+	return Index;
+}
+
+bool FUnrealGPTReflectionSearchIndex::SaveToFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = FileMagic;
+	int32 Version = FileVersion;
+	FGuid SnapshotId = Snapshot->GetSnapshotId();
+	Writer << Magic << Version << SnapshotId << Documents << Postings;
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+	return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+TSharedPtr<FUnrealGPTReflectionSearchIndex> FUnrealGPTReflectionSearchIndex::LoadFromFile(const FString& FilePath, const TSharedRef<const FUnrealGPTReflectionSnapshot>& Snapshot)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+	{
+		return nullptr;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	FGuid SnapshotId;
+	Reader << Magic << Version;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		return nullptr;
+	}
+
+	Reader << SnapshotId;
+	if (Reader.IsError() || SnapshotId != Snapshot->GetSnapshotId())
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FUnrealGPTReflectionSearchIndex> Index = MakeShared<FUnrealGPTReflectionSearchIndex>();
+	Index->Snapshot = Snapshot;
+	Reader << Index->Documents << Index->Postings;
+	if (Reader.IsError())
+	{
+		return nullptr;
+	}
+
+	// Documents index into the snapshot; reject a file that does not fit it.
+	const TArray<FUnrealGPTReflectedClass>& Classes = Snapshot->GetClasses();
+	for (const FUnrealGPTReflectionSearchIndex::FDocument& Document : Index->Documents)
+	{
+		if (!Classes.IsValidIndex(Document.ClassIndex))
+		{
+			return nullptr;
+		}
+
+		const FUnrealGPTReflectedClass& Class = Classes[Document.ClassIndex];
+		const int32 MemberCount = Document.bIsFunction ? Class.Functions.Num() : Class.Properties.Num();
+		if (Document.MemberIndex < 0 || Document.MemberIndex >= MemberCount)
+		{
+			return nullptr;
+		}
+
+		// Written as "not >= 0" so NaN is rejected too
+		if (!(Document.Length >= 0.0f))
+		{
+			return nullptr;
+		}
+	}
+
+	// Search reads Documents[Posting.Document] unchecked; a corrupt posting must trigger a rebuild, not a crash.
+	for (const TPair<FString, TArray<FUnrealGPTReflectionSearchIndex::FPosting>>& Pair : Index->Postings)
+	{
+		for (const FUnrealGPTReflectionSearchIndex::FPosting& Posting : Pair.Value)
+		{
+			if (!Index->Documents.IsValidIndex(Posting.Document) || !(Posting.TermWeight >= 0.0f))
+			{
+				return nullptr;
+			}
+		}
+	}
+
+	Index->FinishBuild();
+	return Index;
+}
+
+FUnrealGPTReflectionSearchIndex::FHit FUnrealGPTReflectionSearchIndex::MakeHit(const FDocument& Document, float Score) const
+{
+	FHit Hit;
+	Hit.Class = &Snapshot->GetClasses()[Document.ClassIndex];
+	if (Document.bIsFunction)
+	{
+		Hit.Function = &Hit.Class->Functions[Document.MemberIndex];
+	}
+	else
+	{
+		Hit.Property = &Hit.Class->Properties[Document.MemberIndex];
+	}
+	Hit.Score = Score;
+	return Hit;
+}
+
+void FUnrealGPTReflectionSearchIndex::Search(const FString& QueryText, const FSearchFilter& Filter, TArray<FHit>& OutHits) const
+{
+	using namespace UnrealGPTReflectionSearchPrivate;
+
+	TArray<FString> QueryTerms;
+	Tokenize(QueryText, QueryTerms);
+
+	TArray<FString> UniqueTerms;
+	for (const FString& Term : QueryTerms)
+	{
+		UniqueTerms.AddUnique(Term);
+	}
+
+	const float DocumentCount = static_cast<float>(Documents.Num());
+	TMap<int32, float> ScoreByDocument;
+
+	auto ScoreTerm = [this, DocumentCount, &ScoreByDocument](const TArray<FPosting>& TermPostings, float QueryWeight)
+	{
+		const float DocumentFrequency = static_cast<float>(TermPostings.Num());
+		const float Idf = FMath::Loge(1.0f + (DocumentCount - DocumentFrequency + 0.5f) / (DocumentFrequency + 0.5f));
+		for (const FPosting& Posting : TermPostings)
+		{
+			const float LengthRatio = Documents[Posting.Document].Length / AverageLength;
+			const float TermScore = Idf * (Posting.TermWeight * (Bm25K1 + 1.0f)) / (Posting.TermWeight + Bm25K1 * (1.0f - Bm25B + Bm25B * LengthRatio));
+			ScoreByDocument.FindOrAdd(Posting.Document) += QueryWeight * TermScore;
+		}
+	};
+
+	for (const FString& Term : UniqueTerms)
+	{
+		if (const TArray<FPosting>* TermPostings = Postings.Find(Term))
+		{
+			ScoreTerm(*TermPostings, 1.0f);
+			continue;
+		}
+
+		if (Term.Len() < MinPrefixLength)
+		{
+			continue;
+		}
+
+		int32 TermIndex = Algo::LowerBound(SortedTerms, Term);
+		for (int32 Expanded = 0; TermIndex < SortedTerms.Num() && Expanded < MaxPrefixExpansions; ++TermIndex, ++Expanded)
+		{
+			const FString& Candidate = SortedTerms[TermIndex];
+			if (!Candidate.StartsWith(Term, ESearchCase::CaseSensitive))
+			{
+				break;
+			}
+			ScoreTerm(Postings.FindChecked(Candidate), PrefixExpansionWeight);
+		}
+	}
+
+	TArray<TPair<int32, float>> Ranked;
+	Ranked.Reserve(ScoreByDocument.Num());
+	for (const TPair<int32, float>& Pair : ScoreByDocument)
+	{
+		const FDocument& Document = Documents[Pair.Key];
+		if ((Filter.Kind == EMemberKind::Function && !Document.bIsFunction)
+			|| (Filter.Kind == EMemberKind::Property && Document.bIsFunction))
+		{
+			continue;
+		}
+
+		if (!Filter.ClassContains.IsEmpty()
+			&& !Snapshot->GetClasses()[Document.ClassIndex].Name.Contains(Filter.ClassContains, ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+
+		Ranked.Add(Pair);
+	}
+
+	Ranked.Sort([](const TPair<int32, float>& A, const TPair<int32, float>& B)
+	{
+		return A.Value > B.Value;
+	});
+
+	const int32 ResultCount = FMath::Min(Ranked.Num(), Filter.MaxResults);
+	for (int32 Index = 0; Index < ResultCount; ++Index)
+	{
+		OutHits.Add(MakeHit(Documents[Ranked[Index].Key], Ranked[Index].Value));
+	}
+}
+
+FString FUnrealGPTReflectionSearch::Query(const FString& ArgumentsJson)
+{
+	using namespace UnrealGPTReflectionSearchPrivate;
+
+	TSharedPtr<FJsonObject> ArgsObj;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ArgumentsJson);
+	if (!(FJsonSerializer::Deserialize(Reader, ArgsObj) && ArgsObj.IsValid()))
+	{
+		return MakeErrorJson(TEXT("Failed to parse reflection_search arguments"));
+	}
+
+	FString QueryText;
+	if (!ArgsObj->TryGetStringField(TEXT("query"), QueryText) || QueryText.TrimStartAndEnd().IsEmpty())
+	{
+		return MakeErrorJson(TEXT("Missing required field: query"));
+	}
+
+	FUnrealGPTReflectionSearchIndex::FSearchFilter Filter;
+	FString KindValue;
+	if (ArgsObj->TryGetStringField(TEXT("kind"), KindValue))
+	{
+		if (KindValue.Equals(TEXT("function"), ESearchCase::IgnoreCase))
+		{
+			Filter.Kind = FUnrealGPTReflectionSearchIndex::EMemberKind::Function;
+		}
+		else if (KindValue.Equals(TEXT("property"), ESearchCase::IgnoreCase))
+		{
+			Filter.Kind = FUnrealGPTReflectionSearchIndex::EMemberKind::Property;
+		}
+	}
+	ArgsObj->TryGetStringField(TEXT("class_contains"), Filter.ClassContains);
+
+	double MaxResultsValue = Filter.MaxResults;
+	if (ArgsObj->TryGetNumberField(TEXT("max_results"), MaxResultsValue))
+	{
+		Filter.MaxResults = FMath::Clamp(static_cast<int32>(MaxResultsValue), 1, 50);
+	}
+
+	FUnrealGPTReflectionIndex::Get().EnsureSnapshot();
+	const TSharedPtr<const FUnrealGPTReflectionSearchIndex> SearchIndex = FUnrealGPTReflectionIndex::Get().GetSearchIndex();
+	if (!SearchIndex.IsValid())
+	{
+		return MakeErrorJson(TEXT("The reflection index is still loading. Retry shortly, or use reflection_query with a known class."));
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	TArray<FUnrealGPTReflectionSearchIndex::FHit> Hits;
+	SearchIndex->Search(QueryText, Filter, Hits);
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+	TArray<TSharedPtr<FJsonValue>> ResultsJson;
+	for (const FUnrealGPTReflectionSearchIndex::FHit& Hit : Hits)
+	{
+		const FString& Category = Hit.Function ? Hit.Function->Category : Hit.Property->Category;
+		const FString& Tooltip = Hit.Function ? Hit.Function->Tooltip : Hit.Property->Tooltip;
+
+		TSharedPtr<FJsonObject> HitJson = MakeShareable(new FJsonObject);
+		HitJson->SetStringField(TEXT("name"), Hit.Function ? Hit.Function->Name : Hit.Property->Name);
+		HitJson->SetStringField(TEXT("kind"), Hit.Function ? TEXT("function") : TEXT("property"));
+		HitJson->SetStringField(TEXT("class"), Hit.Class->Name);
+		HitJson->SetStringField(TEXT("class_path"), Hit.Class->PathName);
+		if (!Category.IsEmpty())
+		{
+			HitJson->SetStringField(TEXT("category"), Category);
+		}
+		if (!Tooltip.IsEmpty())
+		{
+			HitJson->SetStringField(TEXT("tooltip"), Tooltip.Left(MaxResultTooltipChars));
+		}
+		HitJson->SetNumberField(TEXT("score"), FMath::RoundToFloat(Hit.Score * 100.0f) / 100.0f);
+		ResultsJson.Add(MakeShareable(new FJsonValueObject(HitJson)));
+	}
+
+	TSharedPtr<FJsonObject> Root = MakeShareable(new FJsonObject);
+	Root->SetStringField(TEXT("status"), TEXT("ok"));
+	Root->SetArrayField(TEXT("results"), ResultsJson);
+	Root->SetNumberField(TEXT("searched_members"), SearchIndex->GetDocumentCount());
+	Root->SetNumberField(TEXT("took_ms"), FMath::RoundToFloat(static_cast<float>(ElapsedMs) * 100.0f) / 100.0f);
+	Root->SetStringField(
+		TEXT("hint"),
+		ResultsJson.Num() > 0
+			? TEXT("Call reflection_query with class_name and member_contains for full signatures.")
+			: TEXT("No members matched. Try other words, a shorter query, or drop kind/class_contains."));
+
+	return SerializeJson(Root);
+}
@@ -0,0 +1,97 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FUnrealGPTReflectionSnapshot;
+struct FUnrealGPTReflectedClass;
+struct FUnrealGPTReflectedFunction;
+struct FUnrealGPTReflectedProperty;
+
+/**
+ * BM25 index over the names, categories and tooltips of scriptable members in a reflection snapshot.
+ * Terms missing from the vocabulary are expanded by prefix, so partial words still rank.
+ * A persisted index is only reused with the snapshot it was built from. Immutable once built; searches are thread-safe.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTReflectionSearchIndex
+{
+public:
+	static constexpr uint32 FileMagic = 0x53534755; // "UGSS"
+	static constexpr int32 FileVersion = 1;
+
+	enum class EMemberKind : uint8
+	{
+		Any,
+		Function,
+		Property
+	};
+
+	struct FSearchFilter
+	{
+		EMemberKind Kind = EMemberKind::Any;
+		FString ClassContains;
+		int32 MaxResults = 15;
+	};
+
+	struct FHit
+	{
+		const FUnrealGPTReflectedClass* Class = nullptr;
+		const FUnrealGPTReflectedFunction* Function = nullptr;
+		const FUnrealGPTReflectedProperty* Property = nullptr;
+		float Score = 0.0f;
+	};
+
+	static FString GetDefaultFilePath();
+
+	static TSharedRef<FUnrealGPTReflectionSearchIndex> Build(const TSharedRef<const FUnrealGPTReflectionSnapshot>& Snapshot);
+
+	/** Returns null when the file is missing, corrupt or was built from a different snapshot. */
+	static TSharedPtr<FUnrealGPTReflectionSearchIndex> LoadFromFile(const FString& FilePath, const TSharedRef<const FUnrealGPTReflectionSnapshot>& Snapshot);
+
+	bool SaveToFile(const FString& FilePath);
+
+	/** Ranked members for QueryText, best first. */
+	void Search(const FString& QueryText, const FSearchFilter& Filter, TArray<FHit>& OutHits) const;
+
+	/** Lower-case terms from identifiers (split on case and underscores) and prose. */
+	static void Tokenize(const FString& Text, TArray<FString>& OutTerms);
+
+	int32 GetDocumentCount() const { return Documents.Num(); }
+
+private:
+	struct FDocument
+	{
+		int32 ClassIndex = INDEX_NONE;
+		int32 MemberIndex = INDEX_NONE;
+		bool bIsFunction = false;
+		float Length = 0.0f;
+	};
+
+	struct FPosting
+	{
+		int32 Document = INDEX_NONE;
+		float TermWeight = 0.0f;
+	};
+
+	friend FArchive& operator<<(FArchive& Ar, FDocument& Document);
+	friend FArchive& operator<<(FArchive& Ar, FPosting& Posting);
+
+	void AddDocument(int32 ClassIndex, int32 MemberIndex, bool bIsFunction, const FString& Name, const FString& Category, const FString& Tooltip, const FString& ClassName);
+	void FinishBuild();
+	FHit MakeHit(const FDocument& Document, float Score) const;
+
+	TSharedPtr<const FUnrealGPTReflectionSnapshot> Snapshot;
+	TArray<FDocument> Documents;
+	TMap<FString, TArray<FPosting>> Postings;
+	TArray<FString> SortedTerms;
+	float AverageLength = 1.0f;
+};
+
+/** Entry point for the reflection_search agent tool. */
+class UNREALGPTEDITOR_API FUnrealGPTReflectionSearch
+{
+public:
+	/** Execute reflection_search from a JSON arguments object. Game thread only. */
+	static FString Query(const FString& ArgumentsJson);
+};
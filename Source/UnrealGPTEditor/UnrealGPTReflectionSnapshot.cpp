@@ -0,0 +1,442 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTReflectionSnapshot.h"
+#include "HAL/FileManager.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectIterator.h"
+
+static FArchive& operator<<(FArchive& Ar, FUnrealGPTReflectedProperty& Property)
+{
+	Ar << Property.Name << Property.CppType << Property.UeType << Property.Category << Property.Tooltip << Property.Flags;
+	return Ar;
+}
+
+static FArchive& operator<<(FArchive& Ar, FUnrealGPTReflectedParam& Param)
+{
+	Ar << Param.Name << Param.CppType << Param.bIsOut;
+	return Ar;
+}
+
+static FArchive& operator<<(FArchive& Ar, FUnrealGPTReflectedFunction& Function)
+{
+	Ar << Function.Name << Function.Category << Function.Tooltip << Function.Flags << Function.Params << Function.bHasReturn;
+	if (Function.bHasReturn)
+	{
+		Ar << Function.Return;
+	}
+	return Ar;
+}
+
+static FArchive& operator<<(FArchive& Ar, FUnrealGPTReflectedClass& Class)
+{
+	Ar << Class.Name << Class.PathName << Class.CppType << Class.SuperPathName << Class.Properties << Class.Functions;
+	return Ar;
+}
+
+namespace UnrealGPTReflectionSnapshotPrivate
+{
+	static uint8 CapturePropertyFlags(const FProperty* Property)
+	{
+		uint8 Flags = EUnrealGPTReflectedPropertyFlags::None;
+		if (Property->HasAnyPropertyFlags(CPF_Edit))
+		{
+			Flags |= EUnrealGPTReflectedPropertyFlags::Edit;
+		}
+		if (Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+		{
+			Flags |= EUnrealGPTReflectedPropertyFlags::BlueprintVisible;
+		}
+		if (Property->HasAnyPropertyFlags(CPF_BlueprintReadOnly))
+		{
+			Flags |= EUnrealGPTReflectedPropertyFlags::BlueprintReadOnly;
+		}
+		if (Property->HasAnyPropertyFlags(CPF_BlueprintAssignable))
+		{
+			Flags |= EUnrealGPTReflectedPropertyFlags::BlueprintAssignable;
+		}
+		if (Property->HasAnyPropertyFlags(CPF_Config))
+		{
+			Flags |= EUnrealGPTReflectedPropertyFlags::Config;
+		}
+		if (Property->HasAnyPropertyFlags(CPF_Deprecated))
+		{
+			Flags |= EUnrealGPTReflectedPropertyFlags::Deprecated;
+		}
+		if (Property->HasAnyPropertyFlags(CPF_DuplicateTransient))
+		{
+			Flags |= EUnrealGPTReflectedPropertyFlags::DuplicateTransient;
+		}
+		return Flags;
+	}
+
+	static uint16 CaptureFunctionFlags(const UFunction* Function)
+	{
+		uint16 Flags = EUnrealGPTReflectedFunctionFlags::None;
+		if (Function->HasAnyFunctionFlags(FUNC_BlueprintCallable))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::BlueprintCallable;
+		}
+		if (Function->HasAnyFunctionFlags(FUNC_BlueprintPure))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::BlueprintPure;
+		}
+		if (Function->HasAnyFunctionFlags(FUNC_BlueprintEvent))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::BlueprintEvent;
+		}
+		if (Function->HasAnyFunctionFlags(FUNC_BlueprintAuthorityOnly))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::BlueprintAuthorityOnly;
+		}
+		if (Function->HasAnyFunctionFlags(FUNC_Static))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::Static;
+		}
+		if (Function->HasAnyFunctionFlags(FUNC_Net))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::Net;
+		}
+		if (Function->HasAnyFunctionFlags(FUNC_Delegate))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::Delegate;
+		}
+		if (Function->HasAnyFunctionFlags(FUNC_Private))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::Private;
+		}
+		if (Function->HasAnyFunctionFlags(FUNC_Protected))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::Protected;
+		}
+		if (Function->HasMetaData(TEXT("DeprecatedFunction")))
+		{
+			Flags |= EUnrealGPTReflectedFunctionFlags::Deprecated;
+		}
+		return Flags;
+	}
+
+	static FString GetTooltip(const FField* Field)
+	{
+		return Field->GetMetaData(TEXT("ToolTip")).Left(FUnrealGPTReflectionSnapshot::MaxTooltipChars);
+	}
+
+	static FString GetTooltip(const UFunction* Function)
+	{
+		return Function->GetMetaData(TEXT("ToolTip")).Left(FUnrealGPTReflectionSnapshot::MaxTooltipChars);
+	}
+
+	static FString GetClassCppType(UClass* Class)
+	{
+		const FString Prefix = Class->GetPrefixCPP();
+		const FString Name = Class->GetName();
+		return Prefix.IsEmpty() ? Name : Prefix + Name;
+	}
+}
+
+bool FUnrealGPTReflectedProperty::IsScriptable(bool bIncludeDeprecated) const
+{
+	if (!bIncludeDeprecated && (Flags & EUnrealGPTReflectedPropertyFlags::Deprecated))
+	{
+		return false;
+	}
+
+	if (Flags & EUnrealGPTReflectedPropertyFlags::DuplicateTransient)
+	{
+		return false;
+	}
+
+	return (Flags & (EUnrealGPTReflectedPropertyFlags::Edit
+		| EUnrealGPTReflectedPropertyFlags::BlueprintVisible
+		| EUnrealGPTReflectedPropertyFlags::BlueprintReadOnly
+		| EUnrealGPTReflectedPropertyFlags::BlueprintAssignable)) != 0;
+}
+
+bool FUnrealGPTReflectedFunction::IsScriptable(bool bIncludeDeprecated) const
+{
+	if (!bIncludeDeprecated && (Flags & EUnrealGPTReflectedFunctionFlags::Deprecated))
+	{
+		return false;
+	}
+
+	if (Flags & (EUnrealGPTReflectedFunctionFlags::Delegate
+		| EUnrealGPTReflectedFunctionFlags::Private
+		| EUnrealGPTReflectedFunctionFlags::Protected))
+	{
+		return false;
+	}
+
+	return (Flags & (EUnrealGPTReflectedFunctionFlags::BlueprintCallable
+		| EUnrealGPTReflectedFunctionFlags::BlueprintPure
+		| EUnrealGPTReflectedFunctionFlags::BlueprintEvent
+		| EUnrealGPTReflectedFunctionFlags::BlueprintAuthorityOnly)) != 0;
+}
+
+FString FUnrealGPTReflectionSnapshot::GetDefaultFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("UnrealGPT") / TEXT("ReflectionSnapshot.bin");
+}
+
+void FUnrealGPTReflectionSnapshot::CaptureClass(UClass* Class, FUnrealGPTReflectedClass& OutClass)
+{
+	using namespace UnrealGPTReflectionSnapshotPrivate;
+
+	OutClass = FUnrealGPTReflectedClass();
+	if (!Class)
+	{
+		return;
+	}
+
+	OutClass.Name = Class->GetName();
+	OutClass.PathName = Class->GetPathName();
+	OutClass.CppType = GetClassCppType(Class);
+	if (UClass* SuperClass = Class->GetSuperClass())
+	{
+		OutClass.SuperPathName = SuperClass->GetPathName();
+	}
+
+	for (TFieldIterator<FProperty> PropIt(Class, EFieldIteratorFlags::ExcludeSuper); PropIt; ++PropIt)
+	{
+		FProperty* Property = *PropIt;
+		if (!Property)
+		{
+			continue;
+		}
+
+		FUnrealGPTReflectedProperty& Captured = OutClass.Properties.AddDefaulted_GetRef();
+		Captured.Name = Property->GetName();
+		Captured.CppType = Property->GetCPPType(nullptr, 0);
+		const FString UeType = Property->GetClass() ? Property->GetClass()->GetName() : TEXT("Unknown");
+		if (!UeType.Equals(TEXT("ObjectProperty")) && !UeType.Equals(TEXT("StructProperty")))
+		{
+			Captured.UeType = UeType;
+		}
+		Captured.Category = Property->GetMetaData(TEXT("Category"));
+		Captured.Tooltip = GetTooltip(Property);
+		Captured.Flags = CapturePropertyFlags(Property);
+	}
+
+	for (TFieldIterator<UFunction> FuncIt(Class, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
+	{
+		UFunction* Function = *FuncIt;
+		if (!Function)
+		{
+			continue;
+		}
+
+		FUnrealGPTReflectedFunction& Captured = OutClass.Functions.AddDefaulted_GetRef();
+		Captured.Name = Function->GetName();
+		Captured.Category = Function->GetMetaData(TEXT("Category"));
+		Captured.Tooltip = GetTooltip(Function);
+		Captured.Flags = CaptureFunctionFlags(Function);
+
+		for (TFieldIterator<FProperty> ParamIt(Function); ParamIt; ++ParamIt)
+		{
+			FProperty* ParamProp = *ParamIt;
+			if (!ParamProp)
+			{
+				continue;
+			}
+
+			if (ParamProp->HasAnyPropertyFlags(CPF_ReturnParm))
+			{
+				Captured.bHasReturn = true;
+				Captured.Return.Name = ParamProp->GetName();
+				Captured.Return.CppType = ParamProp->GetCPPType(nullptr, 0);
+				continue;
+			}
+
+			if (!ParamProp->HasAnyPropertyFlags(CPF_Parm))
+			{
+				continue;
+			}
+
+			FUnrealGPTReflectedParam& Param = Captured.Params.AddDefaulted_GetRef();
+			Param.Name = ParamProp->GetName();
+			Param.CppType = ParamProp->GetCPPType(nullptr, 0);
+			Param.bIsOut = ParamProp->HasAnyPropertyFlags(CPF_OutParm | CPF_ReferenceParm);
+		}
+	}
+}
+
+TSharedRef<FUnrealGPTReflectionSnapshot> FUnrealGPTReflectionSnapshot::CaptureNativeClasses()
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	TSharedRef<FUnrealGPTReflectionSnapshot> Snapshot = MakeShared<FUnrealGPTReflectionSnapshot>();
+	Snapshot->SnapshotId = FGuid::NewGuid();
+	Snapshot->EngineVersion = FEngineVersion::Current().ToString();
+	GatherModuleStamps(Snapshot->ModuleStamps);
+
+	for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		UClass* Class = *ClassIt;
+		if (!Class
+			|| !Class->HasAnyClassFlags(CLASS_Native)
+			|| Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		CaptureClass(Class, Snapshot->Classes.AddDefaulted_GetRef());
+	}
+
+	Snapshot->BuildLookups();
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Captured reflection snapshot of %d native classes in %.1f ms"),
+		Snapshot->Classes.Num(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+	return Snapshot;
+}
+
+void FUnrealGPTReflectionSnapshot::GatherModuleStamps(TArray<FModuleStamp>& OutStamps)
+{
+	OutStamps.Reset();
+
+	TArray<FModuleStatus> Modules;
+	FModuleManager::Get().QueryModules(Modules);
+	for (const FModuleStatus& Module : Modules)
+	{
+		if (!Module.bIsLoaded || Module.FilePath.IsEmpty())
+		{
+			continue;
+		}
+
+		FModuleStamp& Stamp = OutStamps.AddDefaulted_GetRef();
+		Stamp.Name = Module.Name;
+		Stamp.TimestampTicks = IFileManager::Get().GetTimeStamp(*Module.FilePath).GetTicks();
+	}
+}
+
+bool FUnrealGPTReflectionSnapshot::IsCurrent() const
+{
+	if (EngineVersion != FEngineVersion::Current().ToString())
+	{
+		return false;
+	}
+
+	TArray<FModuleStamp> CurrentStamps;
+	GatherModuleStamps(CurrentStamps);
+
+	TMap<FString, int64> CurrentByName;
+	for (const FModuleStamp& Stamp : CurrentStamps)
+	{
+		CurrentByName.Add(Stamp.Name, Stamp.TimestampTicks);
+	}
+
+	// Modules that are not loaded yet may still load later; only a rebuilt binary invalidates the snapshot.
+	for (const FModuleStamp& Stamp : ModuleStamps)
+	{
+		const int64* CurrentTicks = CurrentByName.Find(Stamp.Name);
+		if (CurrentTicks && *CurrentTicks != Stamp.TimestampTicks)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FUnrealGPTReflectionSnapshot::SaveToFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = FileMagic;
+	int32 Version = FileVersion;
+	int32 StampCount = ModuleStamps.Num();
+	Writer << Magic << Version << SnapshotId << EngineVersion << StampCount;
+	for (FModuleStamp& Stamp : ModuleStamps)
+	{
+		Writer << Stamp.Name << Stamp.TimestampTicks;
+	}
+
+	Writer << Classes;
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+	return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+TSharedPtr<FUnrealGPTReflectionSnapshot> FUnrealGPTReflectionSnapshot::LoadFromFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+	{
+		return nullptr;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FUnrealGPTReflectionSnapshot> Snapshot = MakeShared<FUnrealGPTReflectionSnapshot>();
+
+	int32 StampCount = 0;
+	Reader << Snapshot->SnapshotId << Snapshot->EngineVersion << StampCount;
+	if (Reader.IsError() || StampCount < 0)
+	{
+		return nullptr;
+	}
+
+	Snapshot->ModuleStamps.SetNum(StampCount);
+	for (FModuleStamp& Stamp : Snapshot->ModuleStamps)
+	{
+		Reader << Stamp.Name << Stamp.TimestampTicks;
+	}
+
+	Reader << Snapshot->Classes;
+	if (Reader.IsError())
+	{
+		return nullptr;
+	}
+
+	Snapshot->BuildLookups();
+	return Snapshot;
+}
+
+void FUnrealGPTReflectionSnapshot::BuildLookups()
+{
+	ClassByPath.Reset();
+	ClassesByLowerName.Reset();
+	ClassByPath.Reserve(Classes.Num());
+
+	for (int32 Index = 0; Index < Classes.Num(); ++Index)
+	{
+		ClassByPath.Add(Classes[Index].PathName, Index);
+		ClassesByLowerName.FindOrAdd(Classes[Index].Name.ToLower()).Add(Index);
+	}
+}
+
+const FUnrealGPTReflectedClass* FUnrealGPTReflectionSnapshot::FindByPath(const FString& PathName) const
+{
+	const int32* Index = ClassByPath.Find(PathName);
+	return Index ? &Classes[*Index] : nullptr;
+}
+
+void FUnrealGPTReflectionSnapshot::FindByName(const FString& ClassName, TArray<const FUnrealGPTReflectedClass*>& OutMatches) const
+{
+	if (const TArray<int32>* Indices = ClassesByLowerName.Find(ClassName.ToLower()))
+	{
+		for (const int32 Index : *Indices)
+		{
+			OutMatches.Add(&Classes[Index]);
+		}
+	}
+}
+
+const FUnrealGPTReflectedClass* FUnrealGPTReflectionSnapshot::FindSuper(const FUnrealGPTReflectedClass& Class) const
+{
+	return Class.SuperPathName.IsEmpty() ? nullptr : FindByPath(Class.SuperPathName);
+}
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Bits stored in FUnrealGPTReflectedProperty::Flags. */
+namespace EUnrealGPTReflectedPropertyFlags
+{
+	enum Type : uint8
+	{
+		None = 0,
+		Edit = 1 << 0,
+		BlueprintVisible = 1 << 1,
+		BlueprintReadOnly = 1 << 2,
+		BlueprintAssignable = 1 << 3,
+		Config = 1 << 4,
+		Deprecated = 1 << 5,
+		DuplicateTransient = 1 << 6
+	};
+}
+
+/** Bits stored in FUnrealGPTReflectedFunction::Flags. */
+namespace EUnrealGPTReflectedFunctionFlags
+{
+	enum Type : uint16
+	{
+		None = 0,
+		BlueprintCallable = 1 << 0,
+		BlueprintPure = 1 << 1,
+		BlueprintEvent = 1 << 2,
+		BlueprintAuthorityOnly = 1 << 3,
+		Static = 1 << 4,
+		Net = 1 << 5,
+		Delegate = 1 << 6,
+		Private = 1 << 7,
+		Protected = 1 << 8,
+		Deprecated = 1 << 9
+	};
+}
+
+struct UNREALGPTEDITOR_API FUnrealGPTReflectedProperty
+{
+	FString Name;
+	FString CppType;
+	/** FProperty class name; empty for ObjectProperty/StructProperty, which cpp_type already describes. */
+	FString UeType;
+	FString Category;
+	FString Tooltip;
+	uint8 Flags = 0;
+
+	/** Exposed to the editor, Blueprint or Python. */
+	bool IsScriptable(bool bIncludeDeprecated) const;
+};
+
+struct FUnrealGPTReflectedParam
+{
+	FString Name;
+	FString CppType;
+	bool bIsOut = false;
+};
+
+struct UNREALGPTEDITOR_API FUnrealGPTReflectedFunction
+{
+	FString Name;
+	FString Category;
+	FString Tooltip;
+	uint16 Flags = 0;
+	TArray<FUnrealGPTReflectedParam> Params;
+	bool bHasReturn = false;
+	FUnrealGPTReflectedParam Return;
+
+	/** Callable or overridable from Blueprint or Python. */
+	bool IsScriptable(bool bIncludeDeprecated) const;
+};
+
+/** Members declared directly on one class; inherited members live on the super class records. */
+struct FUnrealGPTReflectedClass
+{
+	FString Name;
+	FString PathName;
+	FString CppType;
+	FString SuperPathName;
+	TArray<FUnrealGPTReflectedProperty> Properties;
+	TArray<FUnrealGPTReflectedFunction> Functions;
+};
+
+/**
+ * UObject-free copy of the reflected schema of every native class, persisted under
+ * Saved/UnrealGPT so later editor sessions can answer reflection_query without walking UClasses.
+ * Snapshots are keyed by engine version and the timestamps of the module binaries they were
+ * captured from. A loaded snapshot is immutable, so lookups are safe from any thread.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTReflectionSnapshot
+{
+public:
+	static constexpr uint32 FileMagic = 0x53524755; // "UGRS"
+	static constexpr int32 FileVersion = 2;
+
+	/** Tooltips longer than this are cut when captured. */
+	static constexpr int32 MaxTooltipChars = 300;
+
+	static FString GetDefaultFilePath();
+
+	/** Copy the members declared on Class. Game thread only. */
+	static void CaptureClass(UClass* Class, FUnrealGPTReflectedClass& OutClass);
+
+	/** Capture every loaded native class. Game thread only. */
+	static TSharedRef<FUnrealGPTReflectionSnapshot> CaptureNativeClasses();
+
+	/** Load a snapshot written by SaveToFile. Returns null when missing, corrupt or from another format version. */
+	static TSharedPtr<FUnrealGPTReflectionSnapshot> LoadFromFile(const FString& FilePath);
+
+	bool SaveToFile(const FString& FilePath);
+
+	/** True when the engine version and every recorded module binary still match. */
+	bool IsCurrent() const;
+
+	const FUnrealGPTReflectedClass* FindByPath(const FString& PathName) const;
+	void FindByName(const FString& ClassName, TArray<const FUnrealGPTReflectedClass*>& OutMatches) const;
+	const FUnrealGPTReflectedClass* FindSuper(const FUnrealGPTReflectedClass& Class) const;
+	const TArray<FUnrealGPTReflectedClass>& GetClasses() const { return Classes; }
+
+	/** Unique per capture; data derived from a snapshot records it to detect a stale pairing. */
+	const FGuid& GetSnapshotId() const { return SnapshotId; }
+
+private:
+	struct FModuleStamp
+	{
+		FString Name;
+		int64 TimestampTicks = 0;
+	};
+
+	void BuildLookups();
+	static void GatherModuleStamps(TArray<FModuleStamp>& OutStamps);
+
+	FGuid SnapshotId;
+	FString EngineVersion;
+	TArray<FModuleStamp> ModuleStamps;
+	TArray<FUnrealGPTReflectedClass> Classes;
+	TMap<FString, int32> ClassByPath;
+	TMap<FString, TArray<int32>> ClassesByLowerName;
+};
@@ -0,0 +1,349 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTReplicateClient.h"
+#include "Dom/JsonObject.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace UnrealGPTReplicateClientPrivate
+{
+	static constexpr double FirstPollDelaySeconds = 0.5;
+	static constexpr double MaxPollDelaySeconds = 8.0;
+
+	static bool IsRetryableStatus(int32 ResponseCode)
+	{
+		return ResponseCode == 429 || ResponseCode >= 500;
+	}
+}
+
+FUnrealGPTReplicateClient& FUnrealGPTReplicateClient::Get()
+{
+	static FUnrealGPTReplicateClient Instance;
+	return Instance;
+}
+
+FUnrealGPTReplicateClient::FUnrealGPTReplicateClient()
+{
+	Wheel.SetNum(WheelSlots);
+}
+
+void FUnrealGPTReplicateClient::Shutdown()
+{
+	for (TPair<uint32, FPrediction>& Pair : Predictions)
+	{
+		if (Pair.Value.Request.IsValid())
+		{
+			Pair.Value.Request->OnProcessRequestComplete().Unbind();
+			Pair.Value.Request->CancelRequest();
+		}
+	}
+	Predictions.Empty();
+
+	for (TArray<uint32>& Slot : Wheel)
+	{
+		Slot.Reset();
+	}
+
+	if (WheelTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(WheelTickerHandle);
+		WheelTickerHandle.Reset();
+	}
+}
+
+double FUnrealGPTReplicateClient::GetPollDelaySeconds(int32 Attempt)
+{
+	using namespace UnrealGPTReplicateClientPrivate;
+	return FMath::Min(MaxPollDelaySeconds, FirstPollDelaySeconds * FMath::Pow(2.0, FMath::Clamp(Attempt, 0, 16)));
+}
+
+uint32 FUnrealGPTReplicateClient::CreatePrediction(const FString& Url, const FString& ApiToken, const FString& RequestBody, FOnComplete OnComplete)
+{
+	check(IsInGameThread());
+
+	const uint32 PredictionId = NextPredictionId++;
+
+	FPrediction& Prediction = Predictions.Add(PredictionId);
+	Prediction.ApiToken = ApiToken;
+	Prediction.OnComplete = MoveTemp(OnComplete);
+	Prediction.Deadline = FPlatformTime::Seconds() + MaxPredictionSeconds;
+
+	// Replicate holds the response open until the prediction finishes or the wait runs out,
+	// in which case it returns the still-running prediction and we fall back to polling.
+	TSharedRef<IHttpRequest> Request = CreateRequest(Url, TEXT("POST"), ApiToken);
+	Request->SetHeader(TEXT("Prefer"), FString::Printf(TEXT("wait=%d"), PreferWaitSeconds));
+	Request->SetTimeout(PreferWaitSeconds + 15.0f);
+	Request->SetContentAsString(RequestBody);
+	Request->OnProcessRequestComplete().BindLambda(
+		[this, PredictionId](FHttpRequestPtr, FHttpResponsePtr Response, bool bWasSuccessful)
+		{
+			HandleResponse(PredictionId, Response, bWasSuccessful);
+		});
+
+	Prediction.Request = Request;
+	Request->ProcessRequest();
+	return PredictionId;
+}
+
+void FUnrealGPTReplicateClient::Cancel(uint32 PredictionId)
+{
+	FPrediction* Prediction = Predictions.Find(PredictionId);
+	if (!Prediction)
+	{
+		return;
+	}
+
+	if (Prediction->Request.IsValid())
+	{
+		Prediction->Request->OnProcessRequestComplete().Unbind();
+		Prediction->Request->CancelRequest();
+		Prediction->Request.Reset();
+	}
+
+	// Without a cancel URL the creation request is still in flight and Replicate has not told us the
+	// prediction id yet; dropping it locally is all we can do.
+	if (!Prediction->CancelUrl.IsEmpty())
+	{
+		SendRemoteCancel(Prediction->CancelUrl, Prediction->ApiToken);
+	}
+
+	FUnrealGPTReplicateResult Result;
+	Result.bCanceled = true;
+	Result.Error = TEXT("Replicate prediction canceled");
+	Complete(PredictionId, MoveTemp(Result));
+}
+
+TSharedRef<IHttpRequest> FUnrealGPTReplicateClient::CreateRequest(const FString& Url, const FString& Verb, const FString& ApiToken) const
+{
+	TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Url);
+	Request->SetVerb(Verb);
+	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	// Replicate HTTP API expects Bearer tokens: Authorization: Bearer <token>
+	Request->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *ApiToken));
+	return Request;
+}
+
+void FUnrealGPTReplicateClient::SendPoll(uint32 PredictionId)
+{
+	FPrediction* Prediction = Predictions.Find(PredictionId);
+	if (!Prediction)
+	{
+		return;
+	}
+
+	if (FPlatformTime::Seconds() > Prediction->Deadline)
+	{
+		SendRemoteCancel(Prediction->CancelUrl, Prediction->ApiToken);
+
+		FUnrealGPTReplicateResult Result;
+		Result.Error = FString::Printf(TEXT("Replicate prediction timed out after %.0f seconds"), MaxPredictionSeconds);
+		Complete(PredictionId, MoveTemp(Result));
+		return;
+	}
+
+	TSharedRef<IHttpRequest> Request = CreateRequest(Prediction->GetUrl, TEXT("GET"), Prediction->ApiToken);
+	Request->SetTimeout(30.0f);
+	Request->OnProcessRequestComplete().BindLambda(
+		[this, PredictionId](FHttpRequestPtr, FHttpResponsePtr Response, bool bWasSuccessful)
+		{
+			HandleResponse(PredictionId, Response, bWasSuccessful);
+		});
+
+	Prediction->Request = Request;
+	Request->ProcessRequest();
+}
+
+void FUnrealGPTReplicateClient::HandleResponse(uint32 PredictionId, FHttpResponsePtr Response, bool bWasSuccessful)
+{
+	using namespace UnrealGPTReplicateClientPrivate;
+
+	FPrediction* Prediction = Predictions.Find(PredictionId);
+	if (!Prediction)
+	{
+		return;
+	}
+	Prediction->Request.Reset();
+
+	const bool bCreating = Prediction->GetUrl.IsEmpty();
+	const int32 ResponseCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+	const FString Content = Response.IsValid() ? Response->GetContentAsString() : FString();
+
+	if (!bWasSuccessful || !Response.IsValid() || IsRetryableStatus(ResponseCode))
+	{
+		// A failed poll leaves the prediction running on Replicate, so try again later. A failed creation
+		// is not retried: the request may have reached Replicate and a second one would run the model twice.
+		if (!bCreating)
+		{
+			SchedulePoll(PredictionId, GetPollDelaySeconds(Prediction->PollAttempt++));
+			return;
+		}
+
+		FUnrealGPTReplicateResult Result;
+		Result.Error = Response.IsValid()
+			? FString::Printf(TEXT("Failed to create Replicate prediction (HTTP %d): %s"), ResponseCode, *Content)
+			: TEXT("Failed to create Replicate prediction: connection failed");
+		Complete(PredictionId, MoveTemp(Result));
+		return;
+	}
+
+	if (ResponseCode < 200 || ResponseCode >= 300)
+	{
+		FUnrealGPTReplicateResult Result;
+		Result.Error = FString::Printf(TEXT("%s Replicate prediction failed (HTTP %d): %s"),
+			bCreating ? TEXT("Creating") : TEXT("Polling"), ResponseCode, *Content);
+		Complete(PredictionId, MoveTemp(Result));
+		return;
+	}
+
+	TSharedPtr<FJsonObject> PredictionObj;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+	if (!(FJsonSerializer::Deserialize(Reader, PredictionObj) && PredictionObj.IsValid()))
+	{
+		FUnrealGPTReplicateResult Result;
+		Result.Error = TEXT("Failed to parse Replicate prediction response");
+		Complete(PredictionId, MoveTemp(Result));
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* UrlsObj = nullptr;
+	if (PredictionObj->TryGetObjectField(TEXT("urls"), UrlsObj) && UrlsObj && UrlsObj->IsValid())
+	{
+		if (Prediction->GetUrl.IsEmpty())
+		{
+			(*UrlsObj)->TryGetStringField(TEXT("get"), Prediction->GetUrl);
+		}
+		if (Prediction->CancelUrl.IsEmpty())
+		{
+			(*UrlsObj)->TryGetStringField(TEXT("cancel"), Prediction->CancelUrl);
+		}
+	}
+
+	FString Status;
+	PredictionObj->TryGetStringField(TEXT("status"), Status);
+
+	if (Status == TEXT("succeeded"))
+	{
+		FUnrealGPTReplicateResult Result;
+		Result.bSuccess = true;
+		Result.Prediction = PredictionObj;
+		Complete(PredictionId, MoveTemp(Result));
+		return;
+	}
+
+	if (Status == TEXT("failed") || Status == TEXT("canceled"))
+	{
+		FString ErrorMsg;
+		PredictionObj->TryGetStringField(TEXT("error"), ErrorMsg);
+
+		FUnrealGPTReplicateResult Result;
+		Result.Error = FString::Printf(TEXT("Replicate prediction %s: %s"), *Status, *ErrorMsg);
+		Complete(PredictionId, MoveTemp(Result));
+		return;
+	}
+
+	if (Prediction->GetUrl.IsEmpty())
+	{
+		FUnrealGPTReplicateResult Result;
+		Result.Error = TEXT("Replicate response did not include a poll URL");
+		Complete(PredictionId, MoveTemp(Result));
+		return;
+	}
+
+	SchedulePoll(PredictionId, GetPollDelaySeconds(Prediction->PollAttempt++));
+}
+
+void FUnrealGPTReplicateClient::SchedulePoll(uint32 PredictionId, double DelaySeconds)
+{
+	FPrediction* Prediction = Predictions.Find(PredictionId);
+	if (!Prediction)
+	{
+		return;
+	}
+
+	const int32 Ticks = FMath::Max(1, FMath::CeilToInt(DelaySeconds / WheelSlotSeconds));
+	Prediction->RoundsRemaining = (Ticks - 1) / WheelSlots;
+	Wheel[(WheelCursor + Ticks) % WheelSlots].Add(PredictionId);
+
+	if (!WheelTickerHandle.IsValid())
+	{
+		WheelElapsed = 0.0;
+		WheelTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FUnrealGPTReplicateClient::TickWheel),
+			static_cast<float>(WheelSlotSeconds));
+	}
+}
+
+bool FUnrealGPTReplicateClient::TickWheel(float DeltaTime)
+{
+	WheelElapsed += DeltaTime;
+
+	TArray<uint32, TInlineAllocator<8>> Due;
+	while (WheelElapsed >= WheelSlotSeconds)
+	{
+		WheelElapsed -= WheelSlotSeconds;
+		WheelCursor = (WheelCursor + 1) % WheelSlots;
+
+		TArray<uint32>& Slot = Wheel[WheelCursor];
+		for (int32 Index = Slot.Num() - 1; Index >= 0; --Index)
+		{
+			FPrediction* Prediction = Predictions.Find(Slot[Index]);
+			if (Prediction && Prediction->RoundsRemaining > 0)
+			{
+				--Prediction->RoundsRemaining;
+				continue;
+			}
+
+			// Completed or canceled predictions are dropped here rather than searched for on removal
+			if (Prediction)
+			{
+				Due.Add(Slot[Index]);
+			}
+			Slot.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	for (const uint32 PredictionId : Due)
+	{
+		SendPoll(PredictionId);
+	}
+
+	for (const TArray<uint32>& Slot : Wheel)
+	{
+		if (Slot.Num() > 0)
+		{
+			return true;
+		}
+	}
+
+	WheelTickerHandle.Reset();
+	return false;
+}
+
+void FUnrealGPTReplicateClient::Complete(uint32 PredictionId, FUnrealGPTReplicateResult&& Result)
+{
+	FPrediction Prediction;
+	if (!Predictions.RemoveAndCopyValue(PredictionId, Prediction))
+	{
+		return;
+	}
+
+	if (Prediction.OnComplete)
+	{
+		Prediction.OnComplete(Result);
+	}
+}
+
+void FUnrealGPTReplicateClient::SendRemoteCancel(const FString& CancelUrl, const FString& ApiToken) const
+{
+	if (CancelUrl.IsEmpty())
+	{
+		return;
+	}
+
+	// Fire and forget: the HTTP manager keeps the request alive until it finishes.
+	TSharedRef<IHttpRequest> Request = CreateRequest(CancelUrl, TEXT("POST"), ApiToken);
+	Request->ProcessRequest();
+}
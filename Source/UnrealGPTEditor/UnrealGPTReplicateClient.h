@@ -0,0 +1,90 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+
+class FJsonObject;
+
+/** Final state of a Replicate prediction. */
+struct FUnrealGPTReplicateResult
+{
+	bool bSuccess = false;
+	/** Canceled through FUnrealGPTReplicateClient::Cancel rather than failed. */
+	bool bCanceled = false;
+	FString Error;
+	/** Last prediction object returned by Replicate; set on success. */
+	TSharedPtr<FJsonObject> Prediction;
+};
+
+/**
+ * Callback-driven Replicate predictions client. Creating a prediction asks Replicate to hold the response
+ * until the prediction finishes ("Prefer: wait"), so short generations need a single request. Longer ones
+ * are polled with exponential backoff from a timer wheel advanced by one core ticker, so any number of
+ * predictions can be followed without occupying a thread. Game thread only.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTReplicateClient
+{
+public:
+	using FOnComplete = TFunction<void(const FUnrealGPTReplicateResult& Result)>;
+
+	/** Longest "Prefer: wait" Replicate honours. */
+	static constexpr int32 PreferWaitSeconds = 60;
+	static constexpr double MaxPredictionSeconds = 300.0;
+	static constexpr double WheelSlotSeconds = 0.25;
+	static constexpr int32 WheelSlots = 64;
+
+	static FUnrealGPTReplicateClient& Get();
+
+	/** Drop all predictions without calling back. */
+	void Shutdown();
+
+	/**
+	 * POST RequestBody to Url and follow the prediction until it succeeds, fails, is canceled or runs past
+	 * MaxPredictionSeconds. OnComplete is called exactly once unless the client shuts down first.
+	 * Returns an id for Cancel.
+	 */
+	uint32 CreatePrediction(const FString& Url, const FString& ApiToken, const FString& RequestBody, FOnComplete OnComplete);
+
+	/** Stop following a prediction, ask Replicate to cancel it and complete it as canceled. */
+	void Cancel(uint32 PredictionId);
+
+	bool IsActive(uint32 PredictionId) const { return Predictions.Contains(PredictionId); }
+	int32 GetNumActive() const { return Predictions.Num(); }
+
+	/** Delay before poll number Attempt (0-based): 0.5 s doubling up to 8 s. */
+	static double GetPollDelaySeconds(int32 Attempt);
+
+private:
+	FUnrealGPTReplicateClient();
+
+	struct FPrediction
+	{
+		FString ApiToken;
+		FString GetUrl;
+		FString CancelUrl;
+		FOnComplete OnComplete;
+		FHttpRequestPtr Request;
+		double Deadline = 0.0;
+		int32 PollAttempt = 0;
+		/** Full wheel turns left before the scheduled poll is due. */
+		int32 RoundsRemaining = 0;
+	};
+
+	TSharedRef<IHttpRequest> CreateRequest(const FString& Url, const FString& Verb, const FString& ApiToken) const;
+	void SendPoll(uint32 PredictionId);
+	void HandleResponse(uint32 PredictionId, FHttpResponsePtr Response, bool bWasSuccessful);
+	void SchedulePoll(uint32 PredictionId, double DelaySeconds);
+	bool TickWheel(float DeltaTime);
+	void Complete(uint32 PredictionId, FUnrealGPTReplicateResult&& Result);
+	void SendRemoteCancel(const FString& CancelUrl, const FString& ApiToken) const;
+
+	TMap<uint32, FPrediction> Predictions;
+	TArray<TArray<uint32>> Wheel;
+	int32 WheelCursor = 0;
+	double WheelElapsed = 0.0;
+	FTSTicker::FDelegateHandle WheelTickerHandle;
+	uint32 NextPredictionId = 1;
+};
@@ -0,0 +1,184 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTScreenshotPipeline.h"
+#include "Async/Async.h"
+#include "Engine/Texture2D.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "ImageUtils.h"
+#include "Misc/Base64.h"
+#include "Modules/ModuleManager.h"
+#include "TextureResource.h"
+
+FUnrealGPTThumbnailPtr FUnrealGPTScreenshotPipeline::DecodeThumbnail(const FString& Base64Png, int32 MaxWidth, int32 MaxHeight)
+{
+	IImageWrapperModule* ImageWrapperModule = IsInGameThread()
+		? &FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"))
+		: FModuleManager::GetModulePtr<IImageWrapperModule>(FName("ImageWrapper"));
+	if (!ImageWrapperModule)
+	{
+		return nullptr;
+	}
+
+	TArray<uint8> PngData;
+	if (!FBase64::Decode(Base64Png, PngData))
+	{
+		return nullptr;
+	}
+
+	const TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule->CreateImageWrapper(EImageFormat::PNG);
+	TArray<uint8> RawBGRA;
+	if (!ImageWrapper.IsValid()
+		|| !ImageWrapper->SetCompressed(PngData.GetData(), PngData.Num())
+		|| !ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, RawBGRA))
+	{
+		return nullptr;
+	}
+	PngData.Empty();
+
+	const FIntPoint SourceSize(static_cast<int32>(ImageWrapper->GetWidth()), static_cast<int32>(ImageWrapper->GetHeight()));
+	if (SourceSize.X <= 0 || SourceSize.Y <= 0 || RawBGRA.Num() != SourceSize.X * SourceSize.Y * static_cast<int32>(sizeof(FColor)))
+	{
+		return nullptr;
+	}
+
+	// FColor is laid out as BGRA, so the decoded buffer can be copied in one block.
+	TArray<FColor> SourcePixels;
+	SourcePixels.SetNumUninitialized(SourceSize.X * SourceSize.Y);
+	FMemory::Memcpy(SourcePixels.GetData(), RawBGRA.GetData(), RawBGRA.Num());
+	RawBGRA.Empty();
+
+	const TSharedRef<FUnrealGPTThumbnail, ESPMode::ThreadSafe> Thumbnail = MakeShared<FUnrealGPTThumbnail, ESPMode::ThreadSafe>();
+	Thumbnail->SourceSize = SourceSize;
+
+	const double Scale = FMath::Min(1.0, FMath::Min(
+		static_cast<double>(MaxWidth) / SourceSize.X,
+		static_cast<double>(MaxHeight) / SourceSize.Y));
+	if (Scale >= 1.0)
+	{
+		Thumbnail->Size = SourceSize;
+		Thumbnail->Pixels = MoveTemp(SourcePixels);
+	}
+	else
+	{
+		Thumbnail->Size = FIntPoint(
+			FMath::Max(1, FMath::RoundToInt(SourceSize.X * Scale)),
+			FMath::Max(1, FMath::RoundToInt(SourceSize.Y * Scale)));
+		FImageUtils::ImageResize(SourceSize.X, SourceSize.Y, SourcePixels, Thumbnail->Size.X, Thumbnail->Size.Y, Thumbnail->Pixels, /*bLinearSpace*/ false, /*bForceOpaqueOutput*/ true);
+	}
+
+	return Thumbnail;
+}
+
+void FUnrealGPTScreenshotPipeline::DecodeThumbnailAsync(FString Base64Png, TFunction<void(FUnrealGPTThumbnailPtr)> OnDecoded)
+{
+	// Load the image wrapper module here; workers may only look it up.
+	FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+	Async(EAsyncExecution::ThreadPool, [Base64Png = MoveTemp(Base64Png), OnDecoded = MoveTemp(OnDecoded)]() mutable
+	{
+		FUnrealGPTThumbnailPtr Thumbnail = DecodeThumbnail(Base64Png);
+		AsyncTask(ENamedThreads::GameThread, [Thumbnail = MoveTemp(Thumbnail), OnDecoded = MoveTemp(OnDecoded)]()
+		{
+			OnDecoded(Thumbnail);
+		});
+	});
+}
+
+FUnrealGPTThumbnailPool::FLease::~FLease()
+{
+	if (const TSharedPtr<FUnrealGPTThumbnailPool> PinnedPool = Pool.Pin())
+	{
+		PinnedPool->Release(SlotIndex);
+	}
+}
+
+TSharedPtr<FUnrealGPTThumbnailPool::FLease> FUnrealGPTThumbnailPool::Acquire(const FUnrealGPTThumbnailPtr& Thumbnail)
+{
+	check(IsInGameThread());
+
+	if (!Thumbnail.IsValid() || Thumbnail->Size.X > FUnrealGPTScreenshotPipeline::ThumbnailMaxWidth
+		|| Thumbnail->Size.Y > FUnrealGPTScreenshotPipeline::ThumbnailMaxHeight
+		|| Thumbnail->Pixels.Num() != Thumbnail->Size.X * Thumbnail->Size.Y)
+	{
+		return nullptr;
+	}
+
+	// Prefer an idle texture, then an empty slot, then a new slot
+	int32 SlotIndex = Slots.IndexOfByPredicate([](const FSlot& Slot) { return !Slot.bInUse && Slot.Texture.IsValid(); });
+	if (SlotIndex == INDEX_NONE)
+	{
+		SlotIndex = Slots.IndexOfByPredicate([](const FSlot& Slot) { return !Slot.bInUse; });
+	}
+	if (SlotIndex == INDEX_NONE)
+	{
+		SlotIndex = Slots.AddDefaulted();
+	}
+
+	FSlot& Slot = Slots[SlotIndex];
+	if (!Slot.Texture.IsValid())
+	{
+		UTexture2D* Texture = UTexture2D::CreateTransient(
+			FUnrealGPTScreenshotPipeline::ThumbnailMaxWidth,
+			FUnrealGPTScreenshotPipeline::ThumbnailMaxHeight,
+			PF_B8G8R8A8);
+		if (!Texture)
+		{
+			return nullptr;
+		}
+		Texture->SRGB = true;
+		Texture->UpdateResource();
+		Slot.Texture.Reset(Texture);
+	}
+	Slot.bInUse = true;
+
+	// One region update; the render thread reads the thumbnail's pixels directly, so the thumbnail is kept
+	// alive until the copy has been made.
+	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, Thumbnail->Size.X, Thumbnail->Size.Y);
+	FUnrealGPTThumbnailPtr* KeepAlive = new FUnrealGPTThumbnailPtr(Thumbnail);
+	Slot.Texture->UpdateTextureRegions(
+		0,
+		1,
+		Region,
+		Thumbnail->Size.X * sizeof(FColor),
+		sizeof(FColor),
+		const_cast<uint8*>(reinterpret_cast<const uint8*>(Thumbnail->Pixels.GetData())),
+		[KeepAlive](uint8*, const FUpdateTextureRegion2D* Regions)
+		{
+			delete Regions;
+			delete KeepAlive;
+		});
+
+	const TSharedRef<FLease> Lease = MakeShared<FLease>();
+	Lease->Pool = AsShared();
+	Lease->SlotIndex = SlotIndex;
+	Lease->Brush.SetResourceObject(Slot.Texture.Get());
+	Lease->Brush.ImageSize = FVector2D(Thumbnail->Size.X, Thumbnail->Size.Y);
+	Lease->Brush.ImageType = ESlateBrushImageType::FullColor;
+	Lease->Brush.SetUVRegion(FBox2f(
+		FVector2f::ZeroVector,
+		FVector2f(
+			static_cast<float>(Thumbnail->Size.X) / FUnrealGPTScreenshotPipeline::ThumbnailMaxWidth,
+			static_cast<float>(Thumbnail->Size.Y) / FUnrealGPTScreenshotPipeline::ThumbnailMaxHeight)));
+	return Lease;
+}
+
+void FUnrealGPTThumbnailPool::Release(int32 SlotIndex)
+{
+	if (!Slots.IsValidIndex(SlotIndex))
+	{
+		return;
+	}
+
+	Slots[SlotIndex].bInUse = false;
+
+	int32 NumIdle = 0;
+	for (const FSlot& Slot : Slots)
+	{
+		NumIdle += (!Slot.bInUse && Slot.Texture.IsValid()) ? 1 : 0;
+	}
+	if (NumIdle > MaxIdleSlots)
+	{
+		Slots[SlotIndex].Texture.Reset();
+	}
+}
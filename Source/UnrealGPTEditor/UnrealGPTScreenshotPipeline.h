@@ -0,0 +1,82 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Styling/SlateBrush.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UTexture2D;
+
+/** A screenshot decoded and downscaled for display in the chat transcript. */
+struct FUnrealGPTThumbnail
+{
+	FIntPoint Size = FIntPoint::ZeroValue;
+
+	/** Capture size before downscaling. */
+	FIntPoint SourceSize = FIntPoint::ZeroValue;
+
+	TArray<FColor> Pixels;
+};
+
+using FUnrealGPTThumbnailPtr = TSharedPtr<const FUnrealGPTThumbnail, ESPMode::ThreadSafe>;
+
+/** Decodes base64 PNG screenshots into display-size thumbnails away from the game thread. */
+class UNREALGPTEDITOR_API FUnrealGPTScreenshotPipeline
+{
+public:
+	static constexpr int32 ThumbnailMaxWidth = 800;
+	static constexpr int32 ThumbnailMaxHeight = 600;
+
+	/** Base64 decode, PNG decode and downscale to fit MaxWidth x MaxHeight. Any thread; null on failure. */
+	static FUnrealGPTThumbnailPtr DecodeThumbnail(const FString& Base64Png, int32 MaxWidth = ThumbnailMaxWidth, int32 MaxHeight = ThumbnailMaxHeight);
+
+	/** DecodeThumbnail on the thread pool; OnDecoded runs on the game thread, with null on failure. */
+	static void DecodeThumbnailAsync(FString Base64Png, TFunction<void(FUnrealGPTThumbnailPtr)> OnDecoded);
+};
+
+/**
+ * Fixed-size transient textures shared by the transcript's screenshot rows. A realized row leases a slot,
+ * uploads its thumbnail with a single region update and draws the used sub-rectangle through the brush UV
+ * region. The slot returns to the pool when the lease is destroyed, so textures are only allocated for the
+ * rows on screen. Game thread only.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTThumbnailPool : public TSharedFromThis<FUnrealGPTThumbnailPool>
+{
+public:
+	/** Idle textures kept for reuse; further released slots are freed. */
+	static constexpr int32 MaxIdleSlots = 4;
+
+	class FLease
+	{
+	public:
+		~FLease();
+
+		const FSlateBrush* GetBrush() const { return &Brush; }
+
+	private:
+		friend class FUnrealGPTThumbnailPool;
+
+		TWeakPtr<FUnrealGPTThumbnailPool> Pool;
+		int32 SlotIndex = INDEX_NONE;
+		FSlateBrush Brush;
+	};
+
+	/** Lease a texture slot holding Thumbnail; null if the texture could not be created. */
+	TSharedPtr<FLease> Acquire(const FUnrealGPTThumbnailPtr& Thumbnail);
+
+	int32 GetNumSlots() const { return Slots.Num(); }
+
+	int32 GetNumLeased() const { return Slots.FilterByPredicate([](const FSlot& Slot) { return Slot.bInUse; }).Num(); }
+
+private:
+	struct FSlot
+	{
+		TStrongObjectPtr<UTexture2D> Texture;
+		bool bInUse = false;
+	};
+
+	void Release(int32 SlotIndex);
+
+	TArray<FSlot> Slots;
+};
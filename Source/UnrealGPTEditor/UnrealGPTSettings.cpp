@@ -1,119 +1,12 @@
 // Copyright (c) 2025 TREE Industries.
 
 #include "UnrealGPTSettings.h"
+#include "UnrealGPTCodexAuth.h"
 #include "HAL/PlatformFileManager.h"
-#include "Misc/Base64.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
-namespace
-{
-	bool LoadCodexAuthJson(const UUnrealGPTSettings& Settings, TSharedPtr<FJsonObject>& OutAuthJson, FString& OutError)
-	{
-		const FString AuthPath = Settings.GetResolvedCodexAuthFilePath();
-		if (AuthPath.IsEmpty())
-		{
-			OutError = TEXT("Could not resolve Codex auth file path.");
-			return false;
-		}
-
-		FString AuthJsonText;
-		if (!FFileHelper::LoadFileToString(AuthJsonText, *AuthPath))
-		{
-			OutError = FString::Printf(
-				TEXT("Codex auth file not found or unreadable: %s. Use the UnrealGPT Codex Login button to sign in."),
-				*AuthPath);
-			return false;
-		}
-
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(AuthJsonText);
-		if (!FJsonSerializer::Deserialize(Reader, OutAuthJson) || !OutAuthJson.IsValid())
-		{
-			OutError = FString::Printf(TEXT("Codex auth file is not valid JSON: %s"), *AuthPath);
-			return false;
-		}
-
-		return true;
-	}
-
-	bool TryGetCodexApiKey(const TSharedPtr<FJsonObject>& AuthJson, FString& OutApiKey)
-	{
-		return AuthJson.IsValid()
-			&& AuthJson->TryGetStringField(TEXT("OPENAI_API_KEY"), OutApiKey)
-			&& !OutApiKey.IsEmpty();
-	}
-
-	bool TryGetCodexChatGPTTokens(const TSharedPtr<FJsonObject>& AuthJson, FString& OutAccessToken, FString& OutAccountId)
-	{
-		if (!AuthJson.IsValid())
-		{
-			return false;
-		}
-
-		const TSharedPtr<FJsonObject>* TokensObject = nullptr;
-		if (!AuthJson->TryGetObjectField(TEXT("tokens"), TokensObject) || !TokensObject || !TokensObject->IsValid())
-		{
-			return false;
-		}
-
-		(*TokensObject)->TryGetStringField(TEXT("access_token"), OutAccessToken);
-		(*TokensObject)->TryGetStringField(TEXT("account_id"), OutAccountId);
-		return !OutAccessToken.IsEmpty();
-	}
-
-	bool TryGetCodexRefreshToken(const TSharedPtr<FJsonObject>& AuthJson, FString& OutRefreshToken)
-	{
-		if (!AuthJson.IsValid())
-		{
-			return false;
-		}
-
-		const TSharedPtr<FJsonObject>* TokensObject = nullptr;
-		if (!AuthJson->TryGetObjectField(TEXT("tokens"), TokensObject) || !TokensObject || !TokensObject->IsValid())
-		{
-			return false;
-		}
-
-		(*TokensObject)->TryGetStringField(TEXT("refresh_token"), OutRefreshToken);
-		return !OutRefreshToken.IsEmpty();
-	}
-
-	FString ExtractJwtStringClaim(const FString& Jwt, const FString& ClaimName)
-	{
-		TArray<FString> Parts;
-		Jwt.ParseIntoArray(Parts, TEXT("."), false);
-		if (Parts.Num() < 2)
-		{
-			return FString();
-		}
-
-		FString Payload = Parts[1].Replace(TEXT("-"), TEXT("+")).Replace(TEXT("_"), TEXT("/"));
-		while (Payload.Len() % 4 != 0)
-		{
-			Payload += TEXT("=");
-		}
-
-		FString PayloadJsonText;
-		if (!FBase64::Decode(Payload, PayloadJsonText))
-		{
-			return FString();
-		}
-
-		TSharedPtr<FJsonObject> PayloadJson;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(PayloadJsonText);
-		if (!FJsonSerializer::Deserialize(Reader, PayloadJson) || !PayloadJson.IsValid())
-		{
-			return FString();
-		}
-
-		FString ClaimValue;
-		PayloadJson->TryGetStringField(ClaimName, ClaimValue);
-		return ClaimValue;
-	}
-}
-
 UUnrealGPTSettings::UUnrealGPTSettings(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -137,34 +30,29 @@ bool UUnrealGPTSettings::ResolveAuthHeaders(FString& OutBearerToken, FString& Ou
 		return true;
 	}
 
-	TSharedPtr<FJsonObject> AuthJson;
-	if (!LoadCodexAuthJson(*this, AuthJson, OutError))
+	const FUnrealGPTCodexAuth::FCredentialsPtr Credentials = FUnrealGPTCodexAuth::Get().GetCredentials(GetResolvedCodexAuthFilePath());
+	if (!Credentials->IsValid())
 	{
+		OutError = Credentials->Error;
 		return false;
 	}
 
-	FString AuthMode;
-	AuthJson->TryGetStringField(TEXT("auth_mode"), AuthMode);
-
-	FString CodexApiKey;
-	if (TryGetCodexApiKey(AuthJson, CodexApiKey))
+	if (!Credentials->ApiKey.IsEmpty())
 	{
-		OutBearerToken = CodexApiKey;
+		OutBearerToken = Credentials->ApiKey;
 		return true;
 	}
 
-	FString AccessToken;
-	FString AccountId;
-	if (TryGetCodexChatGPTTokens(AuthJson, AccessToken, AccountId))
+	if (!Credentials->AccessToken.IsEmpty())
 	{
-		OutBearerToken = AccessToken;
-		OutChatGPTAccountId = AccountId;
+		OutBearerToken = Credentials->AccessToken;
+		OutChatGPTAccountId = Credentials->AccountId;
 		return true;
 	}
 
 	OutError = FString::Printf(
 		TEXT("Codex auth file does not contain a usable OPENAI_API_KEY or tokens.access_token (auth_mode: %s)."),
-		AuthMode.IsEmpty() ? TEXT("unknown") : *AuthMode);
+		Credentials->AuthMode.IsEmpty() ? TEXT("unknown") : *Credentials->AuthMode);
 	return false;
 }
 
@@ -175,16 +63,7 @@ bool UUnrealGPTSettings::IsUsingCodexChatGPTAuth() const
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> AuthJson;
-	FString Error;
-	if (!LoadCodexAuthJson(*this, AuthJson, Error))
-	{
-		return false;
-	}
-
-	FString AccessToken;
-	FString AccountId;
-	return TryGetCodexChatGPTTokens(AuthJson, AccessToken, AccountId);
+	return FUnrealGPTCodexAuth::Get().GetCredentials(GetResolvedCodexAuthFilePath())->HasChatGPTTokens();
 }
 
 bool UUnrealGPTSettings::GetCodexRefreshToken(FString& OutRefreshToken, FString& OutError) const
@@ -192,18 +71,20 @@ bool UUnrealGPTSettings::GetCodexRefreshToken(FString& OutRefreshToken, FString&
 	OutRefreshToken.Empty();
 	OutError.Empty();
 
-	TSharedPtr<FJsonObject> AuthJson;
-	if (!LoadCodexAuthJson(*this, AuthJson, OutError))
+	const FUnrealGPTCodexAuth::FCredentialsPtr Credentials = FUnrealGPTCodexAuth::Get().GetCredentials(GetResolvedCodexAuthFilePath());
+	if (!Credentials->IsValid())
 	{
+		OutError = Credentials->Error;
 		return false;
 	}
 
-	if (!TryGetCodexRefreshToken(AuthJson, OutRefreshToken))
+	if (Credentials->RefreshToken.IsEmpty())
 	{
 		OutError = TEXT("Codex auth cache does not contain a refresh token. Use Codex Login again.");
 		return false;
 	}
 
+	OutRefreshToken = Credentials->RefreshToken;
 	return true;
 }
 
@@ -224,7 +105,11 @@ bool UUnrealGPTSettings::SaveCodexChatGPTAuth(const FString& IdToken, const FStr
 	TokensJson->SetStringField(TEXT("access_token"), AccessToken);
 	TokensJson->SetStringField(TEXT("refresh_token"), RefreshToken);
 
-	const FString AccountId = ExtractJwtStringClaim(IdToken, TEXT("chatgpt_account_id"));
+	FString AccountId;
+	if (const TSharedPtr<FJsonObject> IdTokenPayload = FUnrealGPTCodexAuth::DecodeJwtPayload(IdToken))
+	{
+		IdTokenPayload->TryGetStringField(TEXT("chatgpt_account_id"), AccountId);
+	}
 	if (!AccountId.IsEmpty())
 	{
 		TokensJson->SetStringField(TEXT("account_id"), AccountId);
@@ -239,7 +124,12 @@ bool UUnrealGPTSettings::SaveCodexChatGPTAuth(const FString& IdToken, const FStr
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&AuthText);
 	FJsonSerializer::Serialize(AuthJson.ToSharedRef(), Writer);
 
-	if (!FFileHelper::SaveStringToFile(AuthText, *AuthPath))
+	const bool bSaved = FFileHelper::SaveStringToFile(AuthText, *AuthPath);
+
+	// Don't wait for the directory watcher to report our own write
+	FUnrealGPTCodexAuth::Get().Invalidate();
+
+	if (!bSaved)
 	{
 		OutError = FString::Printf(TEXT("Could not write %s"), *AuthPath);
 		return false;
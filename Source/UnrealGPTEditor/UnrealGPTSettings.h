@@ -76,6 +76,18 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Tools", meta = (DisplayName = "Enable Blueprint Tools"))
 	bool bEnableBlueprintTools = true;
 
+	/** End voice recordings automatically once speech is followed by silence */
+	UPROPERTY(config, EditAnywhere, Category = "Voice", meta = (DisplayName = "Stop Recording On Silence"))
+	bool bVoiceStopOnSilence = true;
+
+	/** Seconds of silence after speech that end a voice recording */
+	UPROPERTY(config, EditAnywhere, Category = "Voice", meta = (DisplayName = "Silence Timeout (seconds)", ClampMin = "0.2", UIMin = "0.2", EditCondition = "bVoiceStopOnSilence"))
+	float VoiceSilenceTimeoutSeconds = 0.8f;
+
+	/** Upload voice recordings as lossless FLAC instead of WAV. Disable for transcription servers that only accept WAV. */
+	UPROPERTY(config, EditAnywhere, Category = "Voice", meta = (DisplayName = "Compress Voice Uploads"))
+	bool bCompressVoiceUploads = true;
+
 	/** Enable built-in Replicate generation tool (direct HTTP integration, no MCP required) */
 	UPROPERTY(config, EditAnywhere, Category = "Replicate", meta = (DisplayName = "Enable Replicate Tool"))
 	bool bEnableReplicateTool = false;
@@ -140,6 +152,10 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "MCP", meta = (DisplayName = "MCP Servers", TitleProperty = "Name"))
 	TArray<FMcpServerConfig> McpServers;
 
+	/** Generated outputs (Replicate files, MCP resource URLs) fetched in parallel */
+	UPROPERTY(config, EditAnywhere, Category = "Downloads", meta = (DisplayName = "Max Concurrent Downloads", ClampMin = "1", ClampMax = "16", UIMin = "1", UIMax = "16"))
+	int32 MaxConcurrentDownloads = 4;
+
 	bool ResolveAuthHeaders(FString& OutBearerToken, FString& OutChatGPTAccountId, FString& OutError) const;
 	bool IsUsingCodexChatGPTAuth() const;
 	bool GetCodexRefreshToken(FString& OutRefreshToken, FString& OutError) const;
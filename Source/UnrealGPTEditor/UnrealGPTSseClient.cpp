@@ -125,31 +125,90 @@ void FUnrealGPTSseClient::ParseSseStream(
 
 	for (const FString& Line : Lines)
 	{
-		// Empty line indicates end of event
-		if (Line.IsEmpty())
+		if (ApplyLine(Line, CurrentEvent))
 		{
 			FlushEvent();
+		}
+	}
+
+	// Flush last event if any
+	FlushEvent();
+}
+
+bool FUnrealGPTSseClient::ApplyLine(const FString& Line, FUnrealGPTSseEvent& Event)
+{
+	// Empty line indicates end of event
+	if (Line.IsEmpty())
+	{
+		return true;
+	}
+
+	if (Line.StartsWith(TEXT("event:")))
+	{
+		Event.Event = Line.Mid(6).TrimStartAndEnd();
+	}
+	else if (Line.StartsWith(TEXT("data:")))
+	{
+		FString DataLine = Line.Mid(5).TrimStartAndEnd();
+		if (!Event.Data.IsEmpty())
+		{
+			Event.Data += TEXT("\n");
+		}
+		Event.Data += DataLine;
+	}
+	// Ignore other fields (id, retry, comments) for now.
+	return false;
+}
+
+FUnrealGPTSseBodyStream::FUnrealGPTSseBodyStream(FOnEvent InOnEvent)
+	: OnEvent(MoveTemp(InOnEvent))
+{
+	SetIsSaving(true);
+	SetIsPersistent(false);
+}
+
+void FUnrealGPTSseBodyStream::Serialize(void* Data, int64 Length)
+{
+	if (Length <= 0)
+	{
+		return;
+	}
+
+	const int32 ScanStart = Body.Num();
+	Body.Append(static_cast<const uint8*>(Data), static_cast<int32>(Length));
+
+	// Lines end at '\n', which never occurs inside a UTF-8 sequence, so each line decodes on its own
+	for (int32 Index = ScanStart; Index < Body.Num(); ++Index)
+	{
+		if (Body[Index] != '\n')
+		{
 			continue;
 		}
 
-		if (Line.StartsWith(TEXT("event:")))
+		int32 LineEnd = Index;
+		if (LineEnd > LineStart && Body[LineEnd - 1] == '\r')
 		{
-			CurrentEvent.Event = Line.Mid(6).TrimStartAndEnd();
+			--LineEnd;
 		}
-		else if (Line.StartsWith(TEXT("data:")))
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Body.GetData() + LineStart), LineEnd - LineStart);
+		const FString Line(Converted.Length(), Converted.Get());
+		LineStart = Index + 1;
+
+		if (FUnrealGPTSseClient::ApplyLine(Line, PendingEvent))
 		{
-			FString DataLine = Line.Mid(5).TrimStartAndEnd();
-			if (!CurrentEvent.Data.IsEmpty())
+			if ((!PendingEvent.Event.IsEmpty() || !PendingEvent.Data.IsEmpty()) && OnEvent)
 			{
-				CurrentEvent.Data += TEXT("\n");
+				OnEvent(PendingEvent);
 			}
-			CurrentEvent.Data += DataLine;
+			PendingEvent = FUnrealGPTSseEvent();
 		}
-		// Ignore other fields (id, retry, comments) for now.
 	}
+}
 
-	// Flush last event if any
-	FlushEvent();
+FString FUnrealGPTSseBodyStream::GetBody() const
+{
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Body.GetData()), Body.Num());
+	return FString(Converted.Length(), Converted.Get());
 }
 
 
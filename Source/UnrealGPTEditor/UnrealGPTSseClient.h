@@ -23,6 +23,33 @@ struct FUnrealGPTSseEvent
 	FString Data;
 };
 
+/**
+ * HTTP response body sink that reports each SSE event as soon as its terminating blank line arrives,
+ * so a caller can act on a stream while the request is still running. The whole body is kept for the
+ * completion handler, which reads it through GetBody instead of the response's (empty) content.
+ * Serialize runs on the HTTP thread, and so does OnEvent.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTSseBodyStream : public FArchive
+{
+public:
+	using FOnEvent = TFunction<void(const FUnrealGPTSseEvent&)>;
+
+	explicit FUnrealGPTSseBodyStream(FOnEvent InOnEvent);
+
+	virtual void Serialize(void* Data, int64 Length) override;
+	virtual FString GetArchiveName() const override { return TEXT("FUnrealGPTSseBodyStream"); }
+
+	/** The body received so far, decoded as UTF-8; complete once the request has finished. */
+	FString GetBody() const;
+
+private:
+	FOnEvent OnEvent;
+	TArray<uint8> Body;
+	/** Start of the first line that has not been terminated yet. */
+	int32 LineStart = 0;
+	FUnrealGPTSseEvent PendingEvent;
+};
+
 class FUnrealGPTSseClient
 {
 public:
@@ -54,6 +81,9 @@ public:
 		const FString& Body,
 		TArray<FUnrealGPTSseEvent>& OutEvents);
 
+	/** Apply one line of an SSE stream to Event; returns true when the line is the blank one that ends it. */
+	static bool ApplyLine(const FString& Line, FUnrealGPTSseEvent& Event);
+
 private:
 	/** Parse a full SSE stream string into discrete events. */
 	static void ParseSseStream(
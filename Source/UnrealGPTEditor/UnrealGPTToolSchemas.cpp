@@ -40,6 +40,21 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildPythonExecuteTool(bool bUseR
 	CodeProperty->SetStringField(TEXT("description"), TEXT("Python code to execute"));
 	PythonParams->SetObjectField(TEXT("properties"), MakeShareable(new FJsonObject));
 	PythonParams->GetObjectField(TEXT("properties"))->SetObjectField(TEXT("code"), CodeProperty);
+
+	TSharedPtr<FJsonObject> ProfileProperty = MakeShareable(new FJsonObject);
+	ProfileProperty->SetStringField(TEXT("type"), TEXT("boolean"));
+	ProfileProperty->SetStringField(TEXT("description"), TEXT("Run under cProfile and return profile.hot_functions (self_ms, cumulative_ms, calls). Use when a snippet is slow (default false)."));
+	PythonParams->GetObjectField(TEXT("properties"))->SetObjectField(TEXT("profile"), ProfileProperty);
+
+	TSharedPtr<FJsonObject> ProfileTopProperty = MakeShareable(new FJsonObject);
+	ProfileTopProperty->SetStringField(TEXT("type"), TEXT("integer"));
+	ProfileTopProperty->SetStringField(TEXT("description"), TEXT("Number of hot functions to return when profile is true (default 15, max 50)."));
+	PythonParams->GetObjectField(TEXT("properties"))->SetObjectField(TEXT("profile_top"), ProfileTopProperty);
+
+	TSharedPtr<FJsonObject> CountCallsProperty = MakeShareable(new FJsonObject);
+	CountCallsProperty->SetStringField(TEXT("type"), TEXT("boolean"));
+	CountCallsProperty->SetStringField(TEXT("description"), TEXT("Count unreal.* API calls (accounting.unreal_api_calls, top_unreal_calls) without a full profile. Adds per-call overhead (default false)."));
+	PythonParams->GetObjectField(TEXT("properties"))->SetObjectField(TEXT("count_unreal_calls"), CountCallsProperty);
 	
 	TArray<TSharedPtr<FJsonValue>> Required;
 	Required.Add(MakeShareable(new FJsonValueString(TEXT("code"))));
@@ -49,6 +64,9 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildPythonExecuteTool(bool bUseR
 		TEXT("python_execute"),
 		TEXT("Execute Python code in Unreal Engine editor. Use this to manipulate actors, spawn objects, modify properties, automate Content Browser and asset/Blueprint operations, and perform other editor tasks not possible with other tools. ")
 		TEXT("Code runs in the editor Python environment with access to the 'unreal' module and editor subsystems. ")
+		TEXT("Imports and variables persist between python_execute calls, so define helpers once and reuse them. ")
+		TEXT("print() output is returned as 'stdout' (and 'stderr'), with 'elapsed_ms'. ")
+		TEXT("'accounting' reports objects created/modified, 'warnings' about slow patterns and, with count_unreal_calls or profile, unreal API call counts; act on those warnings in the next snippet. ")
 		TEXT("The execution is wrapped in an editor transaction for Undo support. ")
 		TEXT("Returns a standard result envelope with status, message, details, logs, and transaction fields. ")
 		TEXT("If you populate 'result[\"details\"][\"actor_label\"]' or 'result[\"details\"][\"actor_name\"]' with the name of a created or modified actor, the editor viewport will automatically focus on it."),
@@ -161,6 +179,30 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildReflectionQueryTool(bool bUs
 		TEXT("Name or path of the UClass to inspect. Short name, fully qualified path, or Blueprint generated class path."));
 	Properties->SetObjectField(TEXT("class_name"), ClassNameProp);
 
+	TSharedPtr<FJsonObject> ClassEntryItem = MakeShareable(new FJsonObject);
+	ClassEntryItem->SetStringField(TEXT("type"), TEXT("object"));
+	{
+		TSharedPtr<FJsonObject> EntryProps = MakeShareable(new FJsonObject);
+		TSharedPtr<FJsonObject> EntryClassNameProp = MakeShareable(new FJsonObject);
+		EntryClassNameProp->SetStringField(TEXT("type"), TEXT("string"));
+		EntryProps->SetObjectField(TEXT("class_name"), EntryClassNameProp);
+		TSharedPtr<FJsonObject> EntryMemberContainsProp = MakeShareable(new FJsonObject);
+		EntryMemberContainsProp->SetStringField(TEXT("type"), TEXT("string"));
+		EntryProps->SetObjectField(TEXT("member_contains"), EntryMemberContainsProp);
+		ClassEntryItem->SetObjectField(TEXT("properties"), EntryProps);
+		TArray<TSharedPtr<FJsonValue>> EntryRequired;
+		EntryRequired.Add(MakeShareable(new FJsonValueString(TEXT("class_name"))));
+		ClassEntryItem->SetArrayField(TEXT("required"), EntryRequired);
+	}
+
+	TSharedPtr<FJsonObject> ClassesProp = MakeShareable(new FJsonObject);
+	ClassesProp->SetStringField(TEXT("type"), TEXT("array"));
+	ClassesProp->SetStringField(
+		TEXT("description"),
+		TEXT("Batch form: up to 16 classes, each with an optional member_contains. Inherited members already listed for an earlier class are omitted."));
+	ClassesProp->SetObjectField(TEXT("items"), ClassEntryItem);
+	Properties->SetObjectField(TEXT("classes"), ClassesProp);
+
 	TSharedPtr<FJsonObject> MemberContainsProp = MakeShareable(new FJsonObject);
 	MemberContainsProp->SetStringField(TEXT("type"), TEXT("string"));
 	MemberContainsProp->SetStringField(TEXT("description"), TEXT("Optional substring filter on member names."));
@@ -186,18 +228,60 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildReflectionQueryTool(bool bUs
 
 	ReflectionParams->SetObjectField(TEXT("properties"), Properties);
 
-	TArray<TSharedPtr<FJsonValue>> Required;
-	Required.Add(MakeShareable(new FJsonValueString(TEXT("class_name"))));
-	ReflectionParams->SetArrayField(TEXT("required"), Required);
-
 	return BuildToolObject(
 		TEXT("reflection_query"),
 		TEXT("Inspect an Unreal UClass via reflection. Returns a compact schema of scriptable properties and functions. ")
-		TEXT("Use member_contains to target specific members; set include_super=true only when inherited members are needed."),
+		TEXT("Use member_contains to target specific members; set include_super=true only when inherited members are needed. ")
+		TEXT("Pass 'classes' instead of class_name to inspect several classes in one call."),
 		ReflectionParams,
 		bUseResponsesApi);
 }
 
+TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildReflectionSearchTool(bool bUseResponsesApi)
+{
+	TSharedPtr<FJsonObject> SearchParams = MakeShareable(new FJsonObject);
+	SearchParams->SetStringField(TEXT("type"), TEXT("object"));
+
+	TSharedPtr<FJsonObject> Properties = MakeShareable(new FJsonObject);
+
+	TSharedPtr<FJsonObject> QueryProp = MakeShareable(new FJsonObject);
+	QueryProp->SetStringField(TEXT("type"), TEXT("string"));
+	QueryProp->SetStringField(
+		TEXT("description"),
+		TEXT("Words describing the member you need, e.g. 'set static mesh material' or 'actor hidden in game'."));
+	Properties->SetObjectField(TEXT("query"), QueryProp);
+
+	TSharedPtr<FJsonObject> KindProp = MakeShareable(new FJsonObject);
+	KindProp->SetStringField(TEXT("type"), TEXT("string"));
+	KindProp->SetStringField(TEXT("description"), TEXT("Restrict results to 'function' or 'property' (default any)."));
+	Properties->SetObjectField(TEXT("kind"), KindProp);
+
+	TSharedPtr<FJsonObject> ClassContainsProp = MakeShareable(new FJsonObject);
+	ClassContainsProp->SetStringField(TEXT("type"), TEXT("string"));
+	ClassContainsProp->SetStringField(TEXT("description"), TEXT("Optional case-insensitive substring filter on the declaring class name."));
+	Properties->SetObjectField(TEXT("class_contains"), ClassContainsProp);
+
+	TSharedPtr<FJsonObject> MaxResultsProp = MakeShareable(new FJsonObject);
+	MaxResultsProp->SetStringField(TEXT("type"), TEXT("integer"));
+	MaxResultsProp->SetStringField(TEXT("description"), TEXT("Maximum results (default 15, max 50)."));
+	MaxResultsProp->SetNumberField(TEXT("default"), 15);
+	Properties->SetObjectField(TEXT("max_results"), MaxResultsProp);
+
+	SearchParams->SetObjectField(TEXT("properties"), Properties);
+
+	TArray<TSharedPtr<FJsonValue>> Required;
+	Required.Add(MakeShareable(new FJsonValueString(TEXT("query"))));
+	SearchParams->SetArrayField(TEXT("required"), Required);
+
+	return BuildToolObject(
+		TEXT("reflection_search"),
+		TEXT("Find scriptable native functions and properties by description when you do not know the class or exact name. ")
+		TEXT("Ranks member names, categories and tooltips locally with no network call. ")
+		TEXT("Returns the declaring class and member name; follow up with reflection_query for full signatures."),
+		SearchParams,
+		bUseResponsesApi);
+}
+
 TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildReadLogTool(bool bUseResponsesApi)
 {
 	TSharedPtr<FJsonObject> ReadLogParams = MakeShareable(new FJsonObject);
@@ -239,7 +323,8 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildReadLogTool(bool bUseRespons
 	return BuildToolObject(
 		TEXT("read_log"),
 		TEXT("Read recent Unreal Editor log output in a token-efficient, filtered way. ")
-		TEXT("Use after failed or ambiguous python_execute calls. Prefer category='LogPython' or contains='Traceback' for Python errors."),
+		TEXT("Use after failed or ambiguous python_execute calls. Prefer category='LogPython' or contains='Traceback' for Python errors. ")
+		TEXT("Errors logged during python_execute, blueprint_* and actor edit tools are already attached to their results as 'new_log_errors'."),
 		ReadLogParams,
 		bUseResponsesApi);
 }
@@ -735,6 +820,20 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildBlueprintQueryTool(bool bUse
 	IncludePinsProp->SetBoolField(TEXT("default"), true);
 	Properties->SetObjectField(TEXT("include_pins"), IncludePinsProp);
 
+	TSharedPtr<FJsonObject> SinceRevisionProp = MakeShareable(new FJsonObject);
+	SinceRevisionProp->SetStringField(TEXT("type"), TEXT("string"));
+	SinceRevisionProp->SetStringField(TEXT("description"), TEXT("Optional revision from an earlier blueprint_query of this asset. Returns only changed_nodes and removed_nodes since then (variables/components only if they changed)."));
+	Properties->SetObjectField(TEXT("since_revision"), SinceRevisionProp);
+
+	TSharedPtr<FJsonObject> FormatProp = MakeShareable(new FJsonObject);
+	FormatProp->SetStringField(TEXT("type"), TEXT("string"));
+	TArray<TSharedPtr<FJsonValue>> FormatValues;
+	FormatValues.Add(MakeShareable(new FJsonValueString(TEXT("full"))));
+	FormatValues.Add(MakeShareable(new FJsonValueString(TEXT("compact"))));
+	FormatProp->SetArrayField(TEXT("enum"), FormatValues);
+	FormatProp->SetStringField(TEXT("description"), TEXT("full (default): one object per node and pin. compact: node table, pin_types table and flat edges list, described by the result's legend; use for large graphs."));
+	Properties->SetObjectField(TEXT("format"), FormatProp);
+
 	Params->SetObjectField(TEXT("properties"), Properties);
 	TArray<TSharedPtr<FJsonValue>> Required;
 	Required.Add(MakeShareable(new FJsonValueString(TEXT("asset_path"))));
@@ -834,6 +933,13 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildBlueprintCompileTool(bool bU
 	Params->SetStringField(TEXT("type"), TEXT("object"));
 	TSharedPtr<FJsonObject> Properties = MakeShareable(new FJsonObject);
 	AddAssetPathProperty(Properties);
+
+	TSharedPtr<FJsonObject> ForceProp = MakeShareable(new FJsonObject);
+	ForceProp->SetStringField(TEXT("type"), TEXT("boolean"));
+	ForceProp->SetStringField(TEXT("description"), TEXT("Recompile even when the Blueprint is already up to date (default false)."));
+	ForceProp->SetBoolField(TEXT("default"), false);
+	Properties->SetObjectField(TEXT("force"), ForceProp);
+
 	Params->SetObjectField(TEXT("properties"), Properties);
 
 	TArray<TSharedPtr<FJsonValue>> Required;
@@ -842,7 +948,77 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildBlueprintCompileTool(bool bU
 
 	return BuildToolObject(
 		TEXT("blueprint_compile"),
-		TEXT("Compile a Blueprint and return compile status/errors."),
+		TEXT("Compile a Blueprint and return compile status plus diagnostics (severity, message, node_guid, pin_name) for each compiler error or warning."),
+		Params,
+		bUseResponsesApi);
+}
+
+TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildBlueprintCompileBatchTool(bool bUseResponsesApi)
+{
+	TSharedPtr<FJsonObject> Params = MakeShareable(new FJsonObject);
+	Params->SetStringField(TEXT("type"), TEXT("object"));
+	TSharedPtr<FJsonObject> Properties = MakeShareable(new FJsonObject);
+
+	TSharedPtr<FJsonObject> AssetPathItem = MakeShareable(new FJsonObject);
+	AssetPathItem->SetStringField(TEXT("type"), TEXT("string"));
+	TSharedPtr<FJsonObject> AssetPathsProp = MakeShareable(new FJsonObject);
+	AssetPathsProp->SetStringField(TEXT("type"), TEXT("array"));
+	AssetPathsProp->SetStringField(TEXT("description"), TEXT("Blueprint asset paths to compile (at most 100)."));
+	AssetPathsProp->SetObjectField(TEXT("items"), AssetPathItem);
+	Properties->SetObjectField(TEXT("asset_paths"), AssetPathsProp);
+
+	TSharedPtr<FJsonObject> DependencyRootProp = MakeShareable(new FJsonObject);
+	DependencyRootProp->SetStringField(TEXT("type"), TEXT("string"));
+	DependencyRootProp->SetStringField(TEXT("description"), TEXT("Asset (Blueprint base class, struct, enum) whose dependent Blueprints should all be recompiled, found through Asset Registry referencers."));
+	Properties->SetObjectField(TEXT("dependency_root"), DependencyRootProp);
+
+	TSharedPtr<FJsonObject> IncludeRootProp = MakeShareable(new FJsonObject);
+	IncludeRootProp->SetStringField(TEXT("type"), TEXT("boolean"));
+	IncludeRootProp->SetStringField(TEXT("description"), TEXT("Also compile dependency_root when it is a Blueprint (default true)."));
+	IncludeRootProp->SetBoolField(TEXT("default"), true);
+	Properties->SetObjectField(TEXT("include_root"), IncludeRootProp);
+
+	TSharedPtr<FJsonObject> BenchmarkProp = MakeShareable(new FJsonObject);
+	BenchmarkProp->SetStringField(TEXT("type"), TEXT("boolean"));
+	BenchmarkProp->SetStringField(TEXT("description"), TEXT("Also time compiling each Blueprint separately and report batch_ms vs serial_ms (default false)."));
+	BenchmarkProp->SetBoolField(TEXT("default"), false);
+	Properties->SetObjectField(TEXT("benchmark"), BenchmarkProp);
+
+	Params->SetObjectField(TEXT("properties"), Properties);
+
+	return BuildToolObject(
+		TEXT("blueprint_compile_batch"),
+		TEXT("Compile many Blueprints in one batched pass, parents before children, and return per-asset status and diagnostics. ")
+		TEXT("Use after changing a shared base class, struct or enum instead of calling blueprint_compile per asset."),
+		Params,
+		bUseResponsesApi);
+}
+
+TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildBlueprintSearchNodesTool(bool bUseResponsesApi)
+{
+	TSharedPtr<FJsonObject> Params = MakeShareable(new FJsonObject);
+	Params->SetStringField(TEXT("type"), TEXT("object"));
+	TSharedPtr<FJsonObject> Properties = MakeShareable(new FJsonObject);
+
+	TSharedPtr<FJsonObject> QueryProp = MakeShareable(new FJsonObject);
+	QueryProp->SetStringField(TEXT("type"), TEXT("string"));
+	QueryProp->SetStringField(TEXT("description"), TEXT("Words from the node's palette name, category or keywords, e.g. \"add float\", \"cast to character\", \"for each loop\", \"switch on int\"."));
+	Properties->SetObjectField(TEXT("query"), QueryProp);
+
+	TSharedPtr<FJsonObject> MaxResultsProp = MakeShareable(new FJsonObject);
+	MaxResultsProp->SetStringField(TEXT("type"), TEXT("integer"));
+	MaxResultsProp->SetStringField(TEXT("description"), TEXT("Maximum results (default 15, max 50)."));
+	Properties->SetObjectField(TEXT("max_results"), MaxResultsProp);
+
+	Params->SetObjectField(TEXT("properties"), Properties);
+	TArray<TSharedPtr<FJsonValue>> Required;
+	Required.Add(MakeShareable(new FJsonValueString(TEXT("query"))));
+	Params->SetArrayField(TEXT("required"), Required);
+
+	return BuildToolObject(
+		TEXT("blueprint_search_nodes"),
+		TEXT("Search the Blueprint node palette (every node the editor's right-click menu can place). ")
+		TEXT("Returns action_id values to pass to blueprint_add_node with node_type Action."),
 		Params,
 		bUseResponsesApi);
 }
@@ -859,20 +1035,12 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildBlueprintAddNodeTool(bool bU
 
 	TSharedPtr<FJsonObject> NodeTypeProp = MakeShareable(new FJsonObject);
 	NodeTypeProp->SetStringField(TEXT("type"), TEXT("string"));
-	NodeTypeProp->SetStringField(TEXT("description"), TEXT("Node type: Event, CallFunction, VariableGet, VariableSet, CustomEvent, Branch, Sequence, Self, PrintString."));
+	NodeTypeProp->SetStringField(TEXT("description"), TEXT("Node type: Event, CallFunction, VariableGet, VariableSet, CustomEvent, Branch, Sequence, Self, PrintString, or Action for any other palette node (math, casts, macros, switches, timelines...)."));
 	Properties->SetObjectField(TEXT("node_type"), NodeTypeProp);
 
-	TSharedPtr<FJsonObject> PosXProp = MakeShareable(new FJsonObject);
-	PosXProp->SetStringField(TEXT("type"), TEXT("number"));
-	Properties->SetObjectField(TEXT("pos_x"), PosXProp);
-
-	TSharedPtr<FJsonObject> PosYProp = MakeShareable(new FJsonObject);
-	PosYProp->SetStringField(TEXT("type"), TEXT("number"));
-	Properties->SetObjectField(TEXT("pos_y"), PosYProp);
-
 	TSharedPtr<FJsonObject> ParamsProp = MakeShareable(new FJsonObject);
 	ParamsProp->SetStringField(TEXT("type"), TEXT("object"));
-	ParamsProp->SetStringField(TEXT("description"), TEXT("Type-specific params: event_name, function_name, target_class, variable_name."));
+	ParamsProp->SetStringField(TEXT("description"), TEXT("Type-specific params: event_name, function_name, target_class, variable_name; Action takes action_id from blueprint_search_nodes."));
 	Properties->SetObjectField(TEXT("params"), ParamsProp);
 
 	Params->SetObjectField(TEXT("properties"), Properties);
@@ -991,3 +1159,99 @@ TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildBlueprintSetPinDefaultTool(b
 		bUseResponsesApi);
 }
 
+TSharedPtr<FJsonObject> FUnrealGPTToolSchemas::BuildBlueprintApplyEditsTool(bool bUseResponsesApi)
+{
+	using namespace UnrealGPTToolSchemasPrivate;
+
+	TSharedPtr<FJsonObject> Params = MakeShareable(new FJsonObject);
+	Params->SetStringField(TEXT("type"), TEXT("object"));
+	TSharedPtr<FJsonObject> Properties = MakeShareable(new FJsonObject);
+	AddAssetPathProperty(Properties);
+	AddGraphNameProperty(Properties);
+
+	TSharedPtr<FJsonObject> OpItem = MakeShareable(new FJsonObject);
+	OpItem->SetStringField(TEXT("type"), TEXT("object"));
+	{
+		TSharedPtr<FJsonObject> OpProps = MakeShareable(new FJsonObject);
+		auto AddOpProp = [&OpProps](const TCHAR* Name, const TCHAR* Type, const TCHAR* Description)
+		{
+			TSharedPtr<FJsonObject> Prop = MakeShareable(new FJsonObject);
+			Prop->SetStringField(TEXT("type"), Type);
+			if (Description)
+			{
+				Prop->SetStringField(TEXT("description"), Description);
+			}
+			OpProps->SetObjectField(Name, Prop);
+		};
+
+		TSharedPtr<FJsonObject> OpNameProp = MakeShareable(new FJsonObject);
+		OpNameProp->SetStringField(TEXT("type"), TEXT("string"));
+		TArray<TSharedPtr<FJsonValue>> OpNames;
+		for (const TCHAR* OpName : { TEXT("add_node"), TEXT("connect_pins"), TEXT("set_pin_default"), TEXT("remove_node"), TEXT("add_variable") })
+		{
+			OpNames.Add(MakeShareable(new FJsonValueString(OpName)));
+		}
+		OpNameProp->SetArrayField(TEXT("enum"), OpNames);
+		OpProps->SetObjectField(TEXT("op"), OpNameProp);
+
+		AddOpProp(TEXT("id"), TEXT("string"), TEXT("add_node: local id that later ops may use instead of the node GUID."));
+		AddOpProp(TEXT("node_type"), TEXT("string"), TEXT("add_node: same node types as blueprint_add_node."));
+		AddOpProp(TEXT("params"), TEXT("object"), TEXT("add_node: type-specific params, as for blueprint_add_node."));
+		AddOpProp(TEXT("graph_name"), TEXT("string"), TEXT("Optional per-op graph; defaults to the call's graph_name."));
+		AddOpProp(TEXT("from_node"), TEXT("string"), TEXT("connect_pins: local id or node GUID."));
+		AddOpProp(TEXT("from_pin"), TEXT("string"), nullptr);
+		AddOpProp(TEXT("to_node"), TEXT("string"), TEXT("connect_pins: local id or node GUID."));
+		AddOpProp(TEXT("to_pin"), TEXT("string"), nullptr);
+		AddOpProp(TEXT("node"), TEXT("string"), TEXT("set_pin_default / remove_node: local id or node GUID."));
+		AddOpProp(TEXT("pin_name"), TEXT("string"), nullptr);
+		AddOpProp(TEXT("value"), TEXT("string"), nullptr);
+		AddOpProp(TEXT("name"), TEXT("string"), TEXT("add_variable: variable name."));
+		AddOpProp(TEXT("type"), TEXT("string"), TEXT("add_variable: same types as blueprint_add_variable."));
+		AddOpProp(TEXT("sub_type_object"), TEXT("string"), nullptr);
+		AddOpProp(TEXT("default_value"), TEXT("string"), nullptr);
+		AddOpProp(TEXT("instance_editable"), TEXT("boolean"), nullptr);
+		AddOpProp(TEXT("expose_on_spawn"), TEXT("boolean"), nullptr);
+
+		OpItem->SetObjectField(TEXT("properties"), OpProps);
+		TArray<TSharedPtr<FJsonValue>> OpRequired;
+		OpRequired.Add(MakeShareable(new FJsonValueString(TEXT("op"))));
+		OpItem->SetArrayField(TEXT("required"), OpRequired);
+	}
+
+	TSharedPtr<FJsonObject> OpsProp = MakeShareable(new FJsonObject);
+	OpsProp->SetStringField(TEXT("type"), TEXT("array"));
+	OpsProp->SetStringField(TEXT("description"), TEXT("Ordered edits (at most 100), applied top to bottom."));
+	OpsProp->SetObjectField(TEXT("items"), OpItem);
+	Properties->SetObjectField(TEXT("ops"), OpsProp);
+
+	TSharedPtr<FJsonObject> CompileProp = MakeShareable(new FJsonObject);
+	CompileProp->SetStringField(TEXT("type"), TEXT("boolean"));
+	CompileProp->SetStringField(TEXT("description"), TEXT("Compile once after the edits (default false)."));
+	CompileProp->SetBoolField(TEXT("default"), false);
+	Properties->SetObjectField(TEXT("compile"), CompileProp);
+
+	TSharedPtr<FJsonObject> AtomicProp = MakeShareable(new FJsonObject);
+	AtomicProp->SetStringField(TEXT("type"), TEXT("boolean"));
+	AtomicProp->SetStringField(TEXT("description"), TEXT("Undo the whole batch if any op fails (default true). When false, failed ops are reported and the rest still apply."));
+	AtomicProp->SetBoolField(TEXT("default"), true);
+	Properties->SetObjectField(TEXT("atomic"), AtomicProp);
+
+	TSharedPtr<FJsonObject> AutoLayoutProp = MakeShareable(new FJsonObject);
+	AutoLayoutProp->SetStringField(TEXT("type"), TEXT("boolean"));
+	AutoLayoutProp->SetStringField(TEXT("description"), TEXT("Lay out the added nodes by exec and data flow once the batch has run (default true). Node positions never need to be supplied."));
+	AutoLayoutProp->SetBoolField(TEXT("default"), true);
+	Properties->SetObjectField(TEXT("auto_layout"), AutoLayoutProp);
+
+	Params->SetObjectField(TEXT("properties"), Properties);
+	TArray<TSharedPtr<FJsonValue>> Required;
+	Required.Add(MakeShareable(new FJsonValueString(TEXT("asset_path"))));
+	Required.Add(MakeShareable(new FJsonValueString(TEXT("ops"))));
+	Params->SetArrayField(TEXT("required"), Required);
+
+	return BuildToolObject(
+		TEXT("blueprint_apply_edits"),
+		TEXT("Apply several Blueprint graph edits (add_node, connect_pins, set_pin_default, remove_node, add_variable) as one undoable step, optionally compiling. Returns a result per op and the GUID of every local node id."),
+		Params,
+		bUseResponsesApi);
+}
+
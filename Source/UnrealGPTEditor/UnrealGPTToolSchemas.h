@@ -31,6 +31,9 @@ public:
 	/** Build reflection_query tool schema */
 	static TSharedPtr<FJsonObject> BuildReflectionQueryTool(bool bUseResponsesApi);
 
+	/** Build reflection_search tool schema */
+	static TSharedPtr<FJsonObject> BuildReflectionSearchTool(bool bUseResponsesApi);
+
 	/** Build read_log tool schema */
 	static TSharedPtr<FJsonObject> BuildReadLogTool(bool bUseResponsesApi);
 
@@ -68,9 +71,12 @@ public:
 	static TSharedPtr<FJsonObject> BuildBlueprintCreateTool(bool bUseResponsesApi);
 	static TSharedPtr<FJsonObject> BuildBlueprintAddVariableTool(bool bUseResponsesApi);
 	static TSharedPtr<FJsonObject> BuildBlueprintCompileTool(bool bUseResponsesApi);
+	static TSharedPtr<FJsonObject> BuildBlueprintCompileBatchTool(bool bUseResponsesApi);
+	static TSharedPtr<FJsonObject> BuildBlueprintSearchNodesTool(bool bUseResponsesApi);
 	static TSharedPtr<FJsonObject> BuildBlueprintAddNodeTool(bool bUseResponsesApi);
 	static TSharedPtr<FJsonObject> BuildBlueprintConnectPinsTool(bool bUseResponsesApi);
 	static TSharedPtr<FJsonObject> BuildBlueprintRemoveNodeTool(bool bUseResponsesApi);
 	static TSharedPtr<FJsonObject> BuildBlueprintSetPinDefaultTool(bool bUseResponsesApi);
+	static TSharedPtr<FJsonObject> BuildBlueprintApplyEditsTool(bool bUseResponsesApi);
 };
 
@@ -2,6 +2,8 @@
 
 #include "UnrealGPTVoiceInput.h"
 #include "UnrealGPTSettings.h"
+#include "UnrealGPTFlacEncoder.h"
+#include "Async/Async.h"
 #include "Misc/Base64.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
@@ -17,6 +19,12 @@ UUnrealGPTVoiceInput::UUnrealGPTVoiceInput()
 	Settings = GetMutableDefault<UUnrealGPTSettings>();
 }
 
+void UUnrealGPTVoiceInput::BeginDestroy()
+{
+	StopCaptureTicker();
+	Super::BeginDestroy();
+}
+
 void UUnrealGPTVoiceInput::Initialize()
 {
 	// Ensure settings are loaded
@@ -34,9 +42,6 @@ bool UUnrealGPTVoiceInput::StartRecording()
 		return false;
 	}
 
-	// Clear previous audio data
-	CapturedAudioData.Empty();
-
 	// Open default capture stream if needed
 	if (!CaptureSynth.IsStreamOpen())
 	{
@@ -62,6 +67,19 @@ bool UUnrealGPTVoiceInput::StartRecording()
 		return false;
 	}
 
+	FUnrealGPTVoiceStream::FOptions StreamOptions;
+	if (Settings)
+	{
+		StreamOptions.bDetectVoiceActivity = Settings->bVoiceStopOnSilence;
+		StreamOptions.SilenceTimeoutSeconds = Settings->VoiceSilenceTimeoutSeconds;
+	}
+	VoiceStream.Reset(RecordingSampleRate, RecordingNumChannels, StreamOptions);
+
+	// Resample and encode while recording instead of after the user stops
+	CaptureTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UUnrealGPTVoiceInput::TickCapture),
+		0.05f);
+
 	bIsRecording = true;
 	OnRecordingStarted.Broadcast();
 	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Started audio recording"));
@@ -77,30 +95,61 @@ void UUnrealGPTVoiceInput::StopRecordingAndTranscribe()
 		return;
 	}
 
-	// Stop capturing
+	// Stop capturing and encode whatever is still queued
+	StopCaptureTicker();
 	CaptureSynth.StopCapturing();
-	
-	// Pull all queued audio data from the synth
-	TArray<float> Chunk;
-	while (CaptureSynth.GetAudioData(Chunk))
-	{
-		if (Chunk.Num() > 0)
-		{
-			CapturedAudioData.Append(Chunk);
-		}
-	}
-	
+	DrainCapturedAudio();
+	VoiceStream.Finish();
+
 	bIsRecording = false;
 	OnRecordingStopped.Broadcast();
 
-	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Stopped recording, captured %d samples"), CapturedAudioData.Num());
+	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Stopped recording, encoded %.2fs of 16 kHz audio"), VoiceStream.GetDurationSeconds());
 
-	if (CapturedAudioData.Num() == 0)
+	if (VoiceStream.GetPcm().Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: No audio data captured from microphone"));
+		UE_LOG(LogTemp, Warning, TEXT("UnrealGPT: No audio captured from microphone"));
 		OnTranscriptionComplete.Broadcast(TEXT(""));
 		return;
 	}
+	if (!VoiceStream.HasSpeech())
+	{
+		// Quiet speakers or a noisy room can hide speech from the level detector; let the transcriber decide
+		UE_LOG(LogTemp, Log, TEXT("UnrealGPT: No speech detected, uploading the untrimmed recording"));
+	}
+
+	// Encode the upload on a worker; FLAC is lossless and about half the size of the PCM
+	const bool bCompress = !Settings || Settings->bCompressVoiceUploads;
+	TWeakObjectPtr<UUnrealGPTVoiceInput> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Pcm = VoiceStream.GetPcm(), bCompress]()
+	{
+		TArray<uint8> AudioFile = bCompress
+			? FUnrealGPTFlacEncoder::EncodeMono16(Pcm, FUnrealGPTVoiceStream::OutputSampleRate)
+			: FUnrealGPTVoiceStream::EncodeWav(Pcm);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, AudioFile = MoveTemp(AudioFile), bCompress]()
+		{
+			if (UUnrealGPTVoiceInput* This = WeakThis.Get())
+			{
+				This->UploadForTranscription(
+					AudioFile,
+					bCompress ? TEXT("audio.flac") : TEXT("audio.wav"),
+					bCompress ? TEXT("audio/flac") : TEXT("audio/wav"));
+			}
+		});
+	});
+}
+
+void UUnrealGPTVoiceInput::UploadForTranscription(const TArray<uint8>& AudioFile, const FString& FileName, const FString& ContentType)
+{
+	if (AudioFile.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UnrealGPT: Failed to encode recorded audio"));
+		OnTranscriptionComplete.Broadcast(TEXT(""));
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Uploading %s (%d bytes) for transcription"), *FileName, AudioFile.Num());
 
 	// Ensure Settings is valid
 	if (!Settings)
@@ -131,15 +180,6 @@ void UUnrealGPTVoiceInput::StopRecordingAndTranscribe()
 		return;
 	}
 
-	// Convert audio to WAV format
-	TArray<uint8> WAVData = ConvertToWAV(CapturedAudioData, RecordingSampleRate, RecordingNumChannels);
-	if (WAVData.Num() == 0)
-	{
-		UE_LOG(LogTemp, Error, TEXT("UnrealGPT: Failed to convert audio to WAV"));
-		OnTranscriptionComplete.Broadcast(TEXT(""));
-		return;
-	}
-
 	// Create HTTP request to Whisper API
 	TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
 	
@@ -199,14 +239,14 @@ void UUnrealGPTVoiceInput::StopRecordingAndTranscribe()
 	{
 		FString FileHeader;
 		FileHeader += FString::Printf(TEXT("--%s\r\n"), *Boundary);
-		FileHeader += TEXT("Content-Disposition: form-data; name=\"file\"; filename=\"audio.wav\"\r\n");
-		FileHeader += TEXT("Content-Type: audio/wav\r\n\r\n");
+		FileHeader += FString::Printf(TEXT("Content-Disposition: form-data; name=\"file\"; filename=\"%s\"\r\n"), *FileName);
+		FileHeader += FString::Printf(TEXT("Content-Type: %s\r\n\r\n"), *ContentType);
 
 		FTCHARToUTF8 FileHeaderUtf8(*FileHeader);
 		RequestData.Append(reinterpret_cast<const uint8*>(FileHeaderUtf8.Get()), FileHeaderUtf8.Length());
 
-		// Binary WAV data
-		RequestData.Append(WAVData);
+		// Binary audio file
+		RequestData.Append(AudioFile);
 	}
 
 	// Part 2: model
@@ -246,10 +286,11 @@ void UUnrealGPTVoiceInput::CancelRecording()
 	}
 
 	// Stop capturing if active
+	StopCaptureTicker();
 	CaptureSynth.StopCapturing();
 	
 	bIsRecording = false;
-	CapturedAudioData.Empty();
+	VoiceStream.Reset(RecordingSampleRate, RecordingNumChannels, FUnrealGPTVoiceStream::FOptions());
 	OnRecordingStopped.Broadcast();
 	UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Recording cancelled"));
 }
@@ -298,67 +339,43 @@ void UUnrealGPTVoiceInput::OnWhisperResponseReceived(FHttpRequestPtr Request, FH
 	OnTranscriptionComplete.Broadcast(TranscribedText);
 }
 
-TArray<uint8> UUnrealGPTVoiceInput::ConvertToWAV(const TArray<float>& PCMData, int32 SampleRate, int32 NumChannels)
+bool UUnrealGPTVoiceInput::TickCapture(float DeltaTime)
 {
-	TArray<uint8> WAVData;
-
-	if (PCMData.Num() == 0)
+	if (!bIsRecording)
 	{
-		return WAVData;
+		CaptureTickerHandle.Reset();
+		return false;
 	}
 
-	// WAV file header structure
-	struct FWAVHeader
-	{
-		uint32 ChunkID;        // "RIFF"
-		uint32 ChunkSize;      // File size - 8
-		uint32 Format;         // "WAVE"
-		uint32 Subchunk1ID;    // "fmt "
-		uint32 Subchunk1Size;  // 16 for PCM
-		uint16 AudioFormat;    // 1 for PCM
-		uint16 NumChannels;    // 1 or 2
-		uint32 SampleRate;     // e.g., 16000
-		uint32 ByteRate;       // SampleRate * NumChannels * BitsPerSample/8
-		uint16 BlockAlign;     // NumChannels * BitsPerSample/8
-		uint16 BitsPerSample;  // 16
-		uint32 Subchunk2ID;    // "data"
-		uint32 Subchunk2Size;  // NumSamples * NumChannels * BitsPerSample/8
-	};
-
-	const int32 BitsPerSample = 16;
-	const int32 NumSamples = PCMData.Num() / NumChannels;
-	const int32 DataSize = NumSamples * NumChannels * (BitsPerSample / 8);
-
-	FWAVHeader Header;
-	Header.ChunkID = 0x46464952; // "RIFF"
-	Header.ChunkSize = 36 + DataSize;
-	Header.Format = 0x45564157; // "WAVE"
-	Header.Subchunk1ID = 0x20746D66; // "fmt "
-	Header.Subchunk1Size = 16;
-	Header.AudioFormat = 1; // PCM
-	Header.NumChannels = NumChannels;
-	Header.SampleRate = SampleRate;
-	Header.ByteRate = SampleRate * NumChannels * (BitsPerSample / 8);
-	Header.BlockAlign = NumChannels * (BitsPerSample / 8);
-	Header.BitsPerSample = BitsPerSample;
-	Header.Subchunk2ID = 0x61746164; // "data"
-	Header.Subchunk2Size = DataSize;
-
-	// Write header
-	WAVData.Append(reinterpret_cast<const uint8*>(&Header), sizeof(FWAVHeader));
-
-	// Convert float samples to 16-bit PCM
-	for (int32 i = 0; i < PCMData.Num(); ++i)
+	DrainCapturedAudio();
+	if (VoiceStream.IsUtteranceComplete())
 	{
-		// Clamp and convert to int16
-		float Sample = FMath::Clamp(PCMData[i], -1.0f, 1.0f);
-		int16 PCMSample = static_cast<int16>(Sample * 32767.0f);
-		
-		// Write as little-endian
-		WAVData.Add(static_cast<uint8>(PCMSample & 0xFF));
-		WAVData.Add(static_cast<uint8>((PCMSample >> 8) & 0xFF));
+		UE_LOG(LogTemp, Log, TEXT("UnrealGPT: Silence after speech, ending voice recording"));
+		CaptureTickerHandle.Reset();
+		StopRecordingAndTranscribe();
+		return false;
 	}
 
-	return WAVData;
+	return true;
+}
+
+void UUnrealGPTVoiceInput::DrainCapturedAudio()
+{
+	TArray<float> Chunk;
+	while (CaptureSynth.GetAudioData(Chunk))
+	{
+		if (Chunk.Num() > 0 && VoiceStream.Process(Chunk.GetData(), Chunk.Num()))
+		{
+			break;
+		}
+	}
 }
 
+void UUnrealGPTVoiceInput::StopCaptureTicker()
+{
+	if (CaptureTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(CaptureTickerHandle);
+		CaptureTickerHandle.Reset();
+	}
+}
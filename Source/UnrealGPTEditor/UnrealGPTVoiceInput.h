@@ -7,6 +7,8 @@
 #include "AudioCaptureCore.h"
 #include "Sound/SoundWave.h"
 #include "Http.h"
+#include "Containers/Ticker.h"
+#include "UnrealGPTVoiceStream.h"
 #include "UnrealGPTVoiceInput.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTranscriptionComplete, const FString&, TranscribedText);
@@ -21,13 +23,15 @@ class UNREALGPTEDITOR_API UUnrealGPTVoiceInput : public UObject
 public:
 	UUnrealGPTVoiceInput();
 
+	virtual void BeginDestroy() override;
+
 	/** Initialize the voice input system */
 	void Initialize();
 
 	/** Start recording audio from microphone */
 	bool StartRecording();
 
-	/** Stop recording and transcribe using Whisper API */
+	/** Stop recording and transcribe using Whisper API. Also called when voice activity detection ends the utterance. */
 	void StopRecordingAndTranscribe();
 
 	/** Cancel current recording without transcribing */
@@ -52,11 +56,21 @@ private:
 	/** Handle Whisper API response */
 	void OnWhisperResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 
-	/** Convert captured audio to WAV format */
-	TArray<uint8> ConvertToWAV(const TArray<float>& PCMData, int32 SampleRate, int32 NumChannels);
+	/** Send an encoded recording to the transcription endpoint */
+	void UploadForTranscription(const TArray<uint8>& AudioFile, const FString& FileName, const FString& ContentType);
+
+	/** Feed queued microphone audio into the voice stream while recording */
+	bool TickCapture(float DeltaTime);
+
+	/** Move all audio queued in the capture synth into the voice stream */
+	void DrainCapturedAudio();
+
+	void StopCaptureTicker();
+
+	/** Captured audio, resampled to 16 kHz mono and encoded as it arrives */
+	FUnrealGPTVoiceStream VoiceStream;
 
-	/** Captured audio data (interleaved floats) */
-	TArray<float> CapturedAudioData;
+	FTSTicker::FDelegateHandle CaptureTickerHandle;
 
 	/** Low-level audio capture synth (handles microphone capture) */
 	Audio::FAudioCaptureSynth CaptureSynth;
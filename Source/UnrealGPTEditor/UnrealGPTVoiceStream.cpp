@@ -0,0 +1,211 @@
+// Copyright (c) 2025 TREE Industries.
+
+#include "UnrealGPTVoiceStream.h"
+
+namespace UnrealGPTVoiceStreamPrivate
+{
+	static int16 EncodeSample(float Sample)
+	{
+		return static_cast<int16>(FMath::RoundToInt(FMath::Clamp(Sample, -1.0f, 1.0f) * 32767.0f));
+	}
+
+	static void AppendUInt16(TArray<uint8>& Out, uint16 Value)
+	{
+		Out.Add(static_cast<uint8>(Value & 0xFF));
+		Out.Add(static_cast<uint8>((Value >> 8) & 0xFF));
+	}
+
+	static void AppendUInt32(TArray<uint8>& Out, uint32 Value)
+	{
+		AppendUInt16(Out, static_cast<uint16>(Value & 0xFFFF));
+		AppendUInt16(Out, static_cast<uint16>(Value >> 16));
+	}
+}
+
+void FUnrealGPTVoiceStream::Reset(int32 InSampleRate, int32 InNumChannels, const FOptions& InOptions)
+{
+	Options = InOptions;
+	InputSampleRate = FMath::Max(1, InSampleRate);
+	InputNumChannels = FMath::Max(1, InNumChannels);
+
+	Step = static_cast<double>(InputSampleRate) / OutputSampleRate;
+	Phase = 0.0;
+	Previous = 0.0f;
+	bHasPrevious = false;
+
+	// One-pole low-pass below the output Nyquist rate before decimating; upsampling needs none.
+	LowPassCoefficient = InputSampleRate > OutputSampleRate
+		? 1.0f - FMath::Exp(-2.0f * PI * (0.45f * OutputSampleRate) / InputSampleRate)
+		: 1.0f;
+	LowPassState = 0.0f;
+
+	Frame.Reset(FrameSamples);
+	Pcm.Reset();
+
+	PreRollSamples = FMath::Max(
+		FMath::RoundToInt(Options.PreRollSeconds * OutputSampleRate),
+		FMath::Max(1, Options.OnsetFrames) * FrameSamples);
+
+	CalibrationFrames = FMath::Max(1, FMath::CeilToInt(Options.CalibrationSeconds * OutputSampleRate / FrameSamples));
+	NumFramesSeen = 0;
+	NoiseFloorDb = 0.0f;
+	SpeechFrameRun = 0;
+	SilenceFrameRun = 0;
+	bSpeechStarted = false;
+	bUtteranceComplete = false;
+}
+
+bool FUnrealGPTVoiceStream::Process(const float* Samples, int32 NumSamples)
+{
+	const int32 NumFrames = NumSamples / InputNumChannels;
+	const float ChannelScale = 1.0f / InputNumChannels;
+
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames && !bUtteranceComplete; ++FrameIndex)
+	{
+		const float* Interleaved = Samples + FrameIndex * InputNumChannels;
+		float Mono = 0.0f;
+		for (int32 Channel = 0; Channel < InputNumChannels; ++Channel)
+		{
+			Mono += Interleaved[Channel];
+		}
+		Mono *= ChannelScale;
+
+		LowPassState += LowPassCoefficient * (Mono - LowPassState);
+		const float Current = LowPassState;
+
+		if (!bHasPrevious)
+		{
+			Previous = Current;
+			bHasPrevious = true;
+			continue;
+		}
+
+		// Linear interpolation between Previous and Current for every output sample that falls between them
+		while (Phase < 1.0)
+		{
+			PushResampled(Previous + (Current - Previous) * static_cast<float>(Phase));
+			Phase += Step;
+		}
+		Phase -= 1.0;
+		Previous = Current;
+	}
+
+	return bUtteranceComplete;
+}
+
+void FUnrealGPTVoiceStream::Finish()
+{
+	if (Frame.Num() > 0 && !bUtteranceComplete)
+	{
+		for (const float Sample : Frame)
+		{
+			Pcm.Add(UnrealGPTVoiceStreamPrivate::EncodeSample(Sample));
+		}
+	}
+	Frame.Reset();
+}
+
+TArray<uint8> FUnrealGPTVoiceStream::EncodeWav(const TArray<int16>& Samples)
+{
+	TArray<uint8> Wav;
+	Wav.Reserve(44 + Samples.Num() * sizeof(int16));
+	WriteWavHeader(Wav, OutputSampleRate, 1, Samples.Num());
+
+	const int32 HeaderSize = Wav.Num();
+	Wav.AddUninitialized(Samples.Num() * sizeof(int16));
+	FMemory::Memcpy(Wav.GetData() + HeaderSize, Samples.GetData(), Samples.Num() * sizeof(int16));
+	return Wav;
+}
+
+void FUnrealGPTVoiceStream::WriteWavHeader(TArray<uint8>& Out, int32 SampleRate, int32 NumChannels, int32 NumSamples)
+{
+	using namespace UnrealGPTVoiceStreamPrivate;
+
+	const uint32 BytesPerSample = sizeof(int16);
+	const uint32 DataSize = static_cast<uint32>(NumSamples) * NumChannels * BytesPerSample;
+
+	AppendUInt32(Out, 0x46464952); // "RIFF"
+	AppendUInt32(Out, 36 + DataSize);
+	AppendUInt32(Out, 0x45564157); // "WAVE"
+	AppendUInt32(Out, 0x20746D66); // "fmt "
+	AppendUInt32(Out, 16);
+	AppendUInt16(Out, 1); // PCM
+	AppendUInt16(Out, static_cast<uint16>(NumChannels));
+	AppendUInt32(Out, static_cast<uint32>(SampleRate));
+	AppendUInt32(Out, SampleRate * NumChannels * BytesPerSample);
+	AppendUInt16(Out, static_cast<uint16>(NumChannels * BytesPerSample));
+	AppendUInt16(Out, 16);
+	AppendUInt32(Out, 0x61746164); // "data"
+	AppendUInt32(Out, DataSize);
+}
+
+void FUnrealGPTVoiceStream::PushResampled(float Sample)
+{
+	Frame.Add(Sample);
+	if (Frame.Num() == FrameSamples)
+	{
+		ProcessFrame();
+		Frame.Reset();
+	}
+}
+
+void FUnrealGPTVoiceStream::ProcessFrame()
+{
+	using namespace UnrealGPTVoiceStreamPrivate;
+
+	TArray<int16, TInlineAllocator<FrameSamples>> Encoded;
+	Encoded.SetNumUninitialized(Frame.Num());
+	double SumSquares = 0.0;
+	for (int32 Index = 0; Index < Frame.Num(); ++Index)
+	{
+		SumSquares += static_cast<double>(Frame[Index]) * Frame[Index];
+		Encoded[Index] = EncodeSample(Frame[Index]);
+	}
+
+	if (!Options.bDetectVoiceActivity)
+	{
+		Pcm.Append(Encoded);
+		return;
+	}
+
+	const float LevelDb = 10.0f * FMath::LogX(10.0f, FMath::Max(static_cast<float>(SumSquares / Frame.Num()), 1e-10f));
+	Pcm.Append(Encoded);
+
+	// The quietest calibration frame seeds the floor, so speech at the very start cannot become the floor
+	if (NumFramesSeen++ < CalibrationFrames)
+	{
+		NoiseFloorDb = NumFramesSeen == 1 ? LevelDb : FMath::Min(NoiseFloorDb, LevelDb);
+		return;
+	}
+	const bool bSpeech = LevelDb > Options.MinSpeechLevelDb && LevelDb > NoiseFloorDb + Options.SpeechThresholdDb;
+
+	if (bSpeechStarted)
+	{
+		SilenceFrameRun = bSpeech ? 0 : SilenceFrameRun + 1;
+		if (SilenceFrameRun * FrameSamples >= Options.SilenceTimeoutSeconds * OutputSampleRate)
+		{
+			bUtteranceComplete = true;
+		}
+		return;
+	}
+
+	// The floor follows the room while nobody is speaking: it drops at once and rises slowly
+	if (!bSpeech)
+	{
+		NoiseFloorDb = LevelDb < NoiseFloorDb ? LevelDb : NoiseFloorDb + 0.05f * (LevelDb - NoiseFloorDb);
+	}
+	SpeechFrameRun = bSpeech ? SpeechFrameRun + 1 : 0;
+
+	if (SpeechFrameRun < Options.OnsetFrames)
+	{
+		return;
+	}
+
+	// Speech onset: drop everything before the pre-roll (which holds the first onset frames) and this frame
+	bSpeechStarted = true;
+	const int32 NumLeading = Pcm.Num() - (PreRollSamples + Encoded.Num());
+	if (NumLeading > 0)
+	{
+		Pcm.RemoveAt(0, NumLeading, EAllowShrinking::No);
+	}
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 TREE Industries.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Incremental voice pipeline fed from the microphone while recording: downmixes to mono, resamples to
+ * 16 kHz and encodes 16-bit PCM as blocks arrive, so stopping only has to add a WAV header.
+ * An energy voice activity detector with an adaptive noise floor finds the start and end of speech.
+ * The floor is measured over a short calibration window before any frame can count as speech. Audio is
+ * kept untrimmed until speech starts, then cut back to a short pre-roll; when no speech is found the whole
+ * recording remains available.
+ */
+class UNREALGPTEDITOR_API FUnrealGPTVoiceStream
+{
+public:
+	static constexpr int32 OutputSampleRate = 16000;
+	/** 20 ms analysis frame. */
+	static constexpr int32 FrameSamples = OutputSampleRate / 50;
+
+	struct FOptions
+	{
+		/** When false every sample is kept and the utterance never ends on its own. */
+		bool bDetectVoiceActivity = true;
+		/** Silence after speech that ends the utterance. */
+		float SilenceTimeoutSeconds = 0.8f;
+		/** Audio kept from before speech was detected. */
+		float PreRollSeconds = 0.3f;
+		/** Start of the recording whose quietest frame seeds the noise floor; never counted as speech. */
+		float CalibrationSeconds = 0.25f;
+		/** Frame level above the noise floor that counts as speech. */
+		float SpeechThresholdDb = 12.0f;
+		/** Frames quieter than this never count as speech. */
+		float MinSpeechLevelDb = -50.0f;
+		/** Consecutive speech frames needed to start an utterance; filters out clicks. */
+		int32 OnsetFrames = 3;
+	};
+
+	void Reset(int32 InSampleRate, int32 InNumChannels, const FOptions& InOptions);
+
+	/** Feed interleaved device samples. Returns true once the utterance has ended. */
+	bool Process(const float* Samples, int32 NumSamples);
+
+	/** Flush the partial frame; call after the last Process. */
+	void Finish();
+
+	bool HasSpeech() const { return bSpeechStarted || !Options.bDetectVoiceActivity; }
+	bool IsUtteranceComplete() const { return bUtteranceComplete; }
+
+	/** Encoded 16 kHz mono samples of the utterance so far; everything recorded while HasSpeech is false. */
+	const TArray<int16>& GetPcm() const { return Pcm; }
+
+	float GetDurationSeconds() const { return static_cast<float>(Pcm.Num()) / OutputSampleRate; }
+
+	/** GetPcm with a 44-byte WAV header. */
+	TArray<uint8> BuildWav() const { return EncodeWav(Pcm); }
+
+	/** 16 kHz mono samples as a WAV file. */
+	static TArray<uint8> EncodeWav(const TArray<int16>& Samples);
+
+	static void WriteWavHeader(TArray<uint8>& Out, int32 SampleRate, int32 NumChannels, int32 NumSamples);
+
+private:
+	void PushResampled(float Sample);
+	void ProcessFrame();
+
+	FOptions Options;
+	int32 InputSampleRate = OutputSampleRate;
+	int32 InputNumChannels = 1;
+
+	// Resampler state: anti-alias low-pass, previous input sample and position of the next output sample
+	// between Previous and the next input, in input samples.
+	double Step = 1.0;
+	double Phase = 0.0;
+	float LowPassCoefficient = 1.0f;
+	float LowPassState = 0.0f;
+	float Previous = 0.0f;
+	bool bHasPrevious = false;
+
+	TArray<float> Frame;
+	TArray<int16> Pcm;
+
+	/** Samples kept ahead of the onset frame when speech starts. */
+	int32 PreRollSamples = 0;
+
+	int32 CalibrationFrames = 1;
+	int32 NumFramesSeen = 0;
+	float NoiseFloorDb = 0.0f;
+	int32 SpeechFrameRun = 0;
+	int32 SilenceFrameRun = 0;
+	bool bSpeechStarted = false;
+	bool bUtteranceComplete = false;
+};
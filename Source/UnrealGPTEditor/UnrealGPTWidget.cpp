@@ -23,6 +23,7 @@
 #include "UnrealGPTSceneContext.h"
 #include "UnrealGPTWidgetDelegateHandler.h"
 #include "SUnrealGPTClarifyWidget.h"
+#include "SUnrealGPTMarkdownView.h"
 #include "Framework/Text/SlateTextRun.h"
 #include "Framework/Text/SlateTextLayout.h"
 #include "Widgets/Layout/SSpacer.h"
@@ -33,6 +34,7 @@
 #include "RenderingThread.h"
 #include "Async/Async.h"
 #include "ImageUtils.h"
+#include "UObject/StrongObjectPtr.h"
 #include "TextureResource.h"
 #include "UnrealGPTVoiceInput.h"
 #include "DesktopPlatformModule.h"
@@ -41,6 +43,7 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
+#include "UnrealGPTDownloadManager.h"
 #include "Widgets/Layout/SWrapBox.h"
 #include "Widgets/SOverlay.h"
 #include "AssetThumbnail.h"
@@ -61,12 +64,12 @@ namespace UnrealGPTAgentUI
 	// DESIGN.md accent-blue (#0099ff) reserved for link-like / focus hints (not primary CTAs).
 	static const FSlateColor AccentBlueHint = FSlateColor(FLinearColor(0.0f, 0.6f, 1.0f, 1.0f));
 
-	static FSlateFontInfo BodyFont()
+	FSlateFontInfo BodyFont()
 	{
 		return FAppStyle::GetFontStyle("NormalFont");
 	}
 
-	static FSlateFontInfo BodyBoldFont()
+	FSlateFontInfo BodyBoldFont()
 	{
 		return FAppStyle::GetFontStyle("NormalFontBold");
 	}
@@ -85,11 +88,7 @@ namespace UnrealGPTAgentUI
 	{
 		return FAppStyle::GetFontStyle("NormalFontItalic");
 	}
-}
 
-namespace
-{
-	// Render a single chat line with very lightweight inline markdown support (**bold** only).
 	TSharedRef<SWidget> CreateInlineMarkdownTextWidget(const FString& Line)
 	{
 		TSharedRef<SWrapBox> WrapBox =
@@ -109,7 +108,7 @@ namespace
 				SNew(STextBlock)
 				.Text(FText::FromString(Text))
 				.AutoWrapText(true)
-				.Font(bBold ? UnrealGPTAgentUI::BodyBoldFont() : UnrealGPTAgentUI::BodyFont())
+				.Font(bBold ? BodyBoldFont() : BodyFont())
 				.ColorAndOpacity(FStyleColors::Foreground)
 			];
 		};
@@ -155,6 +154,50 @@ namespace
 		return WrapBox;
 	}
 
+	TSharedPtr<SWidget> CreateThumbnailImage(const FUnrealGPTThumbnailPtr& Thumbnail, FUnrealGPTThumbnailPool& Pool)
+	{
+		// The image lambda owns the lease, so the pooled texture goes back when the row scrolls out of view.
+		const TSharedPtr<FUnrealGPTThumbnailPool::FLease> Lease = Thumbnail.IsValid() ? Pool.Acquire(Thumbnail) : nullptr;
+		if (!Lease.IsValid())
+		{
+			return nullptr;
+		}
+
+		return SNew(SBox)
+			.WidthOverride(static_cast<float>(Thumbnail->Size.X))
+			.HeightOverride(static_cast<float>(Thumbnail->Size.Y))
+			[
+				SNew(SImage)
+				.Image_Lambda([Lease]() { return Lease->GetBrush(); })
+			];
+	}
+}
+
+namespace
+{
+	/** Transcript row that records its arranged height on its item, for the next time the row is generated. */
+	class SUnrealGPTTranscriptRow : public STableRow<TSharedPtr<FUnrealGPTTranscriptItem>>
+	{
+	public:
+		void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable, const TSharedPtr<FUnrealGPTTranscriptItem>& InItem)
+		{
+			Item = InItem;
+			STableRow<TSharedPtr<FUnrealGPTTranscriptItem>>::Construct(InArgs, InOwnerTable);
+		}
+
+		virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override
+		{
+			STableRow<TSharedPtr<FUnrealGPTTranscriptItem>>::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+			if (const TSharedPtr<FUnrealGPTTranscriptItem> PinnedItem = Item.Pin())
+			{
+				PinnedItem->MeasuredHeight = AllottedGeometry.GetLocalSize().Y;
+			}
+		}
+
+	private:
+		TWeakPtr<FUnrealGPTTranscriptItem> Item;
+	};
+
 	/** Constrain thread width and bias turns for a chat-style transcript (DESIGN rhythm + readability). */
 	TSharedRef<SWidget> WrapThreadTurn(const TSharedRef<SWidget>& Inner, EHorizontalAlignment RowAlign)
 	{
@@ -261,22 +304,168 @@ namespace
 SUnrealGPTWidget::~SUnrealGPTWidget()
 {
 	ResetCodexLoginProcess();
+
+	if (GEditor && McpStatusChangedHandle.IsValid())
+	{
+		if (UUnrealGPTMcpSubsystem* McpSubsystem = GEditor->GetEditorSubsystem<UUnrealGPTMcpSubsystem>())
+		{
+			McpSubsystem->OnStatusChanged().Remove(McpStatusChangedHandle);
+		}
+	}
+
+	FUnrealGPTDownloadManager::Get().OnProgressChanged().Remove(DownloadProgressChangedHandle);
+	GetMutableDefault<UUnrealGPTSettings>()->OnSettingChanged().Remove(SettingsChangedHandle);
 }
 
-void SUnrealGPTWidget::AddConversationTurnWidget(const TSharedRef<SWidget>& Content, const FMargin& SlotPadding)
+void SUnrealGPTWidget::AddTranscriptItem(const TSharedRef<FUnrealGPTTranscriptItem>& Item)
 {
-	if (!ChatHistoryBox.IsValid())
+	if (!TranscriptView.IsValid())
 	{
 		return;
 	}
 
-	ChatHistoryBox->AddSlot()
-		.Padding(SlotPadding)
-		[ Content ];
-
-	++ChatConversationBlockCount;
+	TranscriptItems.Add(Item);
 	SyncEmptyThreadVisibility();
-	ChatHistoryBox->ScrollToEnd();
+	TranscriptView->RequestListRefresh();
+	TranscriptView->ScrollToBottom();
+}
+
+void SUnrealGPTWidget::AddConversationTurn(TFunction<TSharedRef<SWidget>()> BuildWidget, const FMargin& SlotPadding)
+{
+	const TSharedRef<FUnrealGPTTranscriptItem> Item = MakeShared<FUnrealGPTTranscriptItem>();
+	Item->BuildWidget = MoveTemp(BuildWidget);
+	Item->Padding = SlotPadding;
+	AddTranscriptItem(Item);
+}
+
+void SUnrealGPTWidget::AddConversationTurnWidget(const TSharedRef<SWidget>& Content, const FMargin& SlotPadding)
+{
+	const TSharedRef<FUnrealGPTTranscriptItem> Item = MakeShared<FUnrealGPTTranscriptItem>();
+	Item->PinnedWidget = Content;
+	Item->Padding = SlotPadding;
+	AddTranscriptItem(Item);
+}
+
+void SUnrealGPTWidget::AddScreenshotTurn(FString Base64Png)
+{
+	const TSharedRef<FUnrealGPTTranscriptItem> Item = MakeShared<FUnrealGPTTranscriptItem>();
+	Item->bScreenshot = true;
+	Item->Padding = FMargin(12.0f, 6.0f, 12.0f, 10.0f);
+	AddTranscriptItem(Item);
+
+	// Decode and downscale on a worker; the game thread only swaps the row in when the thumbnail is ready
+	const TWeakPtr<SUnrealGPTWidget> WeakWidget = StaticCastSharedRef<SUnrealGPTWidget>(AsShared());
+	FUnrealGPTScreenshotPipeline::DecodeThumbnailAsync(MoveTemp(Base64Png), [WeakWidget, Item](FUnrealGPTThumbnailPtr Thumbnail)
+	{
+		const TSharedPtr<SUnrealGPTWidget> Widget = WeakWidget.Pin();
+		if (!Widget.IsValid())
+		{
+			return;
+		}
+
+		if (Thumbnail.IsValid())
+		{
+			Item->Screenshot = MoveTemp(Thumbnail);
+		}
+		else
+		{
+			// If decoding failed, show it as a text result
+			Item->bScreenshot = false;
+			SUnrealGPTWidget* RawWidget = Widget.Get();
+			Item->BuildWidget = [RawWidget]()
+			{
+				return RawWidget->CreateToolResultWidget(TEXT("Screenshot captured (failed to decode image for display)"), false, false, true);
+			};
+		}
+
+		// Only this row changes; a row that is not realized picks the thumbnail up when it is generated
+		Item->MeasuredHeight = 0.0f;
+		if (Widget->TranscriptView.IsValid())
+		{
+			if (const TSharedPtr<ITableRow> Row = Widget->TranscriptView->WidgetFromItem(Item))
+			{
+				StaticCastSharedRef<STableRow<TSharedPtr<FUnrealGPTTranscriptItem>>>(Row->AsWidget())->SetContent(Widget->CreateTranscriptRowContent(*Item));
+			}
+		}
+	});
+}
+
+TSharedRef<SWidget> SUnrealGPTWidget::CreateTranscriptRowContent(FUnrealGPTTranscriptItem& Item)
+{
+	if (Item.PinnedWidget.IsValid())
+	{
+		return Item.PinnedWidget.ToSharedRef();
+	}
+	if (Item.bScreenshot)
+	{
+		return CreateScreenshotWidget(Item);
+	}
+	if (Item.BuildWidget)
+	{
+		return Item.BuildWidget();
+	}
+	return SNullWidget::NullWidget;
+}
+
+TSharedRef<ITableRow> SUnrealGPTWidget::OnGenerateTranscriptRow(TSharedPtr<FUnrealGPTTranscriptItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	// Rebuilt content (markdown laid out again, a screenshot leasing its texture) can briefly measure
+	// smaller than it was; holding the cached height keeps rows below it from shifting while scrolling.
+	const float MinHeight = Item.IsValid() && !Item->PinnedWidget.IsValid() ? Item->MeasuredHeight : 0.0f;
+
+	return SNew(SUnrealGPTTranscriptRow, OwnerTable, Item)
+		.Style(&FAppStyle::Get().GetWidgetStyle<FTableRowStyle>("TableView.NoHoverTableRow"))
+		.ShowSelection(false)
+		.Padding(Item.IsValid() ? Item->Padding : FMargin(0.0f))
+		[
+			SNew(SBox)
+			.MinDesiredHeight(FMath::Max(0.0f, MinHeight - (Item.IsValid() ? Item->Padding.GetTotalSpaceAlong<Orient_Vertical>() : 0.0f)))
+			[
+				Item.IsValid() ? CreateTranscriptRowContent(*Item) : SNullWidget::NullWidget
+			]
+		];
+}
+
+TSharedRef<SWidget> SUnrealGPTWidget::CreateScreenshotWidget(const FUnrealGPTTranscriptItem& Item) const
+{
+	TSharedRef<SWidget> Image = SNew(STextBlock)
+		.Text(NSLOCTEXT("UnrealGPT", "ScreenshotDecoding", "Decoding screenshot..."))
+		.Font(UnrealGPTAgentUI::CaptionFont())
+		.ColorAndOpacity(FStyleColors::Foreground);
+
+	if (ScreenshotTexturePool.IsValid())
+	{
+		if (const TSharedPtr<SWidget> Thumbnail = UnrealGPTAgentUI::CreateThumbnailImage(Item.Screenshot, *ScreenshotTexturePool))
+		{
+			Image = Thumbnail.ToSharedRef();
+		}
+	}
+
+	return WrapThreadTurn(
+		SNew(SBorder)
+		.BorderImage(FAppStyle::GetBrush("Brushes.White"))
+		.BorderBackgroundColor(FStyleColors::Panel)
+		.Padding(FMargin(14.0f, 10.0f))
+		[
+			SNew(SVerticalBox)
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 0.0f, 0.0f, 8.0f)
+			[
+				SNew(STextBlock)
+				.Text(NSLOCTEXT("UnrealGPT", "ScreenshotResult", "Viewport Screenshot"))
+				.Font(FAppStyle::GetFontStyle("SmallFontBold"))
+				.ColorAndOpacity(FStyleColors::Success)
+			]
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			[
+				Image
+			]
+		],
+		HAlign_Left);
 }
 
 void SUnrealGPTWidget::SyncEmptyThreadVisibility()
@@ -286,7 +475,7 @@ void SUnrealGPTWidget::SyncEmptyThreadVisibility()
 		return;
 	}
 
-	EmptyThreadChrome->SetVisibility(ChatConversationBlockCount <= 0 ? EVisibility::Visible : EVisibility::Collapsed);
+	EmptyThreadChrome->SetVisibility(TranscriptItems.Num() == 0 ? EVisibility::Visible : EVisibility::Collapsed);
 }
 
 void SUnrealGPTWidget::Construct(const FArguments& InArgs)
@@ -301,6 +490,7 @@ void SUnrealGPTWidget::Construct(const FArguments& InArgs)
 
 	// Bind delegates using UFunction bindings through the handler
 	AgentClient->OnAgentMessage.AddDynamic(DelegateHandler, &UUnrealGPTWidgetDelegateHandler::OnAgentMessageReceived);
+	AgentClient->OnAgentMessageDelta.AddDynamic(DelegateHandler, &UUnrealGPTWidgetDelegateHandler::OnAgentMessageDeltaReceived);
 	AgentClient->OnAgentReasoning.AddDynamic(DelegateHandler, &UUnrealGPTWidgetDelegateHandler::OnAgentReasoningReceived);
 	AgentClient->OnToolCall.AddDynamic(DelegateHandler, &UUnrealGPTWidgetDelegateHandler::OnToolCallReceived);
 	AgentClient->OnToolResult.AddDynamic(DelegateHandler, &UUnrealGPTWidgetDelegateHandler::OnToolResultReceived);
@@ -313,6 +503,7 @@ void SUnrealGPTWidget::Construct(const FArguments& InArgs)
 	VoiceInput->OnRecordingStopped.AddDynamic(DelegateHandler, &UUnrealGPTWidgetDelegateHandler::OnRecordingStoppedReceived);
 
 	AssetThumbnailPool = MakeShareable(new FAssetThumbnailPool(32, false));
+	ScreenshotTexturePool = MakeShared<FUnrealGPTThumbnailPool>();
 
 	ChildSlot
 	[
@@ -367,6 +558,16 @@ void SUnrealGPTWidget::Construct(const FArguments& InArgs)
 								.ColorAndOpacity(FStyleColors::AccentGreen)
 								.Visibility(EVisibility::Collapsed)
 							]
+							+ SVerticalBox::Slot()
+							.AutoHeight()
+							.Padding(FMargin(0.0f, 2.0f, 0.0f, 0.0f))
+							[
+								SAssignNew(DownloadStatusLabel, STextBlock)
+								.Text(FText::GetEmpty())
+								.Font(UnrealGPTAgentUI::CaptionFont())
+								.ColorAndOpacity(FStyleColors::Foreground)
+								.Visibility(EVisibility::Collapsed)
+							]
 						]
 						+ SHorizontalBox::Slot()
 						.AutoWidth()
@@ -614,9 +815,10 @@ void SUnrealGPTWidget::Construct(const FArguments& InArgs)
 					SNew(SOverlay)
 					+ SOverlay::Slot()
 					[
-						SAssignNew(ChatHistoryBox, SScrollBox)
-						.Orientation(Orient_Vertical)
-						.ScrollBarAlwaysVisible(false)
+						SAssignNew(TranscriptView, SListView<TSharedPtr<FUnrealGPTTranscriptItem>>)
+						.ListItemsSource(&TranscriptItems)
+						.OnGenerateRow(this, &SUnrealGPTWidget::OnGenerateTranscriptRow)
+						.SelectionMode(ESelectionMode::None)
 						.ConsumeMouseWheel(EConsumeMouseWheel::Always)
 					]
 					+ SOverlay::Slot()
@@ -999,6 +1201,27 @@ void SUnrealGPTWidget::Construct(const FArguments& InArgs)
 		]
 	];
 	SyncEmptyThreadVisibility();
+
+	// The MCP label follows published status snapshots instead of polling the subsystem every frame
+	if (GEditor)
+	{
+		if (UUnrealGPTMcpSubsystem* McpSubsystem = GEditor->GetEditorSubsystem<UUnrealGPTMcpSubsystem>())
+		{
+			McpStatusChangedHandle = McpSubsystem->OnStatusChanged().AddSP(this, &SUnrealGPTWidget::HandleMcpStatusChanged);
+			HandleMcpStatusChanged(McpSubsystem->GetStatusSnapshot());
+		}
+	}
+
+	SettingsChangedHandle = GetMutableDefault<UUnrealGPTSettings>()->OnSettingChanged().AddSPLambda(this, [this](UObject*, FPropertyChangedEvent&)
+	{
+		if (UUnrealGPTMcpSubsystem* McpSubsystem = GEditor ? GEditor->GetEditorSubsystem<UUnrealGPTMcpSubsystem>() : nullptr)
+		{
+			HandleMcpStatusChanged(McpSubsystem->GetStatusSnapshot());
+		}
+	});
+
+	DownloadProgressChangedHandle = FUnrealGPTDownloadManager::Get().OnProgressChanged().AddSP(this, &SUnrealGPTWidget::HandleDownloadProgressChanged);
+	HandleDownloadProgressChanged(FUnrealGPTDownloadManager::Get().GetProgress());
 }
 
 void SUnrealGPTWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
@@ -1017,34 +1240,52 @@ void SUnrealGPTWidget::Tick(const FGeometry& AllottedGeometry, const double InCu
 	{
 		SessionStatusLabel->SetText(NSLOCTEXT("UnrealGPT", "SessionStatusWaiting", "Waiting for input"));
 	}
+}
 
-	if (McpStatusLabel.IsValid())
+void SUnrealGPTWidget::HandleMcpStatusChanged(const FMcpStatusSnapshot& Snapshot)
+{
+	if (!McpStatusLabel.IsValid())
 	{
-		const UUnrealGPTSettings* Settings = GetDefault<UUnrealGPTSettings>();
-		if (Settings && Settings->bEnableMcpTool && Settings->McpServers.Num() > 0)
-		{
-			int32 Connected = 0;
-			int32 Total = 0;
-			if (GEditor)
-			{
-				if (const UUnrealGPTMcpSubsystem* McpSubsystem = GEditor->GetEditorSubsystem<UUnrealGPTMcpSubsystem>())
-				{
-					Connected = McpSubsystem->GetConnectedServerCount();
-					Total = McpSubsystem->GetServerStatuses().Num();
-				}
-			}
+		return;
+	}
 
-			McpStatusLabel->SetText(FText::Format(
-				NSLOCTEXT("UnrealGPT", "McpStatus", "MCP: {0}/{1} connected"),
-				FText::AsNumber(Connected),
-				FText::AsNumber(Total)));
-			McpStatusLabel->SetVisibility(EVisibility::Visible);
-		}
-		else
-		{
-			McpStatusLabel->SetVisibility(EVisibility::Collapsed);
-		}
+	// Re-evaluated on every call: bEnableMcpTool can change without the counts changing.
+	const UUnrealGPTSettings* Settings = GetDefault<UUnrealGPTSettings>();
+	if (Settings && Settings->bEnableMcpTool && Snapshot.TotalCount > 0)
+	{
+		McpStatusLabel->SetText(FText::Format(
+			NSLOCTEXT("UnrealGPT", "McpStatus", "MCP: {0}/{1} connected"),
+			FText::AsNumber(Snapshot.ConnectedCount),
+			FText::AsNumber(Snapshot.TotalCount)));
+		McpStatusLabel->SetVisibility(EVisibility::Visible);
+	}
+	else
+	{
+		McpStatusLabel->SetVisibility(EVisibility::Collapsed);
+	}
+}
+
+void SUnrealGPTWidget::HandleDownloadProgressChanged(const FUnrealGPTDownloadProgress& Progress)
+{
+	if (!DownloadStatusLabel.IsValid())
+	{
+		return;
+	}
+
+	const int32 NumFiles = Progress.NumActive + Progress.NumQueued;
+	if (NumFiles == 0)
+	{
+		DownloadStatusLabel->SetVisibility(EVisibility::Collapsed);
+		return;
 	}
+
+	const FText Received = FText::AsMemory(static_cast<uint64>(Progress.BytesReceived));
+	DownloadStatusLabel->SetText(Progress.BytesExpected > 0
+		? FText::Format(NSLOCTEXT("UnrealGPT", "DownloadStatusSized", "Downloading {0} file(s): {1} of {2}"),
+			FText::AsNumber(NumFiles), Received, FText::AsMemory(static_cast<uint64>(Progress.BytesExpected)))
+		: FText::Format(NSLOCTEXT("UnrealGPT", "DownloadStatus", "Downloading {0} file(s): {1}"),
+			FText::AsNumber(NumFiles), Received));
+	DownloadStatusLabel->SetVisibility(EVisibility::Visible);
 }
 
 FSlateColor SUnrealGPTWidget::GetRoleColor(const FString& Role) const
@@ -1064,152 +1305,19 @@ FSlateColor SUnrealGPTWidget::GetRoleColor(const FString& Role) const
 	return FStyleColors::Foreground;
 }
 
-TSharedRef<SWidget> SUnrealGPTWidget::CreateMarkdownWidget(const FString& Content)
+TSharedRef<SUnrealGPTMarkdownView> SUnrealGPTWidget::CreateMarkdownWidget(const FString& Content)
 {
-	// Lightweight markdown renderer that keeps formatting readable in the chat UI
-	// while avoiding any heavy parsing or external dependencies.
-	//
-	// Supported (best-effort) features:
-	// - Headings: lines starting with "# ", "## ", or "### "
-	// - Bullet lists: lines starting with "- " or "* "
-	// - Fenced code blocks: sections wrapped in ``` fences (language tag after ``` is ignored)
-	// - Blank-line spacing
-
-	TSharedRef<SVerticalBox> Container = SNew(SVerticalBox);
-
-	TArray<FString> Lines;
-	Content.ParseIntoArrayLines(Lines, /*bCullEmpty*/ false);
-
-	bool bInCodeBlock = false;
+	return SNew(SUnrealGPTMarkdownView).Text(Content);
+}
 
-	for (const FString& RawLine : Lines)
+TSharedRef<SWidget> SUnrealGPTWidget::CreateMessageWidget(const FString& Role, const FString& Content, TSharedPtr<SUnrealGPTMarkdownView>* OutMarkdownView)
+{
+	const TSharedRef<SUnrealGPTMarkdownView> MarkdownView = CreateMarkdownWidget(Content);
+	if (OutMarkdownView)
 	{
-		FString Line = RawLine;
-
-		// Toggle fenced code blocks (```), discard the fence line itself
-		if (Line.StartsWith(TEXT("```")))
-		{
-			bInCodeBlock = !bInCodeBlock;
-			continue;
-		}
-
-		// Blank line → small vertical spacer
-		if (Line.TrimStartAndEnd().IsEmpty())
-		{
-			Container->AddSlot()
-				.AutoHeight()
-				[
-					SNew(SSpacer)
-					.Size(FVector2D(1.0f, 4.0f))
-				];
-			continue;
-		}
-
-		// Lines inside fenced code block: monospace, no wrapping
-		if (bInCodeBlock)
-		{
-			Container->AddSlot()
-				.AutoHeight()
-				[
-					SNew(STextBlock)
-					.Text(FText::FromString(Line))
-					.AutoWrapText(false)
-					.Font(FCoreStyle::GetDefaultFontStyle("Mono", 9))
-					.ColorAndOpacity(FStyleColors::Foreground)
-				];
-			continue;
-		}
-
-		// Headings (# / ## / ###) – render slightly emphasized
-		if (Line.StartsWith(TEXT("### ")))
-		{
-			const FString HeadingText = Line.Mid(4);
-			Container->AddSlot()
-				.AutoHeight()
-				.Padding(0.0f, 6.0f, 0.0f, 2.0f)
-				[
-					SNew(STextBlock)
-					.Text(FText::FromString(HeadingText))
-					.AutoWrapText(true)
-					.Font(UnrealGPTAgentUI::BodyBoldFont())
-					.ColorAndOpacity(FStyleColors::Foreground)
-				];
-			continue;
-		}
-		if (Line.StartsWith(TEXT("## ")))
-		{
-			const FString HeadingText = Line.Mid(3);
-			Container->AddSlot()
-				.AutoHeight()
-				.Padding(0.0f, 6.0f, 0.0f, 2.0f)
-				[
-					SNew(STextBlock)
-					.Text(FText::FromString(HeadingText))
-					.AutoWrapText(true)
-					.Font(UnrealGPTAgentUI::BodyBoldFont())
-					.ColorAndOpacity(FStyleColors::Foreground)
-				];
-			continue;
-		}
-		if (Line.StartsWith(TEXT("# ")))
-		{
-			const FString HeadingText = Line.Mid(2);
-			Container->AddSlot()
-				.AutoHeight()
-				.Padding(0.0f, 8.0f, 0.0f, 4.0f)
-				[
-					SNew(STextBlock)
-					.Text(FText::FromString(HeadingText))
-					.AutoWrapText(true)
-					.Font(UnrealGPTAgentUI::BodyBoldFont())
-					.ColorAndOpacity(FStyleColors::Foreground)
-				];
-			continue;
-		}
-
-		// Simple bullet list items: "- " or "* " at line start
-		if (Line.StartsWith(TEXT("- ")) || Line.StartsWith(TEXT("* ")))
-		{
-			const FString ItemText = Line.Mid(2);
-
-			Container->AddSlot()
-				.AutoHeight()
-				[
-					SNew(SHorizontalBox)
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.VAlign(VAlign_Top)
-					.Padding(0.0f, 0.0f, 6.0f, 0.0f)
-					[
-						SNew(STextBlock)
-						.Text(FText::FromString(TEXT("\u2022"))) // Bullet character
-						.Font(UnrealGPTAgentUI::BodyFont())
-						.ColorAndOpacity(FStyleColors::Foreground)
-					]
-					+ SHorizontalBox::Slot()
-					.FillWidth(1.0f)
-					.VAlign(VAlign_Top)
-					[
-						CreateInlineMarkdownTextWidget(ItemText)
-					]
-				];
-
-			continue;
-		}
-
-		// Default paragraph line (supports inline **bold** spans)
-		Container->AddSlot()
-			.AutoHeight()
-			[
-				CreateInlineMarkdownTextWidget(Line)
-			];
+		*OutMarkdownView = MarkdownView;
 	}
 
-	return Container;
-}
-
-TSharedRef<SWidget> SUnrealGPTWidget::CreateMessageWidget(const FString& Role, const FString& Content)
-{
 	const bool bIsUser = Role == TEXT("user");
 	const bool bIsSystem = Role == TEXT("system");
 	const FSlateColor RoleColor = GetRoleColor(Role);
@@ -1260,7 +1368,7 @@ TSharedRef<SWidget> SUnrealGPTWidget::CreateMessageWidget(const FString& Role, c
 				+ SVerticalBox::Slot()
 				.AutoHeight()
 				[
-					CreateMarkdownWidget(Content)
+					MarkdownView
 				];
 		}
 
@@ -1293,7 +1401,7 @@ TSharedRef<SWidget> SUnrealGPTWidget::CreateMessageWidget(const FString& Role, c
 			+ SVerticalBox::Slot()
 			.AutoHeight()
 			[
-				CreateMarkdownWidget(Content)
+				MarkdownView
 			];
 
 		if (bIsUser)
@@ -1936,15 +2044,11 @@ FReply SUnrealGPTWidget::OnSendOrStopClicked()
 	if (bAgentIsRunning)
 	{
 		AgentClient->CancelRequest();
+		FinishStreamingTurn();
 		SetAgentRunning(false);
 		
 		// Add a system message to chat indicating the agent was stopped
-		if (ChatHistoryBox.IsValid())
-		{
-			AddConversationTurnWidget(
-				CreateMessageWidget(TEXT("system"), TEXT("Agent stopped by user. Send a message to continue.")),
-				FMargin(UnrealGPTAgentUI::SpaceXs));
-		}
+		AppendSystemMessage(TEXT("Agent stopped by user. Send a message to continue."));
 		
 		// Hide reasoning indicator
 		if (ReasoningStatusBorder.IsValid())
@@ -1970,7 +2074,6 @@ FReply SUnrealGPTWidget::OnSendOrStopClicked()
 	}
 
 	// Add user message to chat
-	if (ChatHistoryBox.IsValid())
 	{
 		FString DisplayMessage = Message;
 		if (DisplayMessage.IsEmpty())
@@ -1989,7 +2092,9 @@ FReply SUnrealGPTWidget::OnSendOrStopClicked()
 			}
 		}
 
-		AddConversationTurnWidget(CreateMessageWidget(TEXT("user"), DisplayMessage), FMargin(UnrealGPTAgentUI::SpaceXs));
+		// A stream that ended without a final message must not swallow the next reply.
+		FinishStreamingTurn();
+		AddConversationTurn([this, DisplayMessage]() { return CreateMessageWidget(TEXT("user"), DisplayMessage); }, FMargin(UnrealGPTAgentUI::SpaceXs));
 	}
 
 	// Clear input
@@ -2079,12 +2184,13 @@ FReply SUnrealGPTWidget::OnClearHistoryClicked()
 		AgentClient->ClearHistory();
 	}
 
-	if (ChatHistoryBox.IsValid())
+	TranscriptItems.Empty();
+	StreamingItem.Reset();
+	StreamingView.Reset();
+	if (TranscriptView.IsValid())
 	{
-		ChatHistoryBox->ClearChildren();
+		TranscriptView->RequestListRefresh();
 	}
-
-	ChatConversationBlockCount = 0;
 	SyncEmptyThreadVisibility();
 
 	// Also clear any pending attachments
@@ -2125,7 +2231,7 @@ FReply SUnrealGPTWidget::OnSettingsClicked()
 
 void SUnrealGPTWidget::AppendSystemMessage(const FString& Content)
 {
-	AddConversationTurnWidget(CreateMessageWidget(TEXT("system"), Content), FMargin(UnrealGPTAgentUI::SpaceXs));
+	AddConversationTurn([this, Content]() { return CreateMessageWidget(TEXT("system"), Content); }, FMargin(UnrealGPTAgentUI::SpaceXs));
 }
 
 void SUnrealGPTWidget::StartCodexDeviceAuth()
@@ -2869,9 +2975,20 @@ void SUnrealGPTWidget::SetAgentRunning(bool bRunning)
 
 void SUnrealGPTWidget::HandleAgentMessage(const FString& Role, const FString& Content, const TArray<FString>& ToolCalls)
 {
-	if (ChatHistoryBox.IsValid())
+	if (StreamingItem.IsValid() && Role == TEXT("assistant"))
 	{
-		AddConversationTurnWidget(CreateMessageWidget(Role, Content), FMargin(UnrealGPTAgentUI::SpaceXs));
+		// The streamed turn already shows this text; SetText only parses what the deltas did not cover.
+		StreamingView->SetText(Content);
+		StreamingItem->BuildWidget = [this, Role, Content]() { return CreateMessageWidget(Role, Content); };
+		StreamingItem->PinnedWidget.Reset();
+		StreamingItem.Reset();
+		StreamingView.Reset();
+	}
+	else
+	{
+		// A system message (response.failed, HTTP error) ends the stream without a final assistant text
+		FinishStreamingTurn();
+		AddConversationTurn([this, Role, Content]() { return CreateMessageWidget(Role, Content); }, FMargin(UnrealGPTAgentUI::SpaceXs));
 	}
 
 	// When we receive a plain assistant message (no tool calls), the agent has finished
@@ -2899,6 +3016,36 @@ void SUnrealGPTWidget::HandleAgentMessage(const FString& Role, const FString& Co
 	}
 }
 
+void SUnrealGPTWidget::HandleAgentMessageDelta(const FString& Delta)
+{
+	if (!TranscriptView.IsValid() || Delta.IsEmpty())
+	{
+		return;
+	}
+
+	if (!StreamingItem.IsValid())
+	{
+		// Pinned while streaming so the view keeps its parsed blocks if the row is scrolled out and back.
+		AddConversationTurnWidget(CreateMessageWidget(TEXT("assistant"), FString(), &StreamingView), FMargin(UnrealGPTAgentUI::SpaceXs));
+		StreamingItem = TranscriptItems.Last();
+	}
+
+	StreamingView->AppendText(Delta);
+	TranscriptView->ScrollToBottom();
+}
+
+void SUnrealGPTWidget::FinishStreamingTurn()
+{
+	if (StreamingItem.IsValid() && StreamingView.IsValid())
+	{
+		const FString Content = StreamingView->GetText();
+		StreamingItem->BuildWidget = [this, Content]() { return CreateMessageWidget(TEXT("assistant"), Content); };
+		StreamingItem->PinnedWidget.Reset();
+	}
+	StreamingItem.Reset();
+	StreamingView.Reset();
+}
+
 void SUnrealGPTWidget::HandleAgentReasoning(const FString& ReasoningContent)
 {
 	UE_LOG(LogTemp, Log, TEXT("UnrealGPT Widget: HandleAgentReasoning called with content length: %d"), ReasoningContent.Len());
@@ -2933,9 +3080,9 @@ void SUnrealGPTWidget::HandleAgentReasoning(const FString& ReasoningContent)
 	}
 
 	// Keep the chat scrolled to the latest messages while reasoning updates arrive
-	if (ChatHistoryBox.IsValid())
+	if (TranscriptView.IsValid())
 	{
-		ChatHistoryBox->ScrollToEnd();
+		TranscriptView->ScrollToBottom();
 	}
 }
 
@@ -2950,17 +3097,14 @@ void SUnrealGPTWidget::HandleToolCall(const FString& ToolCallId, const FString&
 		SetAgentRunning(true);
 	}
 
-	// Add visual representation to chat
-	if (ChatHistoryBox.IsValid())
+	// Add visual representation to chat. The clarify widget holds the user's pending answers, so it is pinned.
+	if (ToolName == TEXT("clarify"))
 	{
-		if (ToolName == TEXT("clarify"))
-		{
-			AddConversationTurnWidget(CreateClarifyTurnWidget(ToolCallId, Arguments), FMargin(12.0f, 6.0f, 12.0f, 10.0f));
-		}
-		else
-		{
-			AddConversationTurnWidget(CreateToolSpecificWidget(ToolName, Arguments, TEXT("")), FMargin(12.0f, 6.0f, 12.0f, 10.0f));
-		}
+		AddConversationTurnWidget(CreateClarifyTurnWidget(ToolCallId, Arguments), FMargin(12.0f, 6.0f, 12.0f, 10.0f));
+	}
+	else
+	{
+		AddConversationTurn([this, ToolName, Arguments]() { return CreateToolSpecificWidget(ToolName, Arguments, TEXT("")); }, FMargin(12.0f, 6.0f, 12.0f, 10.0f));
 	}
 }
 
@@ -3101,186 +3245,87 @@ void SUnrealGPTWidget::HandleToolResult(const FString& ToolCallId, const FString
 		}
 	}
 
-	if (ChatHistoryBox.IsValid())
+	// Screenshots are decoded off the game thread and shown as a pooled thumbnail
+	if (bIsScreenshot)
 	{
-		// Handle screenshot display specially
-		if (bIsScreenshot)
-		{
-			// Decode base64 and create texture
-			TArray<uint8> ImageData;
-			if (FBase64::Decode(Trimmed, ImageData))
-			{
-				IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-				TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-				
-				if (ImageWrapper.IsValid() && ImageWrapper->SetCompressed(ImageData.GetData(), ImageData.Num()))
-				{
-					TArray<uint8> UncompressedBGRA;
-					if (ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, UncompressedBGRA))
-					{
-						int32 Width = ImageWrapper->GetWidth();
-						int32 Height = ImageWrapper->GetHeight();
-						
-						// Create texture on game thread using FImageUtils (UE5.6 compatible)
-						AsyncTask(ENamedThreads::GameThread, [this, Width, Height, UncompressedBGRA]()
-						{
-							// Widget may have been destroyed between scheduling and execution
-							if (!ChatHistoryBox.IsValid())
-							{
-								return;
-							}
+		AddScreenshotTurn(Trimmed);
+		return;
+	}
 
-							// Convert BGRA to FColor array for FImageUtils
-							TArray<FColor> ColorData;
-							ColorData.Reserve(Width * Height);
-							for (int32 i = 0; i < UncompressedBGRA.Num(); i += 4)
-							{
-								// BGRA format: B, G, R, A
-								FColor Color;
-								Color.B = UncompressedBGRA[i + 0];
-								Color.G = UncompressedBGRA[i + 1];
-								Color.R = UncompressedBGRA[i + 2];
-								Color.A = UncompressedBGRA[i + 3];
-								ColorData.Add(Color);
-							}
-							
-							// Create texture using FImageUtils (UE5.6 compatible API).
-							// Use the transient package as the outer so the texture is not considered for saving/packaging.
-							FCreateTexture2DParameters TextureParams;
-							UTexture2D* Texture = FImageUtils::CreateTexture2D(
-								Width,
-								Height,
-								ColorData,
-								GetTransientPackage(),			// Outer
-								TEXT("ScreenshotTexture"),		// Name
-								RF_Transient,					// Flags (not saved/packaged)
-								TextureParams);
-							
-							if (Texture)
-							{
-								// Create brush from texture (using MakeShareable for proper memory management)
-								TSharedPtr<FSlateBrush> Brush = MakeShareable(new FSlateBrush());
-								Brush->SetResourceObject(Texture);
-								Brush->ImageSize = FVector2D(Width, Height);
-								Brush->ImageType = ESlateBrushImageType::FullColor;
-
-								// Keep the brush alive as long as the widget is alive so Slate
-								// never dereferences a freed FSlateBrush pointer.
-								ScreenshotBrushes.Add(Brush);
-
-								AddConversationTurnWidget(
-									WrapThreadTurn(
-										SNew(SBorder)
-										.BorderImage(FAppStyle::GetBrush("Brushes.White"))
-										.BorderBackgroundColor(FStyleColors::Panel)
-										.Padding(FMargin(14.0f, 10.0f))
-										[
-											SNew(SVerticalBox)
-
-											+ SVerticalBox::Slot()
-											.AutoHeight()
-											.Padding(0.0f, 0.0f, 0.0f, 8.0f)
-											[
-												SNew(STextBlock)
-												.Text(NSLOCTEXT("UnrealGPT", "ScreenshotResult", "Viewport Screenshot"))
-												.Font(FAppStyle::GetFontStyle("SmallFontBold"))
-												.ColorAndOpacity(FStyleColors::Success)
-											]
-
-											+ SVerticalBox::Slot()
-											.AutoHeight()
-											[
-												SNew(SBox)
-												.WidthOverride(FMath::Min(800.0f, static_cast<float>(Width)))
-												.HeightOverride(FMath::Min(600.0f, static_cast<float>(Height) * 800.0f / static_cast<float>(Width)))
-												[
-													SNew(SImage)
-													.Image(Brush.Get())
-												]
-											]
-										],
-										HAlign_Left),
-									FMargin(12.0f, 6.0f, 12.0f, 10.0f));
-							}
-						});
-						
-						return; // Exit early, screenshot will be added async
-					}
-				}
-			}
-			// If decoding failed, fall through to show as text
-			DisplayText = TEXT("Screenshot captured (failed to decode image for display)");
-		}
-		
-		// Standard tool result display
-		AddConversationTurnWidget(
-			WrapThreadTurn(
-				SNew(SBorder)
-				.BorderImage(FAppStyle::GetBrush("Brushes.White"))
-				.BorderBackgroundColor(FStyleColors::Panel)
-				.Padding(FMargin(14.0f, 10.0f))
-				[
-					SNew(SHorizontalBox)
+	// Standard tool result display
+	AddConversationTurn([this, DisplayText, bIsClarifyResult, bIsSceneQueryResult]()
+	{
+		return CreateToolResultWidget(DisplayText, bIsClarifyResult, bIsSceneQueryResult, false);
+	}, FMargin(12.0f, 6.0f, 12.0f, 10.0f));
+}
 
-					// Result icon
-					+ SHorizontalBox::Slot()
-					.AutoWidth()
-					.Padding(0.0f, 0.0f, 12.0f, 0.0f)
+TSharedRef<SWidget> SUnrealGPTWidget::CreateToolResultWidget(const FString& DisplayText, bool bIsClarifyResult, bool bIsSceneQueryResult, bool bIsScreenshot) const
+{
+	return WrapThreadTurn(
+		SNew(SBorder)
+		.BorderImage(FAppStyle::GetBrush("Brushes.White"))
+		.BorderBackgroundColor(FStyleColors::Panel)
+		.Padding(FMargin(14.0f, 10.0f))
+		[
+			SNew(SHorizontalBox)
+
+			// Result icon
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.0f, 0.0f, 12.0f, 0.0f)
+			[
+				SNew(SBox)
+				.WidthOverride(32.0f)
+				.HeightOverride(32.0f)
+				[
+					SNew(SBorder)
+					.BorderImage(FAppStyle::GetBrush("Brushes.White"))
+					.BorderBackgroundColor(bIsClarifyResult ? FLinearColor(0.0f, 0.6f, 1.0f, 1.0f)
+						: (bIsSceneQueryResult ? FLinearColor(0.831f, 0.302f, 0.941f, 1.0f)
+						: (bIsScreenshot ? FLinearColor(1.0f, 0.478f, 0.239f, 1.0f) : FLinearColor(0.129f, 0.773f, 0.369f, 1.0f))))
+					.Padding(0.0f)
+					.HAlign(HAlign_Center)
+					.VAlign(VAlign_Center)
 					[
-						SNew(SBox)
-						.WidthOverride(32.0f)
-						.HeightOverride(32.0f)
-						[
-							SNew(SBorder)
-							.BorderImage(FAppStyle::GetBrush("Brushes.White"))
-							.BorderBackgroundColor(bIsClarifyResult ? FLinearColor(0.0f, 0.6f, 1.0f, 1.0f)
-								: (bIsSceneQueryResult ? FLinearColor(0.831f, 0.302f, 0.941f, 1.0f)
-								: (bIsScreenshot ? FLinearColor(1.0f, 0.478f, 0.239f, 1.0f) : FLinearColor(0.129f, 0.773f, 0.369f, 1.0f))))
-							.Padding(0.0f)
-							.HAlign(HAlign_Center)
-							.VAlign(VAlign_Center)
-							[
-								SNew(STextBlock)
-								.Font(FAppStyle::Get().GetFontStyle("FontAwesome.12"))
-								.Text(FText::FromString(bIsScreenshot ? FString(TEXT("\xf030"))
-									: (bIsClarifyResult ? FString(TEXT("\xf059")) : FString(TEXT("\xf00c")))))
-								.ColorAndOpacity(FStyleColors::ForegroundInverted)
-							]
-						]
+						SNew(STextBlock)
+						.Font(FAppStyle::Get().GetFontStyle("FontAwesome.12"))
+						.Text(FText::FromString(bIsScreenshot ? FString(TEXT("\xf030"))
+							: (bIsClarifyResult ? FString(TEXT("\xf059")) : FString(TEXT("\xf00c")))))
+						.ColorAndOpacity(FStyleColors::ForegroundInverted)
 					]
+				]
+			]
 
-					// Result content
-					+ SHorizontalBox::Slot()
-					.FillWidth(1.0f)
-					[
-						SNew(SVerticalBox)
+			// Result content
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SVerticalBox)
 
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						.Padding(0.0f, 0.0f, 0.0f, 6.0f)
-						[
-							SNew(STextBlock)
-							.Text(bIsClarifyResult
-								? NSLOCTEXT("UnrealGPT", "ClarifyResult", "Clarification")
-								: NSLOCTEXT("UnrealGPT", "ToolResult", "Tool Result"))
-							.Font(UnrealGPTAgentUI::CaptionFont())
-							.ColorAndOpacity(FStyleColors::Foreground)
-						]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(0.0f, 0.0f, 0.0f, 6.0f)
+				[
+					SNew(STextBlock)
+					.Text(bIsClarifyResult
+						? NSLOCTEXT("UnrealGPT", "ClarifyResult", "Clarification")
+						: NSLOCTEXT("UnrealGPT", "ToolResult", "Tool Result"))
+					.Font(UnrealGPTAgentUI::CaptionFont())
+					.ColorAndOpacity(FStyleColors::Foreground)
+				]
 
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						[
-							SNew(STextBlock)
-							.Text(FText::FromString(DisplayText))
-							.AutoWrapText(true)
-							.Font(bIsSceneQueryResult || bIsClarifyResult ? UnrealGPTAgentUI::BodyFont() : FCoreStyle::GetDefaultFontStyle("Mono", 8))
-							.ColorAndOpacity(FStyleColors::Foreground)
-						]
-					]
-				],
-				HAlign_Left),
-			FMargin(12.0f, 6.0f, 12.0f, 10.0f));
-	}
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(DisplayText))
+					.AutoWrapText(true)
+					.Font(bIsSceneQueryResult || bIsClarifyResult ? UnrealGPTAgentUI::BodyFont() : FCoreStyle::GetDefaultFontStyle("Mono", 8))
+					.ColorAndOpacity(FStyleColors::Foreground)
+				]
+			]
+		],
+		HAlign_Left);
 }
 
 FReply SUnrealGPTWidget::OnVoiceInputClicked()
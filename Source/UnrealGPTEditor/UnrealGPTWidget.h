@@ -17,9 +17,48 @@
 #include "Styling/SlateTypes.h"
 #include "UnrealGPTAgentClient.h"
 #include "UnrealGPTClarifyTypes.h"
+#include "UnrealGPTScreenshotPipeline.h"
+#include "Mcp/McpTypes.h"
 
 // Forward declaration from Slate (declared as struct in Engine headers)
 struct FSlateBrush;
+struct FUnrealGPTDownloadProgress;
+class SUnrealGPTMarkdownView;
+
+/** Chat styling shared by the widgets that render transcript text. */
+namespace UnrealGPTAgentUI
+{
+	FSlateFontInfo BodyFont();
+	FSlateFontInfo BodyBoldFont();
+
+	/** One chat line with very lightweight inline markdown support (**bold** only). */
+	TSharedRef<SWidget> CreateInlineMarkdownTextWidget(const FString& Line);
+
+	/** Thumbnail image drawn from a texture leased from Pool; the widget owns the lease. Null if no slot was granted. */
+	UNREALGPTEDITOR_API TSharedPtr<SWidget> CreateThumbnailImage(const FUnrealGPTThumbnailPtr& Thumbnail, FUnrealGPTThumbnailPool& Pool);
+}
+
+/**
+ * One turn in the chat transcript. Rows are only realized while scrolled into view, so each item keeps
+ * what is needed to rebuild its widget rather than the widget itself.
+ */
+struct FUnrealGPTTranscriptItem
+{
+	/** Recreates the row content whenever the row is realized. */
+	TFunction<TSharedRef<SWidget>()> BuildWidget;
+
+	/** Built once and kept across virtualization, for widgets holding user input (clarify answers) or a message still streaming in. */
+	TSharedPtr<SWidget> PinnedWidget;
+
+	/** Screenshot turns show a placeholder until the worker has decoded Screenshot; a texture is only leased while the row is realized. */
+	bool bScreenshot = false;
+	FUnrealGPTThumbnailPtr Screenshot;
+
+	FMargin Padding;
+
+	/** Height the row last had on screen; a regenerated row keeps at least this much so scrolling back does not jump. */
+	float MeasuredHeight = 0.0f;
+};
 
 class SUnrealGPTWidget : public SCompoundWidget
 {
@@ -39,14 +78,14 @@ public:
 	friend class UUnrealGPTWidgetDelegateHandler;
 
 private:
-	/** Create chat message widget */
-	TSharedRef<SWidget> CreateMessageWidget(const FString& Role, const FString& Content);
+	/** Create chat message widget; OutMarkdownView receives the view rendering Content */
+	TSharedRef<SWidget> CreateMessageWidget(const FString& Role, const FString& Content, TSharedPtr<SUnrealGPTMarkdownView>* OutMarkdownView = nullptr);
 
 	/** Create tool call widget */
 	TSharedRef<SWidget> CreateToolCallWidget(const FString& ToolName, const FString& Arguments, const FString& Result);
 
 	/** Parse markdown to rich text for better message display */
-	TSharedRef<SWidget> CreateMarkdownWidget(const FString& Content);
+	TSharedRef<SUnrealGPTMarkdownView> CreateMarkdownWidget(const FString& Content);
 
 	/** Create specialized widget for specific tool types */
 	TSharedRef<SWidget> CreateToolSpecificWidget(const FString& ToolName, const FString& Arguments, const FString& Result);
@@ -114,9 +153,19 @@ private:
 	/** Handle agent message delegate - called from agent client */
 	void HandleAgentMessage(const FString& Role, const FString& Content, const TArray<FString>& ToolCalls);
 
+	/** Append streamed assistant text to the open assistant turn, starting one if needed */
+	void HandleAgentMessageDelta(const FString& Delta);
+
+	/** Unpin the open assistant turn, keeping the text streamed so far; for failed, canceled or abandoned streams */
+	void FinishStreamingTurn();
+
 	/** Handle agent reasoning delegate - called from agent client */
 	void HandleAgentReasoning(const FString& ReasoningContent);
 
+	/** Update the MCP label from a subsystem status snapshot. */
+	void HandleMcpStatusChanged(const FMcpStatusSnapshot& Snapshot);
+	void HandleDownloadProgressChanged(const FUnrealGPTDownloadProgress& Progress);
+
 	/** Handle tool call delegate - called from agent client */
 	void HandleToolCall(const FString& ToolCallId, const FString& ToolName, const FString& Arguments);
 
@@ -125,9 +174,27 @@ private:
 
 	void AppendSystemMessage(const FString& Content);
 
-	/** Adds a widget to the conversation scroll and updates empty-state chrome. */
+	/** Appends a transcript turn whose widget is rebuilt each time its row scrolls into view. */
+	void AddConversationTurn(TFunction<TSharedRef<SWidget>()> BuildWidget, const FMargin& SlotPadding = FMargin(0.f, 0.f, 0.f, 12.f));
+
+	/** Appends a transcript turn that keeps Content alive while offscreen; use for stateful widgets only. */
 	void AddConversationTurnWidget(const TSharedRef<SWidget>& Content, const FMargin& SlotPadding = FMargin(0.f, 0.f, 0.f, 12.f));
 
+	/** Appends a screenshot turn right away and decodes the base64 PNG on a worker; the row fills in when done. */
+	void AddScreenshotTurn(FString Base64Png);
+
+	void AddTranscriptItem(const TSharedRef<FUnrealGPTTranscriptItem>& Item);
+
+	TSharedRef<ITableRow> OnGenerateTranscriptRow(TSharedPtr<FUnrealGPTTranscriptItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+	/** Widget shown inside Item's row: the pinned widget, the screenshot or BuildWidget's result. */
+	TSharedRef<SWidget> CreateTranscriptRowContent(FUnrealGPTTranscriptItem& Item);
+
+	/** Screenshot row content; leases a pooled texture for the decoded thumbnail, released with the widget. */
+	TSharedRef<SWidget> CreateScreenshotWidget(const FUnrealGPTTranscriptItem& Item) const;
+
+	TSharedRef<SWidget> CreateToolResultWidget(const FString& DisplayText, bool bIsClarifyResult, bool bIsSceneQueryResult, bool bIsScreenshot) const;
+
 	void SyncEmptyThreadVisibility();
 
 	void ResetCodexLoginProcess();
@@ -151,11 +218,15 @@ private:
 	UPROPERTY()
 	class UUnrealGPTWidgetDelegateHandler* DelegateHandler;
 
-	/** Chat history scroll box */
-	TSharedPtr<class SScrollBox> ChatHistoryBox;
+	/** Virtualized chat transcript; only visible turns have realized widgets. */
+	TSharedPtr<SListView<TSharedPtr<FUnrealGPTTranscriptItem>>> TranscriptView;
+
+	/** Transcript data model backing TranscriptView. */
+	TArray<TSharedPtr<FUnrealGPTTranscriptItem>> TranscriptItems;
 
-	/** Number of primary turns in the thread (each AddConversationTurnWidget increments). */
-	int32 ChatConversationBlockCount = 0;
+	/** Assistant turn receiving OnAgentMessageDelta text; finished by the next HandleAgentMessage. */
+	TSharedPtr<FUnrealGPTTranscriptItem> StreamingItem;
+	TSharedPtr<SUnrealGPTMarkdownView> StreamingView;
 
 	/** Centered onboarding when the thread has no turns. */
 	TSharedPtr<class SBorder> EmptyThreadChrome;
@@ -214,6 +285,9 @@ private:
 	/** Thumbnail pool for asset attachment chips */
 	TSharedPtr<class FAssetThumbnailPool> AssetThumbnailPool;
 
+	/** Textures for the screenshot rows currently on screen. */
+	TSharedPtr<FUnrealGPTThumbnailPool> ScreenshotTexturePool;
+
 	/** Keep asset thumbnails alive for Slate */
 	TArray<TSharedPtr<class FAssetThumbnail>> AssetThumbnailWidgets;
 
@@ -229,15 +303,20 @@ private:
 	/** Brushes backing attached-image thumbnails so Slate never references freed memory */
 	TArray<TSharedPtr<FSlateBrush>> AttachmentBrushes;
 
-	/** Persistent brushes for screenshots to ensure Slate does not reference freed memory */
-	TArray<TSharedPtr<FSlateBrush>> ScreenshotBrushes;
-
 	/** Session status chip in the harness header (Idle / Running). */
 	TSharedPtr<STextBlock> SessionStatusLabel;
 
 	/** MCP connection summary shown when servers are configured. */
 	TSharedPtr<STextBlock> McpStatusLabel;
 
+	FDelegateHandle McpStatusChangedHandle;
+	/** Refreshes the MCP label when bEnableMcpTool is toggled, which publishes no snapshot by itself. */
+	FDelegateHandle SettingsChangedHandle;
+
+	/** Progress of generated-output downloads; collapsed while nothing is downloading. */
+	TSharedPtr<STextBlock> DownloadStatusLabel;
+	FDelegateHandle DownloadProgressChangedHandle;
+
 	/** Compact, dynamic area that shows when the agent is reasoning and its reasoning summary */
 	TSharedPtr<class SBorder> ReasoningStatusBorder;
 
@@ -26,6 +26,14 @@ void UUnrealGPTWidgetDelegateHandler::OnAgentMessageReceived(const FString& Role
 	}
 }
 
+void UUnrealGPTWidgetDelegateHandler::OnAgentMessageDeltaReceived(const FString& Delta)
+{
+	if (Widget)
+	{
+		Widget->HandleAgentMessageDelta(Delta);
+	}
+}
+
 void UUnrealGPTWidgetDelegateHandler::OnAgentReasoningReceived(const FString& ReasoningContent)
 {
 	if (Widget)
@@ -20,6 +20,9 @@ public:
 	UFUNCTION()
 	void OnAgentMessageReceived(const FString& Role, const FString& Content, const TArray<FString>& ToolCalls);
 
+	UFUNCTION()
+	void OnAgentMessageDeltaReceived(const FString& Delta);
+
 	UFUNCTION()
 	void OnAgentReasoningReceived(const FString& ReasoningContent);
 
@@ -19,13 +19,38 @@ IMPLEMENT_MODULE(FUnrealGPTEditorTestsModule, UnrealGPTEditorTests)
 #include "HAL/FileManager.h"
 #include "UnrealGPTSceneContext.h"
 #include "UnrealGPTReflectionQuery.h"
+#include "UnrealGPTReflectionSearch.h"
+#include "UnrealGPTReflectionSnapshot.h"
+#include "UnrealGPTReflectionIndex.h"
+#include "Async/Async.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/ObjectRedirector.h"
+#include <atomic>
 #include "UnrealGPTBlueprintContext.h"
+#include "UnrealGPTBlueprintGraph.h"
+#include "Engine/Blueprint.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
 #include "UnrealGPTLogCapture.h"
 #include "UnrealGPTLogReader.h"
+#include "UnrealGPTPythonRunner.h"
+#include "UnrealGPTMarkdown.h"
+#include "UnrealGPTScreenshotPipeline.h"
+#include "UnrealGPTWidget.h"
+#include "ImageUtils.h"
+#include "Misc/Base64.h"
 #include "Serialization/JsonSerializer.h"
 #include "UnrealGPTSettings.h"
+#include "UnrealGPTCodexAuth.h"
+#include "UnrealGPTDownloadManager.h"
+#include "UnrealGPTVoiceStream.h"
+#include "UnrealGPTFlacEncoder.h"
+#include "Misc/SecureHash.h"
+#include "UnrealGPTReplicateClient.h"
 #include "UnrealGPTAgentClient.h"
 #include "Mcp/McpResultNormalizer.h"
+#include "Mcp/UnrealGPTMcpSubsystem.h"
+#include "Editor.h"
 #include "UnrealGPTSseClient.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTSettingsTest, "UnrealGPT.Settings", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
@@ -81,9 +106,122 @@ bool FUnrealGPTReflectionQueryTest::RunTest(const FString& Parameters)
 	TestTrue(TEXT("StaticMeshActor query should succeed"), StaticMeshActorResult.Contains(TEXT("\"status\":\"ok\"")));
 	TestTrue(TEXT("StaticMeshActor query should match Mobility"), StaticMeshActorResult.Contains(TEXT("Mobility")));
 
+	// The agent answers native classes from the snapshot on a worker thread and leaves the rest to Query
+	if (FUnrealGPTReflectionIndex::Get().GetSnapshot().IsValid())
+	{
+		FString WorkerResult;
+		bool bWorkerAnswered = false;
+		Async(EAsyncExecution::ThreadPool, [&StaticMeshActorQuery, &WorkerResult, &bWorkerAnswered]()
+		{
+			bWorkerAnswered = FUnrealGPTReflectionQuery::TryQuerySnapshot(StaticMeshActorQuery, WorkerResult);
+		}).Wait();
+		TestTrue(TEXT("Snapshot should answer a native class off the game thread"), bWorkerAnswered);
+		TestEqual(TEXT("Snapshot answer should match Query"), WorkerResult, StaticMeshActorResult);
+	}
+	FString UnansweredResult;
+	TestFalse(TEXT("Snapshot should leave batches to Query"),
+		FUnrealGPTReflectionQuery::TryQuerySnapshot(TEXT("{\"classes\":[\"StaticMeshActor\"]}"), UnansweredResult));
+	TestFalse(TEXT("Snapshot should leave unknown classes to Query"),
+		FUnrealGPTReflectionQuery::TryQuerySnapshot(TEXT("{\"class_name\":\"ThisClassDefinitelyDoesNotExist_12345\"}"), UnansweredResult));
+
 	const FString MissingClassResult = FUnrealGPTReflectionQuery::Query(TEXT("{\"class_name\":\"ThisClassDefinitelyDoesNotExist_12345\"}"));
 	TestTrue(TEXT("Missing class should return error"), MissingClassResult.Contains(TEXT("\"status\":\"error\"")));
 
+	const FString CachedResult = FUnrealGPTReflectionQuery::Query(StaticMeshActorQuery);
+	TestEqual(TEXT("Repeated query should return the cached schema"), CachedResult, StaticMeshActorResult);
+
+	const FString MisspelledResult = FUnrealGPTReflectionQuery::Query(TEXT("{\"class_name\":\"StaticMeshActr\"}"));
+	TestTrue(TEXT("Misspelled class should return error"), MisspelledResult.Contains(TEXT("\"status\":\"error\"")));
+	TestTrue(TEXT("Misspelled class should suggest fuzzy candidates"), MisspelledResult.Contains(TEXT("StaticMeshActor")));
+
+	const FString BatchResult = FUnrealGPTReflectionQuery::Query(
+		TEXT("{\"classes\":[\"StaticMeshActor\",{\"class_name\":\"SkeletalMeshActor\"}],\"include_super\":true,\"max_results\":200}"));
+	TSharedPtr<FJsonObject> BatchJson;
+	TSharedRef<TJsonReader<>> BatchReader = TJsonReaderFactory<>::Create(BatchResult);
+	if (TestTrue(TEXT("Batch query should return JSON"), FJsonSerializer::Deserialize(BatchReader, BatchJson) && BatchJson.IsValid()))
+	{
+		const TArray<TSharedPtr<FJsonValue>>* BatchResults = nullptr;
+		if (TestTrue(TEXT("Batch query should return results"), BatchJson->TryGetArrayField(TEXT("results"), BatchResults) && BatchResults)
+			&& TestEqual(TEXT("Batch query should return one result per class"), BatchResults->Num(), 2))
+		{
+			TestTrue(TEXT("Second class should omit inherited AActor members"), (*BatchResults)[1]->AsObject()->HasField(TEXT("inherited_omitted")));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTReflectionSnapshotTest, "UnrealGPT.ReflectionSnapshot", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTReflectionSnapshotTest::RunTest(const FString& Parameters)
+{
+	const FString SnapshotPath = FPaths::ProjectIntermediateDir() / TEXT("UnrealGPTTests") / TEXT("ReflectionSnapshot.bin");
+
+	TSharedRef<FUnrealGPTReflectionSnapshot> Captured = FUnrealGPTReflectionSnapshot::CaptureNativeClasses();
+	TestTrue(TEXT("Snapshot should contain native classes"), Captured->GetClasses().Num() > 0);
+	TestTrue(TEXT("Snapshot should save"), Captured->SaveToFile(SnapshotPath));
+
+	TSharedPtr<FUnrealGPTReflectionSnapshot> Loaded = FUnrealGPTReflectionSnapshot::LoadFromFile(SnapshotPath);
+	IFileManager::Get().Delete(*SnapshotPath);
+	if (!TestTrue(TEXT("Snapshot should load"), Loaded.IsValid()))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Loaded class count"), Loaded->GetClasses().Num(), Captured->GetClasses().Num());
+	TestTrue(TEXT("Freshly captured snapshot should be current"), Loaded->IsCurrent());
+
+	TArray<const FUnrealGPTReflectedClass*> Matches;
+	Loaded->FindByName(TEXT("StaticMeshActor"), Matches);
+	if (TestEqual(TEXT("StaticMeshActor should be in the snapshot"), Matches.Num(), 1))
+	{
+		const FUnrealGPTReflectedClass* Super = Loaded->FindSuper(*Matches[0]);
+		TestTrue(TEXT("StaticMeshActor super should resolve"), Super && Super->Name == TEXT("Actor"));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTReflectionSearchTest, "UnrealGPT.ReflectionSearch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTReflectionSearchTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Terms;
+	FUnrealGPTReflectionSearchIndex::Tokenize(TEXT("K2_SetStaticMesh HTTPRequest materials"), Terms);
+	TestEqual(TEXT("Identifiers should split on case, underscores and plurals"),
+		FString::Join(Terms, TEXT(" ")), FString(TEXT("k2 set static mesh http request material")));
+
+	TSharedRef<FUnrealGPTReflectionSnapshot> Snapshot = FUnrealGPTReflectionSnapshot::CaptureNativeClasses();
+	TSharedRef<FUnrealGPTReflectionSearchIndex> Index = FUnrealGPTReflectionSearchIndex::Build(Snapshot);
+	TestTrue(TEXT("Search index should contain members"), Index->GetDocumentCount() > 0);
+
+	FUnrealGPTReflectionSearchIndex::FSearchFilter Filter;
+	Filter.Kind = FUnrealGPTReflectionSearchIndex::EMemberKind::Function;
+	Filter.MaxResults = 10;
+
+	TArray<FUnrealGPTReflectionSearchIndex::FHit> Hits;
+	Index->Search(TEXT("set static mesh"), Filter, Hits);
+	const bool bFoundSetStaticMesh = Hits.ContainsByPredicate([](const FUnrealGPTReflectionSearchIndex::FHit& Hit)
+	{
+		return Hit.Function && Hit.Function->Name == TEXT("SetStaticMesh");
+	});
+	TestTrue(TEXT("'set static mesh' should rank SetStaticMesh"), bFoundSetStaticMesh);
+
+	const FString IndexPath = FPaths::ProjectIntermediateDir() / TEXT("UnrealGPTTests") / TEXT("ReflectionSearch.bin");
+	TestTrue(TEXT("Search index should save"), Index->SaveToFile(IndexPath));
+	TSharedPtr<FUnrealGPTReflectionSearchIndex> Loaded = FUnrealGPTReflectionSearchIndex::LoadFromFile(IndexPath, Snapshot);
+
+	// A truncated cache is rejected so the caller rebuilds it
+	TArray<uint8> Saved;
+	FFileHelper::LoadFileToArray(Saved, *IndexPath);
+	Saved.SetNum(Saved.Num() / 2);
+	FFileHelper::SaveArrayToFile(Saved, *IndexPath);
+	TestFalse(TEXT("Truncated search index should not load"), FUnrealGPTReflectionSearchIndex::LoadFromFile(IndexPath, Snapshot).IsValid());
+	IFileManager::Get().Delete(*IndexPath);
+	if (TestTrue(TEXT("Search index should load for its snapshot"), Loaded.IsValid()))
+	{
+		TestEqual(TEXT("Loaded document count"), Loaded->GetDocumentCount(), Index->GetDocumentCount());
+	}
+
 	return true;
 }
 
@@ -120,6 +258,33 @@ bool FUnrealGPTSseParserTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTSseBodyStreamTest, "UnrealGPT.SseBodyStream", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTSseBodyStreamTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Data;
+	FUnrealGPTSseBodyStream Stream([&Data](const FUnrealGPTSseEvent& Event) { Data.Add(Event.Data); });
+
+	// Chunks split events and lines anywhere, including inside a multi-byte character
+	const FTCHARToUTF8 Body(TEXT("data: {\"delta\":\"caf\u00e9\"}\r\n\r\ndata: {\"delta\":\"!\"}\n\n"));
+	const uint8* Bytes = reinterpret_cast<const uint8*>(Body.Get());
+	const int32 SplitA = 20;
+	const int32 SplitB = 30;
+	Stream.Serialize(const_cast<uint8*>(Bytes), SplitA);
+	TestEqual(TEXT("No event before its blank line"), Data.Num(), 0);
+	Stream.Serialize(const_cast<uint8*>(Bytes + SplitA), SplitB - SplitA);
+	TestEqual(TEXT("First event reported as soon as it ends"), Data.Num(), 1);
+	Stream.Serialize(const_cast<uint8*>(Bytes + SplitB), Body.Length() - SplitB);
+
+	TestEqual(TEXT("Both events reported"), Data.Num(), 2);
+	if (Data.Num() == 2)
+	{
+		TestEqual(TEXT("Multi-byte text survives the chunk split"), Data[0], FString(TEXT("{\"delta\":\"caf\u00e9\"}")));
+	}
+	TestTrue(TEXT("Whole body kept for the completion handler"), Stream.GetBody().EndsWith(TEXT("{\"delta\":\"!\"}\n\n")));
+	return true;
+}
+
 static FString BuildTestLogLine(const FString& Category, const FString& Verbosity, const FString& Message, int32 LineNumber)
 {
 	return FString::Printf(
@@ -234,6 +399,47 @@ bool FUnrealGPTLogReaderSinceLastReadTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTLogCaptureSubscriptionTest, "UnrealGPT.LogCapture.Subscription", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTLogCaptureSubscriptionTest::RunTest(const FString& Parameters)
+{
+	FUnrealGPTLogCapture& Capture = FUnrealGPTLogCapture::Get();
+	Capture.Initialize();
+
+	FUnrealGPTLogSubscriptionFilter Filter;
+	Filter.MinVerbosity = ELogVerbosity::Error;
+	Filter.CategoryContains = TEXT("LogPython");
+	Filter.MessageRegex = TEXT("sub-test-[0-9]+");
+	Filter.MaxBufferedLines = 1;
+	const int32 SubscriptionId = Capture.Subscribe(Filter);
+
+	Capture.Serialize(TEXT("sub-test-1 first error"), ELogVerbosity::Error, FName(TEXT("LogPython")));
+	Capture.Serialize(TEXT("sub-test-2 only a warning"), ELogVerbosity::Warning, FName(TEXT("LogPython")));
+	Capture.Serialize(TEXT("sub-test-3 wrong category"), ELogVerbosity::Error, FName(TEXT("LogBlueprint")));
+	Capture.Serialize(TEXT("no regex match"), ELogVerbosity::Error, FName(TEXT("LogPython")));
+	Capture.Serialize(TEXT("sub-test-4 second error"), ELogVerbosity::Error, FName(TEXT("LogPython")));
+
+	const FUnrealGPTLogSubscriptionResult Drained = Capture.Drain(SubscriptionId);
+	TestEqual(TEXT("Subscription should count both matching errors"), Drained.TotalMatched, 2);
+	TestEqual(TEXT("Subscription should cap buffered lines"), Drained.Lines.Num(), 1);
+	if (Drained.Lines.Num() == 1)
+	{
+		TestTrue(TEXT("Subscription should keep the first match"), Drained.Lines[0].Message.Contains(TEXT("sub-test-1")));
+	}
+
+	Capture.Serialize(TEXT("sub-test-5 after drain"), ELogVerbosity::Error, FName(TEXT("LogPython")));
+	const FUnrealGPTLogSubscriptionResult Closed = Capture.Unsubscribe(SubscriptionId);
+	TestEqual(TEXT("Unsubscribe should return lines since last drain"), Closed.TotalMatched, 1);
+
+	Capture.Serialize(TEXT("sub-test-6 after close"), ELogVerbosity::Error, FName(TEXT("LogPython")));
+	TestEqual(TEXT("Closed subscription should not buffer"), Capture.Drain(SubscriptionId).TotalMatched, 0);
+
+	const TSharedPtr<FJsonObject> Digest = FUnrealGPTLogReader::BuildDigest(Closed);
+	TestEqual(TEXT("Digest should report total matched"), static_cast<int32>(Digest->GetNumberField(TEXT("total_matched"))), 1);
+
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTLogReaderErrorTest, "UnrealGPT.LogReader.Error", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
 bool FUnrealGPTLogReaderErrorTest::RunTest(const FString& Parameters)
@@ -354,5 +560,1124 @@ bool FUnrealGPTBlueprintToolsTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTBlueprintApplyEditsTest, "UnrealGPT.BlueprintApplyEdits", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTBlueprintApplyEditsTest::RunTest(const FString& Parameters)
+{
+	const FString AssetPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_ApplyEditsTest_%d"), FPlatformTime::Cycles());
+	const FString CreateResult = UUnrealGPTBlueprintContext::Create(
+		FString::Printf(TEXT("{\"asset_path\":\"%s\",\"parent_class\":\"/Script/Engine.Actor\"}"), *AssetPath));
+	TestTrue(TEXT("Blueprint create should succeed"), CreateResult.Contains(TEXT("\"status\":\"ok\"")));
+
+	const FString NormalizedPath = AssetPath + TEXT(".") + FPaths::GetCleanFilename(AssetPath);
+	const FString BatchArgs = FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"compile\":true,\"ops\":[")
+		TEXT("{\"op\":\"add_variable\",\"name\":\"bBatchFlag\",\"type\":\"bool\"},")
+		TEXT("{\"op\":\"add_node\",\"id\":\"begin\",\"node_type\":\"Event\",\"params\":{\"event_name\":\"ReceiveBeginPlay\"}},")
+		TEXT("{\"op\":\"add_node\",\"id\":\"print\",\"node_type\":\"PrintString\"},")
+		TEXT("{\"op\":\"connect_pins\",\"from_node\":\"begin\",\"from_pin\":\"then\",\"to_node\":\"print\",\"to_pin\":\"execute\"},")
+		TEXT("{\"op\":\"set_pin_default\",\"node\":\"print\",\"pin_name\":\"InString\",\"value\":\"Batch test\"},")
+		TEXT("{\"op\":\"add_node\",\"id\":\"set_flag\",\"node_type\":\"VariableSet\",\"params\":{\"variable_name\":\"bBatchFlag\"}},")
+		TEXT("{\"op\":\"set_pin_default\",\"node\":\"set_flag\",\"pin_name\":\"bBatchFlag\",\"value\":\"true\"}]}"),
+		*NormalizedPath);
+	const FString BatchResult = UUnrealGPTBlueprintContext::ApplyEdits(BatchArgs);
+	TestTrue(TEXT("Batch should succeed"), BatchResult.Contains(TEXT("\"status\":\"ok\"")));
+	TestTrue(TEXT("Batch should compile"), BatchResult.Contains(TEXT("\"compile_success\":true")));
+	TestTrue(TEXT("Batch should map local ids to GUIDs"), BatchResult.Contains(TEXT("\"node_ids\"")) && BatchResult.Contains(TEXT("\"print\":\"{")));
+
+	// The second op references an id that was never declared, so the whole batch is undone.
+	const FString FailingArgs = FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"ops\":[")
+		TEXT("{\"op\":\"add_variable\",\"name\":\"bRolledBackFlag\",\"type\":\"bool\"},")
+		TEXT("{\"op\":\"add_node\",\"id\":\"branch\",\"node_type\":\"Branch\"},")
+		TEXT("{\"op\":\"connect_pins\",\"from_node\":\"missing\",\"from_pin\":\"then\",\"to_node\":\"branch\",\"to_pin\":\"execute\"},")
+		TEXT("{\"op\":\"remove_node\",\"node\":\"branch\"}]}"),
+		*NormalizedPath);
+	const FString FailingResult = UUnrealGPTBlueprintContext::ApplyEdits(FailingArgs);
+	TestTrue(TEXT("Failing batch should report an error"), FailingResult.Contains(TEXT("\"status\":\"error\"")));
+	TestTrue(TEXT("Failing batch should be rolled back"), FailingResult.Contains(TEXT("\"rolled_back\":true")));
+	TestTrue(TEXT("Ops after the failure should be skipped"), FailingResult.Contains(TEXT("\"status\":\"skipped\"")));
+
+	const FString QueryResult = UUnrealGPTBlueprintContext::Query(FString::Printf(TEXT("{\"asset_path\":\"%s\"}"), *NormalizedPath));
+	TestTrue(TEXT("Batch variable should exist"), QueryResult.Contains(TEXT("bBatchFlag")));
+	TestFalse(TEXT("Rolled back Branch node should not exist"), QueryResult.Contains(TEXT("K2Node_IfThenElse")));
+	TestFalse(TEXT("Rolled back variable should not exist"), QueryResult.Contains(TEXT("bRolledBackFlag")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTBlueprintLookupCacheTest, "UnrealGPT.BlueprintLookupCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTBlueprintLookupCacheTest::RunTest(const FString& Parameters)
+{
+	const FString AssetPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_LookupCacheTest_%d"), FPlatformTime::Cycles());
+	UUnrealGPTBlueprintContext::Create(FString::Printf(TEXT("{\"asset_path\":\"%s\"}"), *AssetPath));
+	const FString NormalizedPath = AssetPath + TEXT(".") + FPaths::GetCleanFilename(AssetPath);
+
+	// Lookups after a removal must see the graph change rather than a stale index entry.
+	const FString Args = FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"atomic\":false,\"ops\":[")
+		TEXT("{\"op\":\"add_node\",\"id\":\"print\",\"node_type\":\"PrintString\"},")
+		TEXT("{\"op\":\"set_pin_default\",\"node\":\"print\",\"pin_name\":\"InString\",\"value\":\"first\"},")
+		TEXT("{\"op\":\"set_pin_default\",\"node\":\"print\",\"pin_name\":\"NoSuchPin\",\"value\":\"x\"},")
+		TEXT("{\"op\":\"remove_node\",\"node\":\"print\"},")
+		TEXT("{\"op\":\"set_pin_default\",\"node\":\"print\",\"pin_name\":\"InString\",\"value\":\"second\"}]}"),
+		*NormalizedPath);
+	const FString Result = UUnrealGPTBlueprintContext::ApplyEdits(Args);
+
+	TSharedPtr<FJsonObject> Json;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result);
+	const TSharedPtr<FJsonObject>* Details = nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* Results = nullptr;
+	if (!TestTrue(TEXT("Result should parse"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+		&& Json->TryGetObjectField(TEXT("details"), Details) && (*Details)->TryGetArrayField(TEXT("results"), Results)))
+	{
+		return false;
+	}
+
+	const TCHAR* Expected[] = { TEXT("ok"), TEXT("ok"), TEXT("error"), TEXT("ok"), TEXT("error") };
+	TestEqual(TEXT("Every op should report a result"), Results->Num(), 5);
+	for (int32 Index = 0; Index < Results->Num() && Index < UE_ARRAY_COUNT(Expected); ++Index)
+	{
+		TestEqual(FString::Printf(TEXT("Op %d status"), Index), (*Results)[Index]->AsObject()->GetStringField(TEXT("status")), FString(Expected[Index]));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTBlueprintQueryDeltaTest, "UnrealGPT.BlueprintQueryDelta", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTBlueprintQueryDeltaTest::RunTest(const FString& Parameters)
+{
+	const FString AssetPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_QueryDeltaTest_%d"), FPlatformTime::Cycles());
+	UUnrealGPTBlueprintContext::Create(FString::Printf(TEXT("{\"asset_path\":\"%s\"}"), *AssetPath));
+	const FString NormalizedPath = AssetPath + TEXT(".") + FPaths::GetCleanFilename(AssetPath);
+
+	auto QueryDetails = [&NormalizedPath](const FString& SinceRevision) -> TSharedPtr<FJsonObject>
+	{
+		const FString Result = UUnrealGPTBlueprintContext::Query(FString::Printf(
+			TEXT("{\"asset_path\":\"%s\",\"since_revision\":\"%s\"}"), *NormalizedPath, *SinceRevision));
+		TSharedPtr<FJsonObject> Json;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result);
+		const TSharedPtr<FJsonObject>* Details = nullptr;
+		if (FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid() && Json->TryGetObjectField(TEXT("details"), Details))
+		{
+			return *Details;
+		}
+		return nullptr;
+	};
+
+	const TSharedPtr<FJsonObject> Full = QueryDetails(FString());
+	if (!TestTrue(TEXT("Full query should succeed"), Full.IsValid()))
+	{
+		return false;
+	}
+	const FString FirstRevision = Full->GetStringField(TEXT("revision"));
+	TestFalse(TEXT("Full query should return a revision"), FirstRevision.IsEmpty());
+	TestTrue(TEXT("Full query should list nodes"), Full->HasField(TEXT("nodes")));
+
+	const TSharedPtr<FJsonObject> Same = QueryDetails(FirstRevision);
+	TestTrue(TEXT("Unchanged Blueprint should keep its revision"), Same.IsValid() && Same->GetBoolField(TEXT("unchanged")));
+	TestEqual(TEXT("Unchanged Blueprint should report no changed nodes"), Same.IsValid() ? Same->GetArrayField(TEXT("changed_nodes")).Num() : -1, 0);
+	TestFalse(TEXT("Unchanged variables should be omitted"), Same.IsValid() && Same->HasField(TEXT("variables")));
+
+	const FString AddResult = UUnrealGPTBlueprintContext::AddNode(
+		FString::Printf(TEXT("{\"asset_path\":\"%s\",\"node_type\":\"Branch\"}"), *NormalizedPath));
+	TestTrue(TEXT("Add node should succeed"), AddResult.Contains(TEXT("\"status\":\"ok\"")));
+
+	const TSharedPtr<FJsonObject> Added = QueryDetails(FirstRevision);
+	TestEqual(TEXT("Delta should contain only the new node"), Added.IsValid() ? Added->GetArrayField(TEXT("changed_nodes")).Num() : -1, 1);
+	const FString SecondRevision = Added.IsValid() ? Added->GetStringField(TEXT("revision")) : FString();
+	TestNotEqual(TEXT("Edit should produce a new revision"), SecondRevision, FirstRevision);
+
+	const TSharedPtr<FJsonObject> Unknown = QueryDetails(TEXT("stale-1"));
+	TestTrue(TEXT("Unknown revision should fall back to a full query"), Unknown.IsValid() && Unknown->HasField(TEXT("delta_unavailable")) && Unknown->HasField(TEXT("nodes")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTBlueprintCompileDiagnosticsTest, "UnrealGPT.BlueprintCompileDiagnostics", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTBlueprintCompileDiagnosticsTest::RunTest(const FString& Parameters)
+{
+	const FString AssetPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_CompileDiagnosticsTest_%d"), FPlatformTime::Cycles());
+	UUnrealGPTBlueprintContext::Create(FString::Printf(TEXT("{\"asset_path\":\"%s\"}"), *AssetPath));
+	const FString NormalizedPath = AssetPath + TEXT(".") + FPaths::GetCleanFilename(AssetPath);
+
+	// Setting a variable that was never declared is a compile error owned by the VariableSet node.
+	const FString Args = FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"compile\":true,\"ops\":[")
+		TEXT("{\"op\":\"add_node\",\"id\":\"begin\",\"node_type\":\"Event\",\"params\":{\"event_name\":\"ReceiveBeginPlay\"}},")
+		TEXT("{\"op\":\"add_node\",\"id\":\"set\",\"node_type\":\"VariableSet\",\"params\":{\"variable_name\":\"UndeclaredVariable\"}},")
+		TEXT("{\"op\":\"connect_pins\",\"from_node\":\"begin\",\"from_pin\":\"then\",\"to_node\":\"set\",\"to_pin\":\"execute\"}]}"),
+		*NormalizedPath);
+	const FString Result = UUnrealGPTBlueprintContext::ApplyEdits(Args);
+
+	TSharedPtr<FJsonObject> Json;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result);
+	const TSharedPtr<FJsonObject>* Details = nullptr;
+	if (!TestTrue(TEXT("Result should parse"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+		&& Json->TryGetObjectField(TEXT("details"), Details)))
+	{
+		return false;
+	}
+
+	TestFalse(TEXT("Compile should fail"), (*Details)->GetBoolField(TEXT("compile_success")));
+	TestTrue(TEXT("Compile time should be reported"), (*Details)->HasField(TEXT("compile_ms")));
+
+	FString SetNodeGuid;
+	const TSharedPtr<FJsonObject>* NodeIds = nullptr;
+	TestTrue(TEXT("node_ids should map the VariableSet node"), (*Details)->TryGetObjectField(TEXT("node_ids"), NodeIds)
+		&& (*NodeIds)->TryGetStringField(TEXT("set"), SetNodeGuid) && !SetNodeGuid.IsEmpty());
+
+	// Blueprint-level diagnostics carry no node_guid, so only those that have one are compared.
+	bool bFoundNodeError = false;
+	for (const TSharedPtr<FJsonValue>& Value : (*Details)->GetArrayField(TEXT("diagnostics")))
+	{
+		const TSharedPtr<FJsonObject> Diagnostic = Value->AsObject();
+		FString NodeGuid;
+		bFoundNodeError |= Diagnostic->GetStringField(TEXT("severity")) == TEXT("error")
+			&& Diagnostic->TryGetStringField(TEXT("node_guid"), NodeGuid) && NodeGuid == SetNodeGuid;
+	}
+	TestTrue(TEXT("An error diagnostic should point at the VariableSet node"), bFoundNodeError);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTBlueprintCompileBatchTest, "UnrealGPT.BlueprintCompileBatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTBlueprintCompileBatchTest::RunTest(const FString& Parameters)
+{
+	const uint32 Stamp = FPlatformTime::Cycles();
+	const FString ParentPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_BatchParent_%u"), Stamp);
+	const FString ChildPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_BatchChild_%u"), Stamp);
+	const FString ParentObjectPath = ParentPath + TEXT(".") + FPaths::GetCleanFilename(ParentPath);
+	const FString ChildObjectPath = ChildPath + TEXT(".") + FPaths::GetCleanFilename(ChildPath);
+
+	UUnrealGPTBlueprintContext::Create(FString::Printf(TEXT("{\"asset_path\":\"%s\"}"), *ParentPath));
+	const FString ChildResult = UUnrealGPTBlueprintContext::Create(FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"parent_class\":\"%s_C\"}"), *ChildPath, *ParentObjectPath));
+	TestTrue(TEXT("Child Blueprint create should succeed"), ChildResult.Contains(TEXT("\"status\":\"ok\"")));
+
+	// Listed child first; the batch must still compile the parent before it.
+	const FString Result = UUnrealGPTBlueprintContext::CompileBatch(FString::Printf(
+		TEXT("{\"asset_paths\":[\"%s\",\"%s\"]}"), *ChildObjectPath, *ParentObjectPath));
+	TestTrue(TEXT("Batch compile should succeed"), Result.Contains(TEXT("\"status\":\"ok\"")));
+
+	const int32 ParentIndex = Result.Find(FPaths::GetCleanFilename(ParentPath) + TEXT("\""));
+	const int32 ChildIndex = Result.Find(FPaths::GetCleanFilename(ChildPath) + TEXT("\""));
+	TestTrue(TEXT("Both Blueprints should be reported"), ParentIndex != INDEX_NONE && ChildIndex != INDEX_NONE);
+	TestTrue(TEXT("Parent should be ordered before child"), ParentIndex < ChildIndex);
+
+	// A Blueprint component is a dependency too, even with no parent relationship.
+	const FString ComponentPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_BatchComponent_%u"), Stamp);
+	const FString ComponentObjectPath = ComponentPath + TEXT(".") + FPaths::GetCleanFilename(ComponentPath);
+	UUnrealGPTBlueprintContext::Create(FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"parent_class\":\"/Script/Engine.ActorComponent\"}"), *ComponentPath));
+	UBlueprint* ComponentBlueprint = LoadObject<UBlueprint>(nullptr, *ComponentObjectPath);
+	UBlueprint* ChildBlueprint = LoadObject<UBlueprint>(nullptr, *ChildObjectPath);
+	TestTrue(TEXT("Component and child Blueprints should load"), ComponentBlueprint && ChildBlueprint && ChildBlueprint->SimpleConstructionScript);
+	if (ComponentBlueprint && ChildBlueprint && ChildBlueprint->SimpleConstructionScript)
+	{
+		USimpleConstructionScript* Script = ChildBlueprint->SimpleConstructionScript;
+		Script->AddNode(Script->CreateNode(ComponentBlueprint->GeneratedClass, TEXT("BatchComponent")));
+
+		TArray<UBlueprint*> Order = { ChildBlueprint, ComponentBlueprint };
+		FUnrealGPTBlueprintGraph::SortDependenciesFirst(Order);
+		TestTrue(TEXT("Component Blueprint should sort before the Blueprint that adds it"), Order[0] == ComponentBlueprint);
+	}
+
+	const FString Missing = UUnrealGPTBlueprintContext::CompileBatch(TEXT("{}"));
+	TestTrue(TEXT("Empty batch should be rejected"), Missing.Contains(TEXT("\"status\":\"error\"")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTBlueprintCompactQueryTest, "UnrealGPT.BlueprintCompactQuery", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTBlueprintCompactQueryTest::RunTest(const FString& Parameters)
+{
+	const FString AssetPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_CompactQueryTest_%d"), FPlatformTime::Cycles());
+	UUnrealGPTBlueprintContext::Create(FString::Printf(TEXT("{\"asset_path\":\"%s\"}"), *AssetPath));
+	const FString NormalizedPath = AssetPath + TEXT(".") + FPaths::GetCleanFilename(AssetPath);
+
+	UUnrealGPTBlueprintContext::ApplyEdits(FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"ops\":[")
+		TEXT("{\"op\":\"add_node\",\"id\":\"begin\",\"node_type\":\"Event\",\"params\":{\"event_name\":\"ReceiveBeginPlay\"}},")
+		TEXT("{\"op\":\"add_node\",\"id\":\"print\",\"node_type\":\"PrintString\"},")
+		TEXT("{\"op\":\"connect_pins\",\"from_node\":\"begin\",\"from_pin\":\"then\",\"to_node\":\"print\",\"to_pin\":\"execute\"}]}"),
+		*NormalizedPath));
+
+	const FString Full = UUnrealGPTBlueprintContext::Query(FString::Printf(TEXT("{\"asset_path\":\"%s\"}"), *NormalizedPath));
+	const FString Compact = UUnrealGPTBlueprintContext::Query(FString::Printf(TEXT("{\"asset_path\":\"%s\",\"format\":\"compact\"}"), *NormalizedPath));
+	TestTrue(TEXT("Compact query should succeed"), Compact.Contains(TEXT("\"status\":\"ok\"")));
+	TestTrue(TEXT("Compact result should be smaller than the full one"), Compact.Len() < Full.Len());
+
+	TSharedPtr<FJsonObject> Json;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Compact);
+	const TSharedPtr<FJsonObject>* Details = nullptr;
+	if (!TestTrue(TEXT("Compact result should parse"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+		&& Json->TryGetObjectField(TEXT("details"), Details)))
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>& Nodes = (*Details)->GetArrayField(TEXT("nodes"));
+	const TArray<TSharedPtr<FJsonValue>>& Edges = (*Details)->GetArrayField(TEXT("edges"));
+	TestTrue(TEXT("Pin types should be interned"), (*Details)->GetArrayField(TEXT("pin_types")).Num() > 0);
+
+	// The exec link is written exactly once, from the event's output pin to PrintString's input pin.
+	int32 ExecEdges = 0;
+	for (const TSharedPtr<FJsonValue>& EdgeValue : Edges)
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Edge = EdgeValue->AsArray();
+		if (Edge.Num() != 4 || Edge[0]->Type != EJson::Number || Edge[2]->Type != EJson::Number)
+		{
+			continue;
+		}
+		const TArray<TSharedPtr<FJsonValue>>& SrcPins = Nodes[static_cast<int32>(Edge[0]->AsNumber())]->AsArray()[6]->AsArray();
+		const TArray<TSharedPtr<FJsonValue>>& DstPins = Nodes[static_cast<int32>(Edge[2]->AsNumber())]->AsArray()[6]->AsArray();
+		const FString SrcPin = SrcPins[static_cast<int32>(Edge[1]->AsNumber())]->AsArray()[0]->AsString();
+		const FString DstPin = DstPins[static_cast<int32>(Edge[3]->AsNumber())]->AsArray()[0]->AsString();
+		ExecEdges += SrcPin == TEXT("then") && DstPin == TEXT("execute") ? 1 : 0;
+	}
+	TestEqual(TEXT("Exec link should appear once"), ExecEdges, 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTBlueprintLayoutTest, "UnrealGPT.BlueprintLayout", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTBlueprintLayoutTest::RunTest(const FString& Parameters)
+{
+	const FString AssetPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_LayoutTest_%d"), FPlatformTime::Cycles());
+	UUnrealGPTBlueprintContext::Create(FString::Printf(TEXT("{\"asset_path\":\"%s\"}"), *AssetPath));
+	const FString NormalizedPath = AssetPath + TEXT(".") + FPaths::GetCleanFilename(AssetPath);
+
+	// A chain of exec nodes plus a Branch whose two outputs both lead somewhere, with no positions supplied.
+	const FString Result = UUnrealGPTBlueprintContext::ApplyEdits(FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"ops\":[")
+		TEXT("{\"op\":\"add_node\",\"id\":\"begin\",\"node_type\":\"Event\",\"params\":{\"event_name\":\"ReceiveBeginPlay\"}},")
+		TEXT("{\"op\":\"add_node\",\"id\":\"branch\",\"node_type\":\"Branch\"},")
+		TEXT("{\"op\":\"add_node\",\"id\":\"yes\",\"node_type\":\"PrintString\"},")
+		TEXT("{\"op\":\"add_node\",\"id\":\"no\",\"node_type\":\"PrintString\"},")
+		TEXT("{\"op\":\"connect_pins\",\"from_node\":\"begin\",\"from_pin\":\"then\",\"to_node\":\"branch\",\"to_pin\":\"execute\"},")
+		TEXT("{\"op\":\"connect_pins\",\"from_node\":\"branch\",\"from_pin\":\"then\",\"to_node\":\"yes\",\"to_pin\":\"execute\"},")
+		TEXT("{\"op\":\"connect_pins\",\"from_node\":\"branch\",\"from_pin\":\"else\",\"to_node\":\"no\",\"to_pin\":\"execute\"}]}"),
+		*NormalizedPath));
+	TestTrue(TEXT("Batch should succeed"), Result.Contains(TEXT("\"status\":\"ok\"")));
+
+	const FString Query = UUnrealGPTBlueprintContext::Query(FString::Printf(TEXT("{\"asset_path\":\"%s\",\"include_pins\":false}"), *NormalizedPath));
+	TSharedPtr<FJsonObject> Json;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Query);
+	const TSharedPtr<FJsonObject>* Details = nullptr;
+	if (!TestTrue(TEXT("Query should parse"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+		&& Json->TryGetObjectField(TEXT("details"), Details)))
+	{
+		return false;
+	}
+
+	TMap<FString, FIntPoint> Positions;
+	for (const TSharedPtr<FJsonValue>& Value : (*Details)->GetArrayField(TEXT("nodes")))
+	{
+		const TSharedPtr<FJsonObject> Node = Value->AsObject();
+		Positions.Add(Node->GetStringField(TEXT("class")), FIntPoint(Node->GetIntegerField(TEXT("pos_x")), Node->GetIntegerField(TEXT("pos_y"))));
+	}
+
+	const FIntPoint* Event = Positions.Find(TEXT("K2Node_Event"));
+	const FIntPoint* Branch = Positions.Find(TEXT("K2Node_IfThenElse"));
+	if (TestTrue(TEXT("Event and Branch should exist"), Event && Branch))
+	{
+		TestTrue(TEXT("Branch should be laid out right of the event"), Branch->X > Event->X);
+		TestEqual(TEXT("Exec chain should stay level"), Branch->Y, Event->Y);
+	}
+
+	TArray<FIntPoint> Prints;
+	for (const TSharedPtr<FJsonValue>& Value : (*Details)->GetArrayField(TEXT("nodes")))
+	{
+		const TSharedPtr<FJsonObject> Node = Value->AsObject();
+		if (Node->GetStringField(TEXT("class")) == TEXT("K2Node_CallFunction"))
+		{
+			Prints.Add(FIntPoint(Node->GetIntegerField(TEXT("pos_x")), Node->GetIntegerField(TEXT("pos_y"))));
+		}
+	}
+	if (TestEqual(TEXT("Both PrintString nodes should exist"), Prints.Num(), 2))
+	{
+		TestEqual(TEXT("Branch targets should share a column"), Prints[0].X, Prints[1].X);
+		TestNotEqual(TEXT("Branch targets should not overlap"), Prints[0].Y, Prints[1].Y);
+	}
+
+	// A node fed by the event lands in the Branch's column, so it has to move clear of the Branch.
+	TSharedPtr<FJsonObject> BatchJson;
+	const TSharedRef<TJsonReader<>> BatchReader = TJsonReaderFactory<>::Create(Result);
+	FString EventGuid;
+	if (FJsonSerializer::Deserialize(BatchReader, BatchJson) && BatchJson.IsValid())
+	{
+		BatchJson->GetObjectField(TEXT("details"))->GetObjectField(TEXT("node_ids"))->TryGetStringField(TEXT("begin"), EventGuid);
+	}
+	const FString FollowUp = UUnrealGPTBlueprintContext::ApplyEdits(FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"ops\":[")
+		TEXT("{\"op\":\"add_node\",\"id\":\"later\",\"node_type\":\"PrintString\"},")
+		TEXT("{\"op\":\"connect_pins\",\"from_node\":\"%s\",\"from_pin\":\"then\",\"to_node\":\"later\",\"to_pin\":\"execute\"}]}"),
+		*NormalizedPath, *EventGuid));
+	TestTrue(TEXT("Follow-up batch should succeed"), FollowUp.Contains(TEXT("\"status\":\"ok\"")));
+	TSharedPtr<FJsonObject> FollowUpBatchJson;
+	const TSharedRef<TJsonReader<>> FollowUpBatchReader = TJsonReaderFactory<>::Create(FollowUp);
+	FString LaterGuid;
+	if (FJsonSerializer::Deserialize(FollowUpBatchReader, FollowUpBatchJson) && FollowUpBatchJson.IsValid())
+	{
+		FollowUpBatchJson->GetObjectField(TEXT("details"))->GetObjectField(TEXT("node_ids"))->TryGetStringField(TEXT("later"), LaterGuid);
+	}
+	TestFalse(TEXT("Follow-up batch should report the new node's guid"), LaterGuid.IsEmpty());
+
+	const FString FollowUpQuery = UUnrealGPTBlueprintContext::Query(FString::Printf(TEXT("{\"asset_path\":\"%s\",\"include_pins\":false}"), *NormalizedPath));
+	TSharedPtr<FJsonObject> FollowUpJson;
+	const TSharedRef<TJsonReader<>> FollowUpReader = TJsonReaderFactory<>::Create(FollowUpQuery);
+	TSharedPtr<FJsonObject> LaterNode;
+	if (FJsonSerializer::Deserialize(FollowUpReader, FollowUpJson) && FollowUpJson.IsValid() && !LaterGuid.IsEmpty())
+	{
+		for (const TSharedPtr<FJsonValue>& Value : FollowUpJson->GetObjectField(TEXT("details"))->GetArrayField(TEXT("nodes")))
+		{
+			const TSharedPtr<FJsonObject> Node = Value->AsObject();
+			FString NodeGuid;
+			if (Node->TryGetStringField(TEXT("guid"), NodeGuid) && NodeGuid == LaterGuid)
+			{
+				LaterNode = Node;
+				break;
+			}
+		}
+	}
+	if (TestTrue(TEXT("Follow-up query should list the new node"), LaterNode.IsValid()) && Branch)
+	{
+		TestEqual(TEXT("New node should sit in the column after the event"), LaterNode->GetIntegerField(TEXT("pos_x")), Branch->X);
+		TestTrue(TEXT("New node should be placed below the Branch"), LaterNode->GetIntegerField(TEXT("pos_y")) > Branch->Y);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTBlueprintNodeFactoryTest, "UnrealGPT.BlueprintNodeFactory", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTBlueprintNodeFactoryTest::RunTest(const FString& Parameters)
+{
+	const FString Search = UUnrealGPTBlueprintContext::SearchNodes(TEXT("{\"query\":\"for each loop\",\"max_results\":5}"));
+	TSharedPtr<FJsonObject> Json;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Search);
+	const TSharedPtr<FJsonObject>* Details = nullptr;
+	if (!TestTrue(TEXT("Search should parse"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+		&& Json->TryGetObjectField(TEXT("details"), Details)))
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>& Results = (*Details)->GetArrayField(TEXT("results"));
+	TestTrue(TEXT("Palette should be indexed"), (*Details)->GetIntegerField(TEXT("searched_actions")) > 100);
+	if (!TestTrue(TEXT("ForEachLoop macro should be found"), Results.Num() > 0))
+	{
+		return false;
+	}
+	const FString ActionId = Results[0]->AsObject()->GetStringField(TEXT("action_id"));
+
+	const FString AssetPath = FString::Printf(TEXT("/Game/UnrealGPTBlueprintTests/BP_NodeFactoryTest_%d"), FPlatformTime::Cycles());
+	UUnrealGPTBlueprintContext::Create(FString::Printf(TEXT("{\"asset_path\":\"%s\"}"), *AssetPath));
+	const FString NormalizedPath = AssetPath + TEXT(".") + FPaths::GetCleanFilename(AssetPath);
+
+	const FString Added = UUnrealGPTBlueprintContext::AddNode(FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"node_type\":\"Action\",\"params\":{\"action_id\":\"%s\"}}"), *NormalizedPath, *ActionId));
+	TestTrue(TEXT("Action node should be added"), Added.Contains(TEXT("\"status\":\"ok\"")));
+
+	// Action ids are spawner signatures, so they stay stable across searches.
+	const FString Repeat = UUnrealGPTBlueprintContext::SearchNodes(TEXT("{\"query\":\"for each loop\",\"max_results\":5}"));
+	TestTrue(TEXT("Repeat search should return the same action"), Repeat.Contains(ActionId));
+
+	const FString Unknown = UUnrealGPTBlueprintContext::AddNode(FString::Printf(
+		TEXT("{\"asset_path\":\"%s\",\"node_type\":\"Action\",\"params\":{\"action\":\"Not|A Real Node\"}}"), *NormalizedPath));
+	TestTrue(TEXT("Unknown actions should fail"), Unknown.Contains(TEXT("\"status\":\"error\"")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTPythonRunnerTest, "UnrealGPT.PythonRunner", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTPythonRunnerTest::RunTest(const FString& Parameters)
+{
+	FUnrealGPTPythonRunner::ResetNamespace();
+	if (FUnrealGPTPythonRunner::Execute(TEXT("counter = 41")).Contains(TEXT("Python is not available")))
+	{
+		AddInfo(TEXT("Python is not available; skipping"));
+		return true;
+	}
+	const FString Result = FUnrealGPTPythonRunner::Execute(
+		TEXT("counter += 1\nprint('quote \" and \\\\ survive')\nresult['details']['counter'] = counter"));
+
+	TSharedPtr<FJsonObject> Json;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Result);
+	if (!TestTrue(TEXT("Result should be JSON"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Status should be ok"), Json->GetStringField(TEXT("status")), FString(TEXT("ok")));
+	TestEqual(TEXT("Variables should persist between calls"), Json->GetObjectField(TEXT("details"))->GetIntegerField(TEXT("counter")), 42);
+	TestTrue(TEXT("stdout should be captured"), Json->GetStringField(TEXT("stdout")).Contains(TEXT("quote \" and \\ survive")));
+	TestTrue(TEXT("Elapsed time should be reported"), Json->HasField(TEXT("elapsed_ms")));
+
+	const FString Failure = FUnrealGPTPythonRunner::Execute(TEXT("raise ValueError('boom')"));
+	TestTrue(TEXT("Exceptions should become error envelopes"), Failure.Contains(TEXT("\"status\": \"error\"")) && Failure.Contains(TEXT("boom")));
+
+	FUnrealGPTPythonRunner::ResetNamespace();
+	const FString AfterReset = FUnrealGPTPythonRunner::Execute(TEXT("result['details']['defined'] = 'counter' in globals()"));
+	TestTrue(TEXT("Reset should clear earlier names"), AfterReset.Contains(TEXT("\"defined\": false")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTPythonProfilingTest, "UnrealGPT.PythonProfiling", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTPythonProfilingTest::RunTest(const FString& Parameters)
+{
+	const int32 RunsBefore = FUnrealGPTPythonRunner::GetSessionStats().NumRuns;
+	FUnrealGPTPythonRunner::FOptions CountOptions;
+	CountOptions.bCountUnrealCalls = true;
+	const FString Looping = FUnrealGPTPythonRunner::Execute(TEXT(
+		"subsystem = unreal.get_editor_subsystem(unreal.EditorActorSubsystem)\n"
+		"for _ in range(3):\n"
+		"    actors = subsystem.get_all_level_actors()\n"), CountOptions);
+	if (Looping.Contains(TEXT("Python is not available")))
+	{
+		AddInfo(TEXT("Python is not available; skipping"));
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> Json;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Looping);
+	const TSharedPtr<FJsonObject>* Accounting = nullptr;
+	if (!TestTrue(TEXT("Accounting should be reported"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+		&& Json->TryGetObjectField(TEXT("accounting"), Accounting)))
+	{
+		return false;
+	}
+	TestTrue(TEXT("unreal calls should be counted"), (*Accounting)->GetIntegerField(TEXT("unreal_api_calls")) >= 4);
+	TestTrue(TEXT("Object accounting should be attached"), (*Accounting)->HasField(TEXT("objects_created")) && (*Accounting)->HasField(TEXT("objects_modified")));
+	TestTrue(TEXT("Enumeration inside a loop should be flagged"), (*Accounting)->HasField(TEXT("warnings")));
+	TestEqual(TEXT("Session stats should count the run"), FUnrealGPTPythonRunner::GetSessionStats().NumRuns, RunsBefore + 1);
+
+	const FString Uncounted = FUnrealGPTPythonRunner::Execute(TEXT("unreal.log('uncounted')"));
+	Reader = TJsonReaderFactory<>::Create(Uncounted);
+	if (TestTrue(TEXT("Accounting should be reported without counting"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+		&& Json->TryGetObjectField(TEXT("accounting"), Accounting)))
+	{
+		TestFalse(TEXT("Calls are only counted on request"), (*Accounting)->HasField(TEXT("unreal_api_calls")));
+	}
+
+	// Objects another thread creates while a snippet runs are not the snippet's.
+	std::atomic<bool> bStopCreating = false;
+	std::atomic<int32> NumCreatedOffThread = 0;
+	TFuture<void> Creator = Async(EAsyncExecution::Thread, [&bStopCreating, &NumCreatedOffThread]()
+	{
+		while (!bStopCreating)
+		{
+			FGCScopeGuard GCGuard;
+			NewObject<UObjectRedirector>(GetTransientPackage(), NAME_None, RF_Transient);
+			++NumCreatedOffThread;
+		}
+	});
+	while (NumCreatedOffThread == 0)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+	const int32 CreatedBefore = NumCreatedOffThread;
+	const FString Sleeping = FUnrealGPTPythonRunner::Execute(TEXT("import time\ntime.sleep(0.2)"));
+	const int32 CreatedDuring = NumCreatedOffThread - CreatedBefore;
+	bStopCreating = true;
+	Creator.Wait();
+	Reader = TJsonReaderFactory<>::Create(Sleeping);
+	if (TestTrue(TEXT("Accounting should be reported while another thread creates objects"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+		&& Json->TryGetObjectField(TEXT("accounting"), Accounting)))
+	{
+		TestTrue(TEXT("Objects created off the game thread should not be counted"),
+			(*Accounting)->GetIntegerField(TEXT("objects_created")) < FMath::Max(CreatedDuring, 1));
+	}
+
+	FUnrealGPTPythonRunner::FOptions Options;
+	Options.bProfile = true;
+	Options.ProfileTopN = 5;
+	const FString Profiled = FUnrealGPTPythonRunner::Execute(TEXT("total = sum(i * i for i in range(10000))"), Options);
+	Reader = TJsonReaderFactory<>::Create(Profiled);
+	const TSharedPtr<FJsonObject>* Profile = nullptr;
+	if (TestTrue(TEXT("Profile should be reported"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid()
+		&& Json->TryGetObjectField(TEXT("profile"), Profile)))
+	{
+		const int32 NumHot = (*Profile)->GetArrayField(TEXT("hot_functions")).Num();
+		TestTrue(TEXT("Hot functions should respect the limit"), NumHot > 0 && NumHot <= 5);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTMarkdownDocumentTest, "UnrealGPT.MarkdownDocument", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTMarkdownDocumentTest::RunTest(const FString& Parameters)
+{
+	const FString Text = TEXT("# Title\nSome **bold** text\n\n- one\n- two\n```python\nx = 1\n\ny = 2\n```\n### Done");
+
+	FUnrealGPTMarkdownDocument Full;
+	Full.SetText(Text);
+	const TArray<FUnrealGPTMarkdownBlock>& Blocks = Full.GetBlocks();
+	if (!TestEqual(TEXT("Block count"), Blocks.Num(), 7))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Heading level"), Blocks[0].Type == EUnrealGPTMarkdownBlockType::Heading && Blocks[0].HeadingLevel == 1);
+	TestTrue(TEXT("Blank line"), Blocks[2].Type == EUnrealGPTMarkdownBlockType::Blank);
+	TestEqual(TEXT("Bullet text"), Blocks[4].Lines[0], FString(TEXT("two")));
+	TestTrue(TEXT("Code block closed"), Blocks[5].Type == EUnrealGPTMarkdownBlockType::Code && Blocks[5].bClosed);
+	TestEqual(TEXT("Code lines keep blank lines"), Blocks[5].Lines.Num(), 3);
+
+	// Streaming one character at a time must end in the same parse as a single SetText.
+	FUnrealGPTMarkdownDocument Streamed;
+	for (int32 Index = 0; Index < Text.Len(); ++Index)
+	{
+		Streamed.Append(Text.Mid(Index, 1));
+	}
+	TestEqual(TEXT("Streamed block count"), Streamed.GetBlocks().Num(), Blocks.Num());
+	for (int32 Index = 0; Index < FMath::Min(Blocks.Num(), Streamed.GetBlocks().Num()); ++Index)
+	{
+		const FUnrealGPTMarkdownBlock& Expected = Blocks[Index];
+		const FUnrealGPTMarkdownBlock& Actual = Streamed.GetBlocks()[Index];
+		TestTrue(FString::Printf(TEXT("Streamed block %d matches"), Index),
+			Expected.Type == Actual.Type && Expected.HeadingLevel == Actual.HeadingLevel
+			&& Expected.Lines == Actual.Lines && Expected.bClosed == Actual.bClosed);
+	}
+
+	// Appends only touch the tail: an open code block, then nothing before it.
+	FUnrealGPTMarkdownDocument Incremental;
+	Incremental.SetText(TEXT("intro\n```\nline 1\n"));
+	Incremental.ClearChanges();
+	Incremental.Append(TEXT("line 2\nline"));
+	TestEqual(TEXT("Only the open code block changes"), Incremental.GetFirstChangedBlock(), 1);
+	TestFalse(TEXT("Code block still open"), Incremental.GetBlocks()[1].bClosed);
+	Incremental.ClearChanges();
+	Incremental.SetText(TEXT("something else"));
+	TestEqual(TEXT("Non-extending text reparses from the start"), Incremental.GetFirstChangedBlock(), 0);
+	TestEqual(TEXT("Replaced text block count"), Incremental.GetBlocks().Num(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTScreenshotPipelineTest, "UnrealGPT.ScreenshotPipeline", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTScreenshotPipelineTest::RunTest(const FString& Parameters)
+{
+	const int32 Width = 1600;
+	const int32 Height = 900;
+	TArray<FColor> Pixels;
+	Pixels.Init(FColor(10, 120, 240, 255), Width * Height);
+	TArray64<uint8> Png;
+	FImageUtils::PNGCompressImageArray(Width, Height, Pixels, Png);
+	const FString Base64Png = FBase64::Encode(Png.GetData(), Png.Num());
+
+	const FUnrealGPTThumbnailPtr Thumbnail = FUnrealGPTScreenshotPipeline::DecodeThumbnail(Base64Png);
+	if (!TestTrue(TEXT("Screenshot should decode"), Thumbnail.IsValid()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Source size"), Thumbnail->SourceSize, FIntPoint(Width, Height));
+	TestEqual(TEXT("Downscaled to fit, keeping the aspect ratio"), Thumbnail->Size, FIntPoint(800, 450));
+	TestEqual(TEXT("Pixel count"), Thumbnail->Pixels.Num(), 800 * 450);
+	TestTrue(TEXT("Colors survive the resize"), Thumbnail->Pixels.Num() > 0 && Thumbnail->Pixels[0].B > 200 && Thumbnail->Pixels[0].R < 40);
+
+	TestFalse(TEXT("Invalid data should fail"), FUnrealGPTScreenshotPipeline::DecodeThumbnail(TEXT("iVBORw0KGgonotapng")).IsValid());
+
+	// Leases share slots: a released texture is reused by the next acquire.
+	const TSharedRef<FUnrealGPTThumbnailPool> Pool = MakeShared<FUnrealGPTThumbnailPool>();
+	{
+		const TSharedPtr<FUnrealGPTThumbnailPool::FLease> First = Pool->Acquire(Thumbnail);
+		const TSharedPtr<FUnrealGPTThumbnailPool::FLease> Second = Pool->Acquire(Thumbnail);
+		TestTrue(TEXT("Leases should be granted"), First.IsValid() && Second.IsValid());
+		TestEqual(TEXT("Two rows use two slots"), Pool->GetNumSlots(), 2);
+	}
+	const TSharedPtr<FUnrealGPTThumbnailPool::FLease> Reused = Pool->Acquire(Thumbnail);
+	TestEqual(TEXT("Released slots are reused"), Pool->GetNumSlots(), 2);
+
+	// A screenshot row holds its lease only as long as the row widget exists
+	TSharedPtr<SWidget> RowImage = UnrealGPTAgentUI::CreateThumbnailImage(Thumbnail, *Pool);
+	TestTrue(TEXT("Row image should be created"), RowImage.IsValid());
+	TestEqual(TEXT("Realized row leases a slot"), Pool->GetNumLeased(), 2);
+	RowImage.Reset();
+	TestEqual(TEXT("Dropped row returns its slot"), Pool->GetNumLeased(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTMcpStatusSnapshotTest, "UnrealGPT.Mcp.StatusSnapshot", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTMcpStatusSnapshotTest::RunTest(const FString& Parameters)
+{
+	UUnrealGPTMcpSubsystem* McpSubsystem = GEditor ? GEditor->GetEditorSubsystem<UUnrealGPTMcpSubsystem>() : nullptr;
+	if (!TestNotNull(TEXT("MCP subsystem"), McpSubsystem))
+	{
+		return false;
+	}
+
+	int32 NumBroadcasts = 0;
+	const FDelegateHandle Handle = McpSubsystem->OnStatusChanged().AddLambda([&NumBroadcasts](const FMcpStatusSnapshot&) { ++NumBroadcasts; });
+
+	const uint32 GenerationBefore = McpSubsystem->GetStatusSnapshot().Generation;
+	McpSubsystem->ReloadServers();
+	const FMcpStatusSnapshot Snapshot = McpSubsystem->GetStatusSnapshot();
+	McpSubsystem->OnStatusChanged().Remove(Handle);
+
+	TestEqual(TEXT("Snapshot connected count"), Snapshot.ConnectedCount, McpSubsystem->GetConnectedServerCount());
+	TestEqual(TEXT("Snapshot total count"), Snapshot.TotalCount, McpSubsystem->GetServerStatuses().Num());
+	TestEqual(TEXT("One broadcast per generation"), NumBroadcasts, static_cast<int32>(Snapshot.Generation - GenerationBefore));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTCodexAuthCacheTest, "UnrealGPT.CodexAuthCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTCodexAuthCacheTest::RunTest(const FString& Parameters)
+{
+	const FString TempDir = FPaths::ProjectIntermediateDir() / TEXT("UnrealGPTCodexAuthTests");
+	IFileManager::Get().MakeDirectory(*TempDir, true);
+	const FString AuthPath = TempDir / TEXT("auth.json");
+
+	auto MakeJwt = [](const FString& PayloadJson)
+	{
+		FString Payload = FBase64::Encode(PayloadJson).Replace(TEXT("+"), TEXT("-")).Replace(TEXT("/"), TEXT("_"));
+		Payload.RemoveFromEnd(TEXT("=="));
+		Payload.RemoveFromEnd(TEXT("="));
+		return FString::Printf(TEXT("eyJhbGciOiJub25lIn0.%s.sig"), *Payload);
+	};
+
+	const int64 ExpiryUnix = (FDateTime::UtcNow() + FTimespan::FromMinutes(2.0)).ToUnixTimestamp();
+	const FString AccessToken = MakeJwt(FString::Printf(TEXT("{\"exp\":%lld}"), ExpiryUnix));
+	const FString AuthJson = FString::Printf(
+		TEXT("{\"auth_mode\":\"chatgpt\",\"tokens\":{\"access_token\":\"%s\",\"account_id\":\"acct_1\",\"refresh_token\":\"rt_1\"}}"),
+		*AccessToken);
+	TestTrue(TEXT("Auth file should be written"), FFileHelper::SaveStringToFile(AuthJson, *AuthPath));
+
+	FUnrealGPTCodexAuth& CodexAuth = FUnrealGPTCodexAuth::Get();
+	CodexAuth.Invalidate();
+	const FUnrealGPTCodexAuth::FCredentialsPtr Credentials = CodexAuth.GetCredentials(AuthPath);
+	TestTrue(TEXT("Auth file should parse"), Credentials->IsValid());
+	TestEqual(TEXT("Access token"), Credentials->AccessToken, AccessToken);
+	TestEqual(TEXT("Account id"), Credentials->AccountId, FString(TEXT("acct_1")));
+	TestEqual(TEXT("Refresh token"), Credentials->RefreshToken, FString(TEXT("rt_1")));
+	TestEqual(TEXT("Expiry decoded from the JWT"), Credentials->AccessTokenExpiry.ToUnixTimestamp(), ExpiryUnix);
+	TestTrue(TEXT("Token expiring in two minutes is within five"), FUnrealGPTCodexAuth::ExpiresWithin(*Credentials, FTimespan::FromMinutes(5.0)));
+	TestFalse(TEXT("Token expiring in two minutes is not within one"), FUnrealGPTCodexAuth::ExpiresWithin(*Credentials, FTimespan::FromMinutes(1.0)));
+
+	// A rewritten file is picked up once the cache is invalidated
+	TestTrue(TEXT("Auth file should be rewritten"), FFileHelper::SaveStringToFile(TEXT("{\"OPENAI_API_KEY\":\"sk-test\"}"), *AuthPath));
+	CodexAuth.Invalidate();
+	const FUnrealGPTCodexAuth::FCredentialsPtr Reloaded = CodexAuth.GetCredentials(AuthPath);
+	TestEqual(TEXT("Reloaded API key"), Reloaded->ApiKey, FString(TEXT("sk-test")));
+	TestFalse(TEXT("API key auth has no ChatGPT tokens"), Reloaded->HasChatGPTTokens());
+
+	IFileManager::Get().Delete(*AuthPath);
+	CodexAuth.Invalidate();
+	TestFalse(TEXT("Missing auth file reports an error"), CodexAuth.GetCredentials(AuthPath)->IsValid());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTVoiceStreamTest, "UnrealGPT.VoiceStream", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTVoiceStreamTest::RunTest(const FString& Parameters)
+{
+	// 48 kHz stereo: 0.5 s of faint noise, 1 s of tone, 1.5 s of faint noise
+	const int32 DeviceRate = 48000;
+	FRandomStream Noise(7);
+	TArray<float> Device;
+	for (int32 Index = 0; Index < DeviceRate * 3; ++Index)
+	{
+		const bool bTone = Index >= DeviceRate / 2 && Index < DeviceRate * 3 / 2;
+		const float Sample = bTone
+			? 0.5f * FMath::Sin(2.0f * PI * 440.0f * Index / DeviceRate)
+			: 0.001f * Noise.FRandRange(-1.0f, 1.0f);
+		Device.Add(Sample);
+		Device.Add(Sample);
+	}
+
+	auto Feed = [&Device](FUnrealGPTVoiceStream& Stream)
+	{
+		const int32 ChunkSamples = 960;
+		for (int32 Offset = 0; Offset < Device.Num(); Offset += ChunkSamples)
+		{
+			if (Stream.Process(Device.GetData() + Offset, FMath::Min(ChunkSamples, Device.Num() - Offset)))
+			{
+				break;
+			}
+		}
+		Stream.Finish();
+	};
+
+	FUnrealGPTVoiceStream Stream;
+	Stream.Reset(DeviceRate, 2, FUnrealGPTVoiceStream::FOptions());
+	Feed(Stream);
+	TestTrue(TEXT("Tone is detected as speech"), Stream.HasSpeech());
+	TestTrue(TEXT("Silence after the tone ends the utterance"), Stream.IsUtteranceComplete());
+	// Pre-roll + tone + silence timeout; the leading and trailing noise is dropped
+	TestTrue(TEXT("Utterance trimmed to speech"), Stream.GetDurationSeconds() > 1.8f && Stream.GetDurationSeconds() < 2.4f);
+
+	const TArray<uint8> Wav = Stream.BuildWav();
+	TestEqual(TEXT("WAV size"), Wav.Num(), 44 + Stream.GetPcm().Num() * 2);
+	TestTrue(TEXT("WAV header"), Wav.Num() > 44 && FMemory::Memcmp(Wav.GetData(), "RIFF", 4) == 0);
+
+	FUnrealGPTVoiceStream::FOptions KeepAll;
+	KeepAll.bDetectVoiceActivity = false;
+	FUnrealGPTVoiceStream Unfiltered;
+	Unfiltered.Reset(DeviceRate, 2, KeepAll);
+	Feed(Unfiltered);
+	TestFalse(TEXT("Without voice detection the utterance never ends"), Unfiltered.IsUtteranceComplete());
+	TestTrue(TEXT("Without voice detection all audio is kept at 16 kHz"), FMath::Abs(Unfiltered.GetDurationSeconds() - 3.0f) < 0.01f);
+
+	// Speech from the first frame: the calibration window's quietest frame, not the first one, sets the floor
+	auto FeedTone = [DeviceRate](FUnrealGPTVoiceStream& ToneStream, float ToneStartSeconds, float Seconds)
+	{
+		TArray<float> Mono;
+		for (int32 Index = 0; Index < FMath::RoundToInt(DeviceRate * Seconds); ++Index)
+		{
+			Mono.Add(Index >= ToneStartSeconds * DeviceRate ? 0.5f * FMath::Sin(2.0f * PI * 440.0f * Index / DeviceRate) : 0.0005f);
+		}
+		ToneStream.Process(Mono.GetData(), Mono.Num());
+		ToneStream.Finish();
+	};
+
+	FUnrealGPTVoiceStream EarlySpeech;
+	EarlySpeech.Reset(DeviceRate, 1, FUnrealGPTVoiceStream::FOptions());
+	FeedTone(EarlySpeech, 0.1f, 1.0f);
+	TestTrue(TEXT("Speech inside the calibration window is detected"), EarlySpeech.HasSpeech());
+
+	FUnrealGPTVoiceStream NoQuietFrame;
+	NoQuietFrame.Reset(DeviceRate, 1, FUnrealGPTVoiceStream::FOptions());
+	FeedTone(NoQuietFrame, 0.0f, 1.0f);
+	TestFalse(TEXT("A recording without any quiet frame finds no speech"), NoQuietFrame.HasSpeech());
+	TestTrue(TEXT("Without speech the recording is kept untrimmed"), FMath::Abs(NoQuietFrame.GetDurationSeconds() - 1.0f) < 0.01f);
+	return true;
+}
+
+/**
+ * Decodes the subset of FLAC that FUnrealGPTFlacEncoder writes (mono, 16-bit, constant, verbatim and
+ * fixed subframes with 4-bit Rice parameters), checking each frame's sync code and CRC-16.
+ */
+static bool DecodeTestFlac(const TArray<uint8>& Flac, TArray<int16>& OutSamples, FString& OutError)
+{
+	const int64 NumBits = static_cast<int64>(Flac.Num()) * 8;
+	int64 BitPos = 42 * 8;
+	auto Read = [&Flac, &BitPos, NumBits](int32 Count) -> uint32
+	{
+		uint32 Value = 0;
+		for (int32 Bit = 0; Bit < Count; ++Bit, ++BitPos)
+		{
+			const uint32 BitValue = BitPos < NumBits ? (Flac[BitPos >> 3] >> (7 - (BitPos & 7))) & 1 : 0;
+			Value = (Value << 1) | BitValue;
+		}
+		return Value;
+	};
+	auto ReadSigned = [&Read](int32 Count) -> int32
+	{
+		return static_cast<int32>(Read(Count) << (32 - Count)) >> (32 - Count);
+	};
+	auto Crc16 = [&Flac](int32 Start, int32 End)
+	{
+		uint16 Crc = 0;
+		for (int32 Index = Start; Index < End; ++Index)
+		{
+			Crc ^= static_cast<uint16>(Flac[Index]) << 8;
+			for (int32 Bit = 0; Bit < 8; ++Bit)
+			{
+				Crc = (Crc & 0x8000) ? static_cast<uint16>((Crc << 1) ^ 0x8005) : static_cast<uint16>(Crc << 1);
+			}
+		}
+		return Crc;
+	};
+
+	OutSamples.Reset();
+	TArray<int32> Block;
+	while (BitPos < NumBits)
+	{
+		const int32 FrameStart = static_cast<int32>(BitPos >> 3);
+		if (Read(16) != 0xFFF8)
+		{
+			OutError = FString::Printf(TEXT("No sync code at byte %d"), FrameStart);
+			return false;
+		}
+		const uint32 BlockSizeCode = Read(4);
+		Read(4); // Sample rate code
+		if (Read(4) != 0 || Read(3) != 4 || Read(1) != 0)
+		{
+			OutError = FString::Printf(TEXT("Frame at byte %d is not mono 16-bit"), FrameStart);
+			return false;
+		}
+		const uint32 FrameNumberLead = Read(8);
+		int32 NumLeadingOnes = 0;
+		while (NumLeadingOnes < 8 && (FrameNumberLead & (0x80 >> NumLeadingOnes)))
+		{
+			++NumLeadingOnes;
+		}
+		Read(FMath::Max(NumLeadingOnes - 1, 0) * 8);
+		const int32 Num = BlockSizeCode == 6 ? Read(8) + 1 : BlockSizeCode == 7 ? Read(16) + 1 : BlockSizeCode >= 8 ? 256 << (BlockSizeCode - 8) : 0;
+		Read(8); // Header CRC-8
+
+		Read(1);
+		const uint32 Type = Read(6);
+		Read(1); // Wasted bits
+		Block.SetNumUninitialized(Num);
+		if (Type == 0)
+		{
+			const int32 Value = ReadSigned(16);
+			for (int32& Sample : Block)
+			{
+				Sample = Value;
+			}
+		}
+		else if (Type == 1)
+		{
+			for (int32& Sample : Block)
+			{
+				Sample = ReadSigned(16);
+			}
+		}
+		else if (Type >= 8 && Type <= 12)
+		{
+			const int32 Order = Type - 8;
+			for (int32 Index = 0; Index < Order; ++Index)
+			{
+				Block[Index] = ReadSigned(16);
+			}
+			const uint32 Coding = Read(2);
+			const int32 PartitionOrder = Read(4);
+			int32 Index = Order;
+			for (int32 Partition = 0; Partition < (1 << PartitionOrder) && Coding == 0; ++Partition)
+			{
+				const int32 Parameter = Read(4);
+				const int32 End = (Num >> PartitionOrder) * (Partition + 1);
+				for (; Index < End && BitPos < NumBits; ++Index)
+				{
+					uint32 Quotient = 0;
+					while (Read(1) == 0 && BitPos < NumBits)
+					{
+						++Quotient;
+					}
+					const uint32 Folded = (Quotient << Parameter) | Read(Parameter);
+					const int32 Residual = static_cast<int32>(Folded >> 1) ^ -static_cast<int32>(Folded & 1);
+					const int32* X = Block.GetData() + Index;
+					const int32 Prediction = Order == 1 ? X[-1]
+						: Order == 2 ? 2 * X[-1] - X[-2]
+						: Order == 3 ? 3 * X[-1] - 3 * X[-2] + X[-3]
+						: Order == 4 ? 4 * X[-1] - 6 * X[-2] + 4 * X[-3] - X[-4]
+						: 0;
+					Block[Index] = Prediction + Residual;
+				}
+			}
+			if (Coding != 0 || Index != Num)
+			{
+				OutError = FString::Printf(TEXT("Bad residual in frame at byte %d"), FrameStart);
+				return false;
+			}
+		}
+		else
+		{
+			OutError = FString::Printf(TEXT("Unexpected subframe type %u at byte %d"), Type, FrameStart);
+			return false;
+		}
+
+		BitPos = (BitPos + 7) & ~7ll;
+		const int32 FrameEnd = static_cast<int32>(BitPos >> 3);
+		if (FrameEnd + 2 > Flac.Num() || Read(16) != Crc16(FrameStart, FrameEnd))
+		{
+			OutError = FString::Printf(TEXT("CRC-16 mismatch in frame at byte %d"), FrameStart);
+			return false;
+		}
+		for (const int32 Sample : Block)
+		{
+			OutSamples.Add(static_cast<int16>(Sample));
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTFlacEncoderTest, "UnrealGPT.FlacEncoder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTFlacEncoderTest::RunTest(const FString& Parameters)
+{
+	// Two tones plus a little noise, 3 s at 16 kHz; not a multiple of the block size
+	FRandomStream Noise(11);
+	TArray<int16> Samples;
+	for (int32 Index = 0; Index < 48001; ++Index)
+	{
+		const float Value = 12000.0f * FMath::Sin(Index * 0.05f) + 3000.0f * FMath::Sin(Index * 0.31f) + Noise.RandRange(-100, 100);
+		Samples.Add(static_cast<int16>(FMath::Clamp(FMath::RoundToInt(Value), -32768, 32767)));
+	}
+
+	const TArray<uint8> Flac = FUnrealGPTFlacEncoder::EncodeMono16(Samples, FUnrealGPTVoiceStream::OutputSampleRate);
+	const TArray<uint8> Wav = FUnrealGPTVoiceStream::EncodeWav(Samples);
+	TestTrue(TEXT("FLAC marker"), Flac.Num() > 42 && FMemory::Memcmp(Flac.GetData(), "fLaC", 4) == 0);
+	TestEqual(TEXT("Single last STREAMINFO block"), Flac[4], static_cast<uint8>(0x80));
+
+	// STREAMINFO packs the sample rate into 20 bits and the total sample count into the following 36
+	const uint32 SampleRate = (static_cast<uint32>(Flac[18]) << 12) | (static_cast<uint32>(Flac[19]) << 4) | (Flac[20] >> 4);
+	const uint64 TotalSamples = (static_cast<uint64>(Flac[21] & 0x0F) << 32) | (static_cast<uint64>(Flac[22]) << 24)
+		| (static_cast<uint64>(Flac[23]) << 16) | (static_cast<uint64>(Flac[24]) << 8) | Flac[25];
+	TestEqual(TEXT("Sample rate"), SampleRate, static_cast<uint32>(FUnrealGPTVoiceStream::OutputSampleRate));
+	TestEqual(TEXT("Total samples"), TotalSamples, static_cast<uint64>(Samples.Num()));
+
+	TestTrue(TEXT("Predictable audio compresses below WAV"), Flac.Num() < Wav.Num() * 3 / 4);
+
+	uint8 Digest[16];
+	FMD5 Md5;
+	Md5.Update(reinterpret_cast<const uint8*>(Samples.GetData()), Samples.Num() * sizeof(int16));
+	Md5.Final(Digest);
+	TestTrue(TEXT("STREAMINFO MD5 matches the PCM"), FMemory::Memcmp(Flac.GetData() + 26, Digest, 16) == 0);
+
+	TArray<int16> Decoded;
+	FString DecodeError;
+	if (DecodeTestFlac(Flac, Decoded, DecodeError))
+	{
+		TestTrue(TEXT("Decoded samples match the input"), Decoded == Samples);
+	}
+	else
+	{
+		AddError(FString::Printf(TEXT("FLAC frames do not decode: %s"), *DecodeError));
+	}
+
+	// Shorter than the format's 16-sample minimum block size
+	const TArray<int16> Short = { 5, -3, 1200, 1199, 7, 7, 7, 0, -32768, 32767 };
+	const TArray<uint8> ShortFlac = FUnrealGPTFlacEncoder::EncodeMono16(Short, 16000);
+	if (TestTrue(TEXT("Short input still encodes"), ShortFlac.Num() > 42))
+	{
+		const uint32 MinBlockSize = (static_cast<uint32>(ShortFlac[8]) << 8) | ShortFlac[9];
+		const uint32 MaxBlockSize = (static_cast<uint32>(ShortFlac[10]) << 8) | ShortFlac[11];
+		TestTrue(TEXT("STREAMINFO block sizes are at least 16"), MinBlockSize >= 16 && MaxBlockSize >= MinBlockSize);
+		TestTrue(TEXT("Short input round-trips"), DecodeTestFlac(ShortFlac, Decoded, DecodeError) && Decoded == Short);
+	}
+
+	TestEqual(TEXT("No samples, no file"), FUnrealGPTFlacEncoder::EncodeMono16(TArray<int16>(), 16000).Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTReplicateClientTest, "UnrealGPT.ReplicateClient", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTReplicateClientTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("First poll after half a second"), FUnrealGPTReplicateClient::GetPollDelaySeconds(0), 0.5);
+	TestEqual(TEXT("Poll delay doubles"), FUnrealGPTReplicateClient::GetPollDelaySeconds(3), 4.0);
+	TestEqual(TEXT("Poll delay is capped"), FUnrealGPTReplicateClient::GetPollDelaySeconds(40), 8.0);
+
+	// Canceling while the creation request is in flight completes at once, without reaching the server
+	FUnrealGPTReplicateClient& Client = FUnrealGPTReplicateClient::Get();
+	const int32 ActiveBefore = Client.GetNumActive();
+	int32 NumCallbacks = 0;
+	bool bCanceled = false;
+	const uint32 PredictionId = Client.CreatePrediction(TEXT("http://127.0.0.1:9/v1/predictions"), TEXT("token"), TEXT("{}"),
+		[&NumCallbacks, &bCanceled](const FUnrealGPTReplicateResult& Result)
+		{
+			++NumCallbacks;
+			bCanceled = Result.bCanceled && !Result.bSuccess;
+		});
+	TestTrue(TEXT("Prediction is active"), Client.IsActive(PredictionId));
+
+	Client.Cancel(PredictionId);
+	Client.Cancel(PredictionId);
+	TestEqual(TEXT("Completed exactly once"), NumCallbacks, 1);
+	TestTrue(TEXT("Completed as canceled"), bCanceled);
+	TestEqual(TEXT("Nothing left active"), Client.GetNumActive(), ActiveBefore);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTDownloadStagingTest, "UnrealGPT.DownloadStaging", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTDownloadStagingTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("URL extension wins over a generic content type"),
+		FUnrealGPTDownloadManager::GetExtension(TEXT("https://example.com/out/model.glb?sig=1"), TEXT("application/octet-stream")), FString(TEXT("glb")));
+	TestEqual(TEXT("Content type names the format when the URL does not"),
+		FUnrealGPTDownloadManager::GetExtension(TEXT("https://example.com/files/123"), TEXT("image/png")), FString(TEXT("png")));
+	TestEqual(TEXT("Partial file is stable per URL"),
+		FUnrealGPTDownloadManager::GetPartialPath(TEXT("/Staging"), TEXT("https://example.com/a")),
+		FUnrealGPTDownloadManager::GetPartialPath(TEXT("/Staging"), TEXT("https://example.com/a")));
+	TestEqual(TEXT("Content-Range start is parsed"),
+		FUnrealGPTDownloadManager::GetContentRangeStart(TEXT("bytes 1024-2047/4096")), static_cast<int64>(1024));
+	TestEqual(TEXT("Unsatisfied Content-Range names no start"),
+		FUnrealGPTDownloadManager::GetContentRangeStart(TEXT("bytes */4096")), static_cast<int64>(-1));
+
+	const FString TempDir = FPaths::ProjectIntermediateDir() / TEXT("UnrealGPTDownloadTests");
+	IFileManager::Get().DeleteDirectory(*TempDir, false, true);
+
+	// The same content staged twice resolves to one file named by its hash
+	FString FirstPath;
+	FString SecondPath;
+	bool bDeduplicated = true;
+	FString Error;
+	TestTrue(TEXT("First download written"), FFileHelper::SaveStringToFile(TEXT("generated output"), *(TempDir / TEXT("a.part"))));
+	TestTrue(TEXT("First staged"), FUnrealGPTDownloadManager::StageFile(TempDir / TEXT("a.part"), TempDir, TEXT("png"), FirstPath, bDeduplicated, Error));
+	TestFalse(TEXT("First is new content"), bDeduplicated);
+	TestTrue(TEXT("Staged file exists"), FPaths::FileExists(FirstPath));
+	TestFalse(TEXT("Partial file moved"), FPaths::FileExists(TempDir / TEXT("a.part")));
+
+	TestTrue(TEXT("Second download written"), FFileHelper::SaveStringToFile(TEXT("generated output"), *(TempDir / TEXT("b.part"))));
+	TestTrue(TEXT("Second staged"), FUnrealGPTDownloadManager::StageFile(TempDir / TEXT("b.part"), TempDir, TEXT("png"), SecondPath, bDeduplicated, Error));
+	TestTrue(TEXT("Second is deduplicated"), bDeduplicated);
+	TestEqual(TEXT("Both resolve to the same file"), SecondPath, FirstPath);
+	TestFalse(TEXT("Duplicate partial file removed"), FPaths::FileExists(TempDir / TEXT("b.part")));
+
+	IFileManager::Get().DeleteDirectory(*TempDir, false, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnrealGPTInlineContentStagingTest, "UnrealGPT.InlineContentStaging", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUnrealGPTInlineContentStagingTest::RunTest(const FString& Parameters)
+{
+	// Large enough to span several decode chunks, with a length that leaves a padded final group
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(200001);
+	for (int32 Index = 0; Index < Bytes.Num(); ++Index)
+	{
+		Bytes[Index] = static_cast<uint8>((Index * 131) ^ (Index >> 7));
+	}
+
+	// MIME-style line wrapping behind a data URI prefix
+	const FString Encoded = FBase64::Encode(Bytes);
+	FString Payload = TEXT("data:image/png;base64,");
+	for (int32 Start = 0; Start < Encoded.Len(); Start += 76)
+	{
+		Payload += Encoded.Mid(Start, 76) + TEXT("\r\n");
+	}
+
+	FString LocalPath;
+	FString Error;
+	TestTrue(TEXT("Inline payload staged"), FMcpResultNormalizer::SaveBase64ToStaging(Payload, TEXT("image/png"), TEXT("image"), LocalPath, Error));
+	TestEqual(TEXT("Staged as png"), FPaths::GetExtension(LocalPath), FString(TEXT("png")));
+
+	TArray<uint8> Staged;
+	TestTrue(TEXT("Staged file readable"), FFileHelper::LoadFileToArray(Staged, *LocalPath));
+	TestTrue(TEXT("Decoded bytes match"), Staged == Bytes);
+
+	FString SecondPath;
+	TestTrue(TEXT("Unwrapped payload staged"), FMcpResultNormalizer::SaveBase64ToStaging(Encoded, TEXT("image/png"), TEXT("image"), SecondPath, Error));
+	TestEqual(TEXT("Same content resolves to the same file"), SecondPath, LocalPath);
+
+	FString BadPath;
+	TestFalse(TEXT("Invalid characters rejected"), FMcpResultNormalizer::SaveBase64ToStaging(TEXT("QUJD$QUJD"), TEXT("image/png"), TEXT("image"), BadPath, Error));
+
+	// The envelope's raw result points at the staged file instead of carrying the payload again
+	TSharedPtr<FJsonObject> Block = MakeShared<FJsonObject>();
+	Block->SetStringField(TEXT("type"), TEXT("image"));
+	Block->SetStringField(TEXT("mimeType"), TEXT("image/png"));
+	Block->SetStringField(TEXT("data"), Encoded);
+	TSharedPtr<FJsonObject> McpResult = MakeShared<FJsonObject>();
+	McpResult->SetArrayField(TEXT("content"), { MakeShared<FJsonValueObject>(Block) });
+
+	const FString Envelope = FMcpResultNormalizer::BuildToolCallEnvelope(TEXT("server"), TEXT("tool"), McpResult, TEXT("image"));
+	TestTrue(TEXT("Envelope is much smaller than the payload"), Envelope.Len() < Encoded.Len() / 10);
+	TestTrue(TEXT("Envelope references the staged file"), Envelope.Contains(FPaths::GetCleanFilename(LocalPath)));
+
+	IFileManager::Get().Delete(*LocalPath);
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
 